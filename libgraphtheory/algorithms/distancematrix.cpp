@@ -0,0 +1,89 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "distancematrix.h"
+#include "shortestpaths.h"
+#include "graphsnapshot.h"
+#include "logging_p.h"
+
+#include <QtConcurrent>
+#include <algorithm>
+
+using namespace GraphTheory;
+
+DistanceMatrix::DistanceMatrix()
+    : m_null(true)
+    , m_revision(0)
+    , m_size(0)
+{
+}
+
+DistanceMatrix::DistanceMatrix(const GraphSnapshot &snapshot, int edgeType, int maximumSize)
+    : m_null(false)
+    , m_revision(snapshot.revision())
+    , m_size(snapshot.nodeCount())
+{
+    maximumSize = qMin(maximumSize, int(MaximumSize));
+    if (m_size > maximumSize) {
+        qCWarning(GRAPHTHEORY_GENERAL) << "Refusing to compute distance matrix for" << m_size << "nodes, at most" << maximumSize << "are supported";
+        m_null = true;
+        m_size = 0;
+        return;
+    }
+    m_data.resize(m_size * m_size); // cannot overflow for at most MaximumSize nodes
+
+    const ShortestPaths shortestPaths(snapshot, edgeType);
+    const int size = m_size;
+    qreal *data = m_data.data(); // detach once, rows are written concurrently
+
+    QVector<int> sources(size);
+    for (int i = 0; i < size; ++i) {
+        sources[i] = i;
+    }
+    QtConcurrent::blockingMap(sources, [&shortestPaths, data, size] (const int &source) {
+        const QVector<qreal> distances = shortestPaths.distances(source);
+        std::copy(distances.constBegin(), distances.constEnd(), data + qint64(source) * size);
+    });
+}
+
+bool DistanceMatrix::isNull() const
+{
+    return m_null;
+}
+
+quint64 DistanceMatrix::revision() const
+{
+    return m_revision;
+}
+
+int DistanceMatrix::size() const
+{
+    return m_size;
+}
+
+const qreal * DistanceMatrix::row(int from) const
+{
+    return m_data.constData() + qint64(from) * m_size;
+}
+
+const QVector<qreal> & DistanceMatrix::data() const
+{
+    return m_data;
+}
@@ -0,0 +1,108 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DISTANCEMATRIX_H
+#define DISTANCEMATRIX_H
+
+#include "graphtheory_export.h"
+
+#include <QVector>
+
+namespace GraphTheory
+{
+class GraphSnapshot;
+
+/**
+ * \class DistanceMatrix
+ * All-pairs shortest path distances of a GraphSnapshot, stored row-wise in one contiguous
+ * buffer. Rows and columns are node indices of the snapshot. The matrix is implicitly shared,
+ * copies are cheap.
+ *
+ * Distances are computed by one single-source shortest path computation per node, which are
+ * distributed over all available cores. The matrix needs memory quadratic in the number of nodes,
+ * hence it is only computed for snapshots up to a maximal size, by default MaximumSize nodes.
+ * @see ShortestPaths
+ */
+class GRAPHTHEORY_EXPORT DistanceMatrix
+{
+public:
+    /**
+     * Default for the largest supported number of nodes, for which the matrix needs 512 MB.
+     */
+    static const int MaximumSize = 8192;
+
+    /**
+     * Creates a null matrix.
+     */
+    DistanceMatrix();
+
+    /**
+     * Computes distances of all node pairs of @p snapshot, using its edge weights as lengths.
+     * If the snapshot has more than @p maximumSize nodes, a null matrix is created.
+     *
+     * @param snapshot      the graph snapshot
+     * @param edgeType      index of the edge type to be considered, -1 for all edge types
+     * @param maximumSize   largest number of nodes, at most MaximumSize
+     */
+    explicit DistanceMatrix(const GraphSnapshot &snapshot, int edgeType = -1, int maximumSize = MaximumSize);
+
+    /**
+     * @return @c true if the matrix was default constructed or the snapshot was too large
+     */
+    bool isNull() const;
+
+    /**
+     * @return document revision of the snapshot the matrix was computed from
+     */
+    quint64 revision() const;
+
+    /**
+     * @return number of rows, which equals the number of columns
+     */
+    int size() const;
+
+    /**
+     * @return distance from node with index @p from to node with index @p to
+     * @see ShortestPaths::distances() for values of unreachable nodes
+     */
+    qreal distance(int from, int to) const
+    {
+        return m_data.at(qint64(from) * m_size + to);
+    }
+
+    /**
+     * @return pointer to the size() distances from node with index @p from
+     */
+    const qreal * row(int from) const;
+
+    /**
+     * @return row-wise matrix data
+     */
+    const QVector<qreal> & data() const;
+
+private:
+    bool m_null;
+    quint64 m_revision;
+    int m_size;
+    QVector<qreal> m_data;
+};
+}
+
+#endif
@@ -0,0 +1,460 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "randomgraphgenerator.h"
+
+#include <QSet>
+#include <QVarLengthArray>
+#include <QtConcurrent>
+#include <qmath.h>
+
+#include <algorithm>
+#include <limits>
+
+using namespace GraphTheory;
+
+namespace
+{
+// expected number of edges (or points) generated by one concurrent block
+const qint64 BlockSize = 1 << 16;
+// upper bound for the number of blocks of one generator run
+const qint64 MaximumBlocks = 4096;
+
+/**
+ * SplitMix64 random number generator. Its state is a plain counter, hence independent streams
+ * for all blocks of a generator run are obtained by hashing the seed with the block number.
+ */
+class Random
+{
+public:
+    Random(quint64 seed, quint64 stream)
+        : m_state(seed)
+    {
+        m_state = next() ^ stream;
+        m_state = next();
+    }
+
+    quint64 next()
+    {
+        quint64 z = (m_state += Q_UINT64_C(0x9e3779b97f4a7c15));
+        z = (z ^ (z >> 30)) * Q_UINT64_C(0xbf58476d1ce4e5b9);
+        z = (z ^ (z >> 27)) * Q_UINT64_C(0x94d049bb133111eb);
+        return z ^ (z >> 31);
+    }
+
+    /** @return uniformly distributed value in [0,1) **/
+    qreal uniform()
+    {
+        return (next() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    /** @return uniformly distributed value in [0,@p bound) **/
+    quint64 bounded(quint64 bound)
+    {
+        // reject the incomplete last interval to avoid the modulo bias
+        const quint64 limit = std::numeric_limits<quint64>::max() - std::numeric_limits<quint64>::max() % bound;
+        quint64 value;
+        do {
+            value = next();
+        } while (value >= limit);
+        return value % bound;
+    }
+
+private:
+    quint64 m_state;
+};
+
+struct Block
+{
+    qint64 first;
+    qint64 last;
+    quint64 stream;
+    RandomGraphGenerator::EdgeVector edges;
+};
+
+/**
+ * Split @p count work items into blocks of about @p itemsPerBlock items. The split only depends
+ * on the arguments, such that the generated graph does not depend on the scheduling of the blocks.
+ */
+QVector<Block> split(qint64 count, qint64 itemsPerBlock)
+{
+    const qint64 blockCount = qBound(qint64(1), count / qMax(qint64(1), itemsPerBlock), MaximumBlocks);
+    const qint64 size = (count + blockCount - 1) / blockCount;
+    QVector<Block> blocks;
+    for (qint64 first = 0; first < count; first += size) {
+        Block block;
+        block.first = first;
+        block.last = qMin(first + size, count);
+        block.stream = blocks.size();
+        blocks.append(block);
+    }
+    return blocks;
+}
+
+RandomGraphGenerator::EdgeVector join(const QVector<Block> &blocks)
+{
+    int count = 0;
+    foreach (const Block &block, blocks) {
+        count += block.edges.size();
+    }
+    RandomGraphGenerator::EdgeVector edges;
+    edges.reserve(count);
+    foreach (const Block &block, blocks) {
+        edges += block.edges;
+    }
+    return edges;
+}
+
+/**
+ * Enumeration of all node pairs (v,w) with w < v, or w <= v with self edges, row by row.
+ */
+class PairIndex
+{
+public:
+    PairIndex(bool selfEdges)
+        : m_offset(selfEdges ? 1 : 0)
+    {
+    }
+
+    qint64 count(int nodes) const
+    {
+        return rowStart(nodes);
+    }
+
+    qint64 rowStart(qint64 v) const
+    {
+        return v * (v - 1 + 2 * m_offset) / 2;
+    }
+
+    qint64 rowLength(qint64 v) const
+    {
+        return v + m_offset;
+    }
+
+    QPair<int, int> pair(qint64 index) const
+    {
+        qint64 v = qint64((1 - 2 * m_offset + qSqrt(1 + 8 * qreal(index))) / 2);
+        while (v > 0 && rowStart(v) > index) {
+            --v;
+        }
+        while (rowStart(v + 1) <= index) {
+            ++v;
+        }
+        return qMakePair(int(v), int(index - rowStart(v)));
+    }
+
+private:
+    const qint64 m_offset;
+};
+}
+
+RandomGraphGenerator::RandomGraphGenerator(quint64 seed)
+    : m_seed(seed)
+{
+}
+
+quint64 RandomGraphGenerator::seed() const
+{
+    return m_seed;
+}
+
+void RandomGraphGenerator::setSeed(quint64 seed)
+{
+    m_seed = seed;
+}
+
+RandomGraphGenerator::EdgeVector RandomGraphGenerator::gnp(int nodes, qreal probability, bool selfEdges) const
+{
+    const PairIndex pairs(selfEdges);
+    const qint64 count = pairs.count(qMax(0, nodes));
+    if (probability <= 0 || count == 0) {
+        return EdgeVector();
+    }
+    probability = qMin(probability, qreal(1));
+
+    QVector<Block> blocks = split(count, qint64(qMin(qreal(count), BlockSize / probability)));
+    const quint64 seed = m_seed;
+    const qreal logMiss = qLn(1 - probability);
+    QtConcurrent::blockingMap(blocks, [&pairs, seed, probability, logMiss] (Block &block) {
+        Random random(seed, block.stream);
+        block.edges.reserve(int(qMin(qreal(block.last - block.first), (block.last - block.first) * probability * 1.1 + 16)));
+        const QPair<int, int> start = pairs.pair(block.first);
+        qint64 v = start.first;
+        qint64 w = start.second - 1;
+        qint64 index = block.first - 1;
+        while (true) {
+            // number of skipped pairs until the next chosen one is geometrically distributed
+            qint64 skip = 0;
+            if (probability < 1) {
+                const qreal gap = qFloor(qLn(1 - random.uniform()) / logMiss);
+                if (gap >= block.last - index) {
+                    break;
+                }
+                skip = qint64(gap);
+            }
+            index += skip + 1;
+            if (index >= block.last) {
+                break;
+            }
+            w += skip + 1;
+            while (w >= pairs.rowLength(v)) {
+                w -= pairs.rowLength(v);
+                ++v;
+            }
+            block.edges.append(qMakePair(int(v), int(w)));
+        }
+    });
+    return join(blocks);
+}
+
+RandomGraphGenerator::EdgeVector RandomGraphGenerator::gnm(int nodes, int edges, bool selfEdges) const
+{
+    const PairIndex pairs(selfEdges);
+    const qint64 count = pairs.count(qMax(0, nodes));
+    const qint64 samples = qBound(qint64(0), qint64(edges), count);
+
+    // Floyd's algorithm draws each of the samples once
+    Random random(m_seed, 0);
+    QSet<qint64> chosen;
+    chosen.reserve(int(samples));
+    QVector<qint64> indices;
+    indices.reserve(int(samples));
+    for (qint64 j = count - samples; j < count; ++j) {
+        qint64 index = qint64(random.bounded(quint64(j + 1)));
+        if (chosen.contains(index)) {
+            index = j;
+        }
+        chosen.insert(index);
+        indices.append(index);
+    }
+    std::sort(indices.begin(), indices.end());
+
+    EdgeVector result;
+    result.reserve(indices.size());
+    foreach (qint64 index, indices) {
+        result.append(pairs.pair(index));
+    }
+    return result;
+}
+
+RandomGraphGenerator::EdgeVector RandomGraphGenerator::barabasiAlbert(int nodes, int edgesPerNode) const
+{
+    EdgeVector result;
+    if (edgesPerNode < 1 || nodes <= edgesPerNode) {
+        return result;
+    }
+    result.reserve((nodes - edgesPerNode) * edgesPerNode);
+
+    // every node appears once per incident edge, hence a uniform entry is chosen proportional
+    // to the degree
+    QVector<int> endpoints;
+    endpoints.reserve(2 * (nodes - edgesPerNode) * edgesPerNode);
+    Random random(m_seed, 0);
+    QVarLengthArray<int, 16> targets;
+    for (int v = edgesPerNode; v < nodes; ++v) {
+        targets.clear();
+        if (v == edgesPerNode) {
+            for (int w = 0; w < edgesPerNode; ++w) {
+                targets.append(w);
+            }
+        }
+        while (targets.size() < edgesPerNode) {
+            const int w = endpoints.at(int(random.bounded(endpoints.size())));
+            if (std::find(targets.constBegin(), targets.constEnd(), w) == targets.constEnd()) {
+                targets.append(w);
+            }
+        }
+        for (int i = 0; i < targets.size(); ++i) {
+            result.append(qMakePair(v, targets.at(i)));
+            endpoints.append(v);
+            endpoints.append(targets.at(i));
+        }
+    }
+    return result;
+}
+
+RandomGraphGenerator::EdgeVector RandomGraphGenerator::wattsStrogatz(int nodes, int neighbors, qreal rewiring) const
+{
+    EdgeVector result;
+    const int half = qMin(neighbors / 2, (nodes - 1) / 2);
+    if (half < 1) {
+        return result;
+    }
+    result.reserve(nodes * half);
+    QSet<quint64> present;
+    present.reserve(nodes * half);
+    auto key = [] (int v, int w) {
+        return (quint64(qMax(v, w)) << 32) | quint64(qMin(v, w));
+    };
+    for (int j = 1; j <= half; ++j) {
+        for (int v = 0; v < nodes; ++v) {
+            result.append(qMakePair(v, (v + j) % nodes));
+            present.insert(key(v, (v + j) % nodes));
+        }
+    }
+
+    Random random(m_seed, 0);
+    QVector<int> degrees(nodes, 2 * half);
+    for (int i = 0; i < result.size(); ++i) {
+        const int v = result.at(i).first;
+        if (random.uniform() >= rewiring || degrees.at(v) >= nodes - 1) {
+            continue;
+        }
+        int w;
+        do {
+            w = int(random.bounded(nodes));
+        } while (w == v || present.contains(key(v, w)));
+        const int old = result.at(i).second;
+        present.remove(key(v, old));
+        present.insert(key(v, w));
+        --degrees[old];
+        ++degrees[w];
+        result[i].second = w;
+    }
+    for (int i = 0; i < result.size(); ++i) {
+        if (result.at(i).first < result.at(i).second) {
+            qSwap(result[i].first, result[i].second);
+        }
+    }
+    return result;
+}
+
+RandomGraphGenerator::EdgeVector RandomGraphGenerator::randomGeometric(int nodes, qreal radius, QVector<QPointF> *positions) const
+{
+    nodes = qMax(0, nodes);
+    QVector<QPointF> points(nodes);
+    QPointF *point = points.data(); // detach once, blocks are written concurrently
+    const quint64 seed = m_seed;
+    QVector<Block> pointBlocks = split(nodes, BlockSize);
+    QtConcurrent::blockingMap(pointBlocks, [point, seed] (Block &block) {
+        Random random(seed, block.stream);
+        for (qint64 i = block.first; i < block.last; ++i) {
+            const qreal x = random.uniform();
+            point[i] = QPointF(x, random.uniform());
+        }
+    });
+    if (positions) {
+        *positions = points;
+    }
+    if (nodes == 0 || radius <= 0) {
+        return EdgeVector();
+    }
+
+    // cells must not be smaller than the radius, such that all neighbors are in adjacent cells
+    const int side = qMax(1, qMin(int(qMin(qreal(1 << 15), 1 / radius)), int(qCeil(qSqrt(nodes)))));
+    auto cellOf = [side] (const QPointF &point) {
+        const int x = qMin(side - 1, int(point.x() * side));
+        const int y = qMin(side - 1, int(point.y() * side));
+        return y * side + x;
+    };
+    QVector<int> cellStart(side * side + 1, 0);
+    for (int i = 0; i < nodes; ++i) {
+        ++cellStart[cellOf(points.at(i)) + 1];
+    }
+    for (int c = 0; c < side * side; ++c) {
+        cellStart[c + 1] += cellStart[c];
+    }
+    QVector<int> members(nodes);
+    QVector<int> fill = cellStart;
+    for (int i = 0; i < nodes; ++i) {
+        members[fill[cellOf(points.at(i))]++] = i;
+    }
+
+    // each cell is compared with itself and the four adjacent cells that follow it
+    const qreal radius2 = radius * radius;
+    QVector<Block> blocks = split(side, qMax(qint64(1), BlockSize * side / qMax(1, nodes)));
+    QtConcurrent::blockingMap(blocks, [&points, &cellStart, &members, side, radius2] (Block &block) {
+        static const int dx[] = { 1, -1, 0, 1 };
+        static const int dy[] = { 0, 1, 1, 1 };
+        auto link = [&points, &members, &block, radius2] (int i, int j) {
+            const QPointF delta = points.at(members.at(i)) - points.at(members.at(j));
+            if (QPointF::dotProduct(delta, delta) <= radius2) {
+                const int v = members.at(i);
+                const int w = members.at(j);
+                block.edges.append(qMakePair(qMax(v, w), qMin(v, w)));
+            }
+        };
+        for (int y = int(block.first); y < block.last; ++y) {
+            for (int x = 0; x < side; ++x) {
+                const int cell = y * side + x;
+                for (int i = cellStart.at(cell); i < cellStart.at(cell + 1); ++i) {
+                    for (int j = i + 1; j < cellStart.at(cell + 1); ++j) {
+                        link(i, j);
+                    }
+                    for (int n = 0; n < 4; ++n) {
+                        const int nx = x + dx[n];
+                        const int ny = y + dy[n];
+                        if (nx < 0 || nx >= side || ny >= side) {
+                            continue;
+                        }
+                        const int other = ny * side + nx;
+                        for (int j = cellStart.at(other); j < cellStart.at(other + 1); ++j) {
+                            link(i, j);
+                        }
+                    }
+                }
+            }
+        }
+    });
+    return join(blocks);
+}
+
+RandomGraphGenerator::EdgeVector RandomGraphGenerator::rmat(int scale, int edges, qreal a, qreal b, qreal c) const
+{
+    scale = qBound(0, scale, 30);
+    a = qMax(qreal(0), a);
+    b = qMax(qreal(0), b);
+    c = qMax(qreal(0), c);
+    const qreal ab = a + b;
+    const qreal abc = ab + c;
+
+    QVector<Block> blocks = split(qMax(0, edges), BlockSize);
+    const quint64 seed = m_seed;
+    QtConcurrent::blockingMap(blocks, [seed, scale, a, ab, abc] (Block &block) {
+        Random random(seed, block.stream);
+        block.edges.reserve(int(block.last - block.first));
+        for (qint64 i = block.first; i < block.last; ++i) {
+            int row = 0;
+            int column = 0;
+            for (int level = 0; level < scale; ++level) {
+                const qreal r = random.uniform();
+                row <<= 1;
+                column <<= 1;
+                if (r >= abc) {
+                    row |= 1;
+                    column |= 1;
+                } else if (r >= ab) {
+                    row |= 1;
+                } else if (r >= a) {
+                    column |= 1;
+                }
+            }
+            if (row != column) {
+                block.edges.append(qMakePair(row, column));
+            }
+        }
+        std::sort(block.edges.begin(), block.edges.end());
+    });
+
+    EdgeVector result = join(blocks);
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
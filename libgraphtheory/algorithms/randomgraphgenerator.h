@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef RANDOMGRAPHGENERATOR_H
+#define RANDOMGRAPHGENERATOR_H
+
+#include "graphtheory_export.h"
+
+#include <QPair>
+#include <QPointF>
+#include <QVector>
+
+namespace GraphTheory
+{
+
+/**
+ * \class RandomGraphGenerator
+ * Generators for the common random graph models.
+ *
+ * The generators only compute edge lists of node indices, which are turned into a document by the
+ * bulk factories of Node and Edge without building any intermediate graph. All generators run in
+ * near-linear time in the number of nodes and edges. The work of the models without global
+ * constraints, i.e., G(n,p), random geometric graphs and R-MAT, is split into fixed blocks that are
+ * processed in parallel. Every block draws from its own random number stream derived from the seed
+ * and the block number, hence the output only depends on the seed and never on the number of threads.
+ *
+ * Edges of undirected models are given with the larger node index first. No generator creates
+ * duplicate edges; self edges are only created where explicitly requested.
+ */
+class GRAPHTHEORY_EXPORT RandomGraphGenerator
+{
+public:
+    typedef QVector<QPair<int, int>> EdgeVector;
+
+    explicit RandomGraphGenerator(quint64 seed = 1);
+
+    quint64 seed() const;
+    void setSeed(quint64 seed);
+
+    /**
+     * Erdős-Rényi graph G(n,p) with each of the possible edges chosen independently with
+     * probability @p probability. The gaps between chosen edges are drawn from the geometric
+     * distribution (Batagelj and Brandes 2005), hence the effort is proportional to the number of
+     * created edges instead of all node pairs.
+     */
+    EdgeVector gnp(int nodes, qreal probability, bool selfEdges = false) const;
+
+    /**
+     * Erdős-Rényi graph G(n,m) with @p edges edges chosen uniformly at random among all possible
+     * edges, by Floyd's sampling algorithm. If more edges are requested than possible, the
+     * complete graph is returned.
+     */
+    EdgeVector gnm(int nodes, int edges, bool selfEdges = false) const;
+
+    /**
+     * Barabási-Albert preferential attachment graph: starting with @p edgesPerNode nodes, every
+     * further node is connected to @p edgesPerNode distinct earlier nodes chosen with probability
+     * proportional to their degree. Edges point from the new node to the earlier nodes.
+     */
+    EdgeVector barabasiAlbert(int nodes, int edgesPerNode) const;
+
+    /**
+     * Watts-Strogatz small world graph: a ring in which every node is connected to its
+     * @p neighbors / 2 nearest nodes on each side, after which the far end of every edge is moved
+     * to a random node with probability @p rewiring, avoiding self edges and duplicates.
+     */
+    EdgeVector wattsStrogatz(int nodes, int neighbors, qreal rewiring) const;
+
+    /**
+     * Random geometric graph: @p nodes points are placed uniformly at random in the unit square and
+     * every pair with distance at most @p radius is connected. The neighbors are found by bucketing
+     * the points in a grid with cells of size @p radius.
+     *
+     * @param positions  if not null, receives the generated points
+     */
+    EdgeVector randomGeometric(int nodes, qreal radius, QVector<QPointF> *positions = 0) const;
+
+    /**
+     * Recursive matrix (R-MAT) graph on 2^@p scale nodes (Chakrabarti, Zhan and Faloutsos 2004):
+     * every edge descends @p scale times into one of the four quadrants of the adjacency matrix,
+     * chosen with probabilities @p a, @p b, @p c and 1 - @p a - @p b - @p c. Duplicate edges and
+     * self edges are dropped, hence the result may have less than @p edges edges. Edges are
+     * directed from row to column, i.e., the first index may be smaller than the second one.
+     */
+    EdgeVector rmat(int scale, int edges, qreal a = 0.57, qreal b = 0.19, qreal c = 0.19) const;
+
+private:
+    quint64 m_seed;
+};
+}
+
+#endif
@@ -0,0 +1,218 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "shortestpaths.h"
+
+#include <QQueue>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+using namespace GraphTheory;
+
+namespace
+{
+/**
+ * Marks all entries of @p targets in @p isTarget and returns the number of distinct targets.
+ */
+int markTargets(const QVector<int> &targets, QVector<bool> &isTarget)
+{
+    int count = 0;
+    for (int target : targets) {
+        if (target >= 0 && target < isTarget.size() && !isTarget.at(target)) {
+            isTarget[target] = true;
+            ++count;
+        }
+    }
+    return count;
+}
+}
+
+ShortestPaths::ShortestPaths(const GraphSnapshot &snapshot, int edgeType)
+    : m_adjacency(snapshot.outAdjacency(edgeType))
+    , m_nodeCount(snapshot.nodeCount())
+    , m_method(BreadthFirstSearch)
+    , m_uniformWeight(1)
+{
+    const QVector<qreal> &weights = m_adjacency.weights;
+    if (!weights.isEmpty()) {
+        m_uniformWeight = weights.first();
+    }
+    for (qreal weight : weights) {
+        if (weight < 0) {
+            m_method = BellmanFord;
+            break;
+        }
+        if (weight != m_uniformWeight) {
+            m_method = Dijkstra;
+        }
+    }
+    if (m_method == BreadthFirstSearch && m_uniformWeight < 0) {
+        m_method = BellmanFord;
+    }
+}
+
+ShortestPaths::Method ShortestPaths::method() const
+{
+    return m_method;
+}
+
+qreal ShortestPaths::infinity()
+{
+    return std::numeric_limits<qreal>::max();
+}
+
+QVector<qreal> ShortestPaths::distances(int source, const QVector<int> &targets) const
+{
+    QVector<qreal> distances(m_nodeCount, infinity());
+    if (source < 0 || source >= m_nodeCount) {
+        return distances;
+    }
+    switch (m_method) {
+    case BreadthFirstSearch:
+        breadthFirstSearch(source, targets, distances);
+        break;
+    case Dijkstra:
+        dijkstra(source, targets, distances);
+        break;
+    case BellmanFord:
+        bellmanFord(source, distances);
+        break;
+    }
+    return distances;
+}
+
+void ShortestPaths::breadthFirstSearch(int source, const QVector<int> &targets, QVector<qreal> &distances) const
+{
+    QVector<bool> isTarget(m_nodeCount, false);
+    int remainingTargets = markTargets(targets, isTarget);
+    const bool stopEarly = remainingTargets > 0;
+
+    // hop distances are settled when a node is discovered
+    QVector<int> hops(m_nodeCount, -1);
+    QQueue<int> queue;
+    hops[source] = 0;
+    queue.enqueue(source);
+    if (isTarget.at(source)) {
+        --remainingTargets;
+    }
+    while (!queue.isEmpty() && !(stopEarly && remainingTargets == 0)) {
+        const int u = queue.dequeue();
+        for (int i = m_adjacency.offsets.at(u); i < m_adjacency.offsets.at(u + 1); ++i) {
+            const int v = m_adjacency.nodes.at(i);
+            if (hops.at(v) >= 0) {
+                continue;
+            }
+            hops[v] = hops.at(u) + 1;
+            queue.enqueue(v);
+            if (isTarget.at(v)) {
+                --remainingTargets;
+            }
+        }
+    }
+    for (int v = 0; v < m_nodeCount; ++v) {
+        if (hops.at(v) >= 0) {
+            distances[v] = hops.at(v) * m_uniformWeight;
+        }
+    }
+}
+
+void ShortestPaths::dijkstra(int source, const QVector<int> &targets, QVector<qreal> &distances) const
+{
+    QVector<bool> isTarget(m_nodeCount, false);
+    int remainingTargets = markTargets(targets, isTarget);
+    const bool stopEarly = remainingTargets > 0;
+
+    // binary heap with lazy deletion of outdated entries
+    typedef std::pair<qreal, int> HeapEntry;
+    std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<HeapEntry>> heap;
+    QVector<bool> settled(m_nodeCount, false);
+    distances[source] = 0;
+    heap.push(HeapEntry(0, source));
+    while (!heap.empty()) {
+        const HeapEntry entry = heap.top();
+        heap.pop();
+        const int u = entry.second;
+        if (settled.at(u)) {
+            continue;
+        }
+        settled[u] = true;
+        if (isTarget.at(u) && --remainingTargets == 0 && stopEarly) {
+            break;
+        }
+        for (int i = m_adjacency.offsets.at(u); i < m_adjacency.offsets.at(u + 1); ++i) {
+            const int v = m_adjacency.nodes.at(i);
+            const qreal distance = entry.first + m_adjacency.weights.at(i);
+            if (distance < distances.at(v)) {
+                distances[v] = distance;
+                heap.push(HeapEntry(distance, v));
+            }
+        }
+    }
+}
+
+void ShortestPaths::bellmanFord(int source, QVector<qreal> &distances) const
+{
+    // after |V|-1 rounds all distances are final, unless a negative cycle is reachable
+    distances[source] = 0;
+    QVector<bool> improved(m_nodeCount, false);
+    bool changed = true;
+    for (int round = 0; round < m_nodeCount && changed; ++round) {
+        changed = false;
+        for (int u = 0; u < m_nodeCount; ++u) {
+            if (distances.at(u) == infinity()) {
+                continue;
+            }
+            for (int i = m_adjacency.offsets.at(u); i < m_adjacency.offsets.at(u + 1); ++i) {
+                const int v = m_adjacency.nodes.at(i);
+                const qreal distance = distances.at(u) + m_adjacency.weights.at(i);
+                if (distance < distances.at(v)) {
+                    distances[v] = distance;
+                    improved[v] = (round == m_nodeCount - 1);
+                    changed = true;
+                }
+            }
+        }
+    }
+    if (!changed) {
+        return;
+    }
+
+    // nodes still improving in the last round are reachable through a negative cycle,
+    // as are all nodes reachable from them
+    QQueue<int> queue;
+    for (int v = 0; v < m_nodeCount; ++v) {
+        if (improved.at(v)) {
+            distances[v] = -infinity();
+            queue.enqueue(v);
+        }
+    }
+    while (!queue.isEmpty()) {
+        const int u = queue.dequeue();
+        for (int i = m_adjacency.offsets.at(u); i < m_adjacency.offsets.at(u + 1); ++i) {
+            const int v = m_adjacency.nodes.at(i);
+            if (distances.at(v) != -infinity()) {
+                distances[v] = -infinity();
+                queue.enqueue(v);
+            }
+        }
+    }
+}
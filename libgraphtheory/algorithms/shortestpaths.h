@@ -0,0 +1,94 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SHORTESTPATHS_H
+#define SHORTESTPATHS_H
+
+#include "graphtheory_export.h"
+#include "graphsnapshot.h"
+
+#include <QVector>
+
+namespace GraphTheory
+{
+
+/**
+ * \class ShortestPaths
+ * Single-source shortest path computation on a GraphSnapshot.
+ *
+ * The algorithm is selected by the edge weights of the snapshot: breadth-first search if all
+ * edges have the same non-negative weight, Dijkstra's algorithm with a binary heap if all weights
+ * are non-negative, and Bellman-Ford only if negative weights exist. Memory consumption is linear
+ * in the size of the graph.
+ */
+class GRAPHTHEORY_EXPORT ShortestPaths
+{
+public:
+    enum Method {
+        BreadthFirstSearch,
+        Dijkstra,
+        BellmanFord
+    };
+
+    /**
+     * Prepares shortest path computations on @p snapshot, which must outlive this object.
+     *
+     * @param snapshot  the graph snapshot, its edge weights are used as edge lengths
+     * @param edgeType  index of the edge type to be considered, -1 for all edge types
+     */
+    explicit ShortestPaths(const GraphSnapshot &snapshot, int edgeType = -1);
+
+    /**
+     * @return the algorithm that is used for the edge weights of the snapshot
+     */
+    Method method() const;
+
+    /**
+     * Compute distances from node with index @p source. If @p targets is not empty, the
+     * computation may stop as soon as the distances of all target nodes are known; then only these
+     * entries of the result are guaranteed to be final.
+     *
+     * Nodes that are not reachable have distance infinity(), nodes that are reachable through a
+     * cycle of negative length have distance -infinity().
+     *
+     * @param source  index of the source node
+     * @param targets  indices of the nodes whose distances are requested
+     * @return vector of distances, indexed by node index
+     */
+    QVector<qreal> distances(int source, const QVector<int> &targets = QVector<int>()) const;
+
+    /**
+     * @return distance value for unreachable nodes
+     */
+    static qreal infinity();
+
+private:
+    void breadthFirstSearch(int source, const QVector<int> &targets, QVector<qreal> &distances) const;
+    void dijkstra(int source, const QVector<int> &targets, QVector<qreal> &distances) const;
+    void bellmanFord(int source, QVector<qreal> &distances) const;
+
+    const GraphSnapshot::Adjacency &m_adjacency;
+    const int m_nodeCount;
+    Method m_method;
+    qreal m_uniformWeight;
+};
+}
+
+#endif
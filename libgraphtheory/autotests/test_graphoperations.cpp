@@ -24,8 +24,24 @@
 #include "libgraphtheory/edgetype.h"
 #include "libgraphtheory/node.h"
 #include "libgraphtheory/edge.h"
+#include "libgraphtheory/graphsnapshot.h"
+#include "libgraphtheory/propertytable.h"
+#include "libgraphtheory/propertykey.h"
+#include "libgraphtheory/spatialgrid.h"
+#include "libgraphtheory/models/nodeselectionmodel.h"
+#include "libgraphtheory/algorithms/randomgraphgenerator.h"
+#include "libgraphtheory/modifiers/forcedirectedlayout.h"
+#include "libgraphtheory/modifiers/incrementallayout.h"
+#include "libgraphtheory/modifiers/layeredlayout.h"
+#include "libgraphtheory/modifiers/topology.h"
+#include "libgraphtheory/modifiers/valueassign.h"
 
 #include <QTest>
+#include <QSignalSpy>
+#include <QLineF>
+#include <QSet>
+#include <QThreadPool>
+#include <algorithm>
 
 void TestGraphOperations::initTestCase()
 {
@@ -117,6 +133,126 @@ void TestGraphOperations::testEdgeCreateDelete()
     document->destroy();
 }
 
+void TestGraphOperations::testNodeRemovalSignals()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    NodeList nodes;
+    for (int i = 0; i < 5; ++i) {
+        nodes.append(Node::create(document));
+    }
+    QSignalSpy removedSpy(document.data(), SIGNAL(nodesAboutToBeRemoved(int,int)));
+    QSignalSpy movedSpy(document.data(), SIGNAL(nodeAboutToBeMoved(int,int)));
+
+    // removing a node from the middle moves the last node into its slot
+    nodes.at(1)->destroy();
+    QCOMPARE(removedSpy.count(), 1);
+    QCOMPARE(removedSpy.at(0).at(0).toInt(), 1);
+    QCOMPARE(removedSpy.at(0).at(1).toInt(), 1);
+    QCOMPARE(movedSpy.count(), 1);
+    QCOMPARE(movedSpy.at(0).at(0).toInt(), 3);
+    QCOMPARE(movedSpy.at(0).at(1).toInt(), 1);
+    QCOMPARE(document->nodes().length(), 4);
+    QCOMPARE(document->nodes().at(1), nodes.at(4));
+
+    // removing the last node does not move any node
+    nodes.at(3)->destroy();
+    QCOMPARE(removedSpy.count(), 2);
+    QCOMPARE(removedSpy.at(1).at(0).toInt(), 3);
+    QCOMPARE(movedSpy.count(), 1);
+
+    // remaining nodes can be removed and are not registered twice
+    document->insert(nodes.at(0));
+    QCOMPARE(document->nodes().length(), 3);
+    nodes.at(0)->destroy();
+    QCOMPARE(document->nodes().length(), 2);
+    QVERIFY(!document->nodes().contains(nodes.at(0)));
+    QVERIFY(document->nodes().contains(nodes.at(2)));
+    QVERIFY(document->nodes().contains(nodes.at(4)));
+
+    document->destroy();
+}
+
+void TestGraphOperations::testHubEdgeRemoval()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    NodePtr hub = Node::create(document);
+    EdgeList edges;
+    for (int i = 0; i < 100; ++i) {
+        edges.append(Edge::create(hub, Node::create(document)));
+    }
+    edges.append(Edge::create(hub, hub));
+    QCOMPARE(hub->edges().length(), 101);
+
+    // removing edges in arbitrary order keeps the adjacency list consistent
+    for (int i = 0; i < edges.length(); i += 2) {
+        edges.at(i)->destroy();
+    }
+    QCOMPARE(hub->edges().length(), 50);
+    for (int i = 0; i < edges.length(); ++i) {
+        QCOMPARE(hub->edges().contains(edges.at(i)), i % 2 == 1);
+    }
+
+    // removing an edge twice or re-inserting a contained edge has no effect
+    hub->remove(edges.at(0));
+    hub->insert(edges.at(1));
+    QCOMPARE(hub->edges().length(), 50);
+
+    // remove all remaining edges like the transform widget does
+    foreach (EdgePtr edge, hub->edges()) {
+        hub->remove(edge);
+    }
+    QVERIFY(hub->edges().isEmpty());
+    QCOMPARE(document->edges().length(), 0);
+
+    document->destroy();
+}
+
+void TestGraphOperations::testBatchSignals()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    Node::create(document);
+    QSignalSpy nodesSpy(document.data(), SIGNAL(nodesAboutToBeAdded(int,int)));
+    QSignalSpy edgesSpy(document.data(), SIGNAL(edgesAboutToBeAdded(int,int)));
+
+    {
+        BatchGuard batch(document);
+        document->beginBatch(); // nested batch
+        NodePtr from = Node::create(document);
+        NodePtr to = Node::create(document);
+        Edge::create(from, to);
+        document->endBatch();
+        QCOMPARE(document->nodes().length(), 3);
+        QCOMPARE(nodesSpy.count(), 0);
+        QCOMPARE(edgesSpy.count(), 0);
+    }
+    QCOMPARE(nodesSpy.count(), 1);
+    QCOMPARE(nodesSpy.at(0).at(0).toInt(), 1);
+    QCOMPARE(nodesSpy.at(0).at(1).toInt(), 2);
+    QCOMPARE(edgesSpy.count(), 1);
+    QCOMPARE(edgesSpy.at(0).at(0).toInt(), 0);
+    QCOMPARE(edgesSpy.at(0).at(1).toInt(), 0);
+
+    // removal during a batch publishes pending insertions first
+    document->beginBatch();
+    NodePtr node = Node::create(document);
+    QCOMPARE(nodesSpy.count(), 1);
+    node->destroy();
+    QCOMPARE(nodesSpy.count(), 2);
+    QCOMPARE(nodesSpy.at(1).at(0).toInt(), 3);
+    document->endBatch();
+    QCOMPARE(nodesSpy.count(), 2);
+
+    // a batch still open when the document is destroyed, e.g. by a running script, publishes
+    // nothing when it is closed afterwards
+    document->beginBatch();
+    Node::create(document);
+    document->destroy();
+    const int announced = nodesSpy.count();
+    document->endBatch();
+    QCOMPARE(nodesSpy.count(), announced);
+    QCOMPARE(edgesSpy.count(), 1);
+}
+
 void TestGraphOperations::testNodeTypeCreateDelete()
 {
     GraphDocumentPtr document = GraphDocument::create();
@@ -236,6 +372,30 @@ void TestGraphOperations::testNodeIdentifiers()
     document->destroy();
 }
 
+void TestGraphOperations::testNodeLookupById()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    NodePtr nodeA = Node::create(document);
+    NodePtr nodeB = Node::create(document);
+
+    QCOMPARE(document->node(nodeA->id()), nodeA);
+    QCOMPARE(document->node(nodeB->id()), nodeB);
+
+    // changing the identifier must update the lookup
+    const int oldId = nodeA->id();
+    nodeA->setId(1000);
+    QCOMPARE(document->node(1000), nodeA);
+    QVERIFY(!document->node(oldId));
+
+    // removed nodes must not be found anymore
+    const int idB = nodeB->id();
+    nodeB->destroy();
+    QVERIFY(!document->node(idB));
+    QCOMPARE(document->node(1000), nodeA);
+
+    document->destroy();
+}
+
 // test if edges between nodes are returned correctly
 void TestGraphOperations::testUnidirectionalEdges()
 {
@@ -396,4 +556,807 @@ void TestGraphOperations::testDynamicPropertyRename()
     document->destroy();
 }
 
+void TestGraphOperations::testPropertyTable()
+{
+    // typed columns, integers are promoted to real numbers
+    PropertyTable table;
+    const int rowA = table.allocateRow();
+    const int rowB = table.allocateRow();
+    const int weight = table.addColumn("weight");
+    QCOMPARE(table.addColumn("weight"), weight);
+    QCOMPARE(table.valueType(weight), PropertyTable::Empty);
+    table.setValue(weight, rowA, 2);
+    QCOMPARE(table.valueType(weight), PropertyTable::Integer);
+    table.setValue(weight, rowB, 0.5);
+    QCOMPARE(table.valueType(weight), PropertyTable::Real);
+    QCOMPARE(table.reals(weight)[rowA], qreal(2));
+    QCOMPARE(table.realValue(weight, rowB), qreal(0.5));
+    table.setValue(weight, rowB, QVariant());
+    QVERIFY(!table.hasValue(weight, rowB));
+    QCOMPARE(table.reals(weight)[rowB], qreal(0));
+
+    // mixed values fall back to variants
+    const int name = table.addColumn("name");
+    table.setValue(name, rowA, "a");
+    QCOMPARE(table.valueType(name), PropertyTable::String);
+    table.setValue(name, rowB, true);
+    QCOMPARE(table.valueType(name), PropertyTable::Variant);
+    QCOMPARE(table.value(name, rowA), QVariant("a"));
+    QCOMPARE(table.value(name, rowB), QVariant(true));
+    QVERIFY(!table.reals(name));
+
+    // released rows are cleared and reused
+    table.releaseRow(rowA);
+    QCOMPARE(table.allocateRow(), rowA);
+    QVERIFY(!table.hasValue(weight, rowA));
+    QVERIFY(!table.value(name, rowA).isValid());
+
+    // values are stored at the type and follow type changes, even if the property is not
+    // registered at the new type
+    GraphDocumentPtr document = GraphDocument::create();
+    NodeTypePtr typeA = document->nodeTypes().first();
+    NodeTypePtr typeB = NodeType::create(document);
+    typeA->addDynamicProperty("a");
+    NodePtr node = Node::create(document);
+    node->setDynamicProperty("a", 1.5);
+    const int column = typeA->propertyTable()->column("a");
+    const int row = node->propertyRow();
+    QCOMPARE(typeA->propertyTable()->realValue(column, row), qreal(1.5));
+    node->setType(typeB);
+    QCOMPARE(node->dynamicProperty("a"), QVariant(1.5));
+    QVERIFY(!typeA->propertyTable()->hasValue(column, row));
+    QVERIFY(!node->dynamicProperties().contains("a"));
+    typeB->addDynamicProperty("a");
+    QCOMPARE(node->dynamicProperty("a"), QVariant(1.5));
+    typeB->removeDynamicProperty("a");
+    QVERIFY(!node->dynamicProperty("a").isValid());
+
+    document->destroy();
+}
+
+void TestGraphOperations::testPropertyKeys()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    NodeTypePtr typeA = document->nodeTypes().first();
+    NodeTypePtr typeB = NodeType::create(document);
+    NodePtr nodeA = Node::create(document);
+    NodePtr nodeB = Node::create(document);
+    nodeB->setType(typeB);
+
+    // keys are only available for registered properties
+    QVERIFY(!typeA->dynamicPropertyKey("a").isValid());
+    const PropertyKey keyA = typeA->addDynamicProperty("a");
+    const PropertyKey keyB = typeA->addDynamicProperty("b");
+    QVERIFY(keyA.isValid());
+    QCOMPARE(keyA.name(), QString("a"));
+    QCOMPARE(typeA->addDynamicProperty("a").name(), QString("a"));
+    QCOMPARE(typeA->dynamicPropertyKey("b").name(), QString("b"));
+
+    // access by key and by name are equivalent and notify the property index
+    QSignalSpy changedSpy(nodeA.data(), SIGNAL(dynamicPropertyChanged(int)));
+    nodeA->setDynamicProperty(keyB, 42);
+    QCOMPARE(nodeA->dynamicProperty("b"), QVariant(42));
+    QCOMPARE(changedSpy.count(), 1);
+    QCOMPARE(changedSpy.first().at(0).toInt(), 1);
+    nodeA->setDynamicProperty("a", "value");
+    QCOMPARE(nodeA->dynamicProperty(keyA), QVariant("value"));
+
+    // keys of another type are resolved by name
+    typeB->addDynamicProperty("b");
+    nodeB->setDynamicProperty(keyB, 1.5);
+    QCOMPARE(nodeB->dynamicProperty("b"), QVariant(1.5));
+    QCOMPARE(nodeB->dynamicProperty(keyB), QVariant(1.5));
+
+    // keys follow renamed properties and become stale with removed properties
+    typeA->renameDynamicProperty("b", "c");
+    QCOMPARE(nodeA->dynamicProperty(keyB), QVariant(42));
+    typeA->removeDynamicProperty("a");
+    typeA->addDynamicProperty("d");
+    nodeA->setDynamicProperty("d", 7);
+    QVERIFY(!nodeA->dynamicProperty(keyA).isValid());
+    QCOMPARE(nodeA->dynamicProperty("d"), QVariant(7));
+    QCOMPARE(typeA->dynamicPropertyIndex(typeA->propertyTable()->column("c")), 0);
+
+    // keys stay direct when a value write converts the column, and keys of removed columns
+    // do not resolve to a column that reuses their index
+    PropertyTable table;
+    const int row = table.allocateRow();
+    const int column = table.addColumn("first");
+    const PropertyKey key = table.key(column);
+    table.setValue(column, row, 1.5);
+    table.renameColumn("first", "renamed");
+    QCOMPARE(table.column(key), column);
+    table.removeColumn("renamed");
+    QCOMPARE(table.addColumn("second"), column);
+    QCOMPARE(table.column(key), -1);
+
+    document->destroy();
+}
+
+void TestGraphOperations::testGraphSnapshot()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    EdgeTypePtr unidirectional = document->edgeTypes().first();
+    unidirectional->setDirection(EdgeType::Unidirectional);
+    unidirectional->addDynamicProperty("weight");
+    EdgeTypePtr bidirectional = EdgeType::create(document);
+    bidirectional->setDirection(EdgeType::Bidirectional);
+    NodePtr nodeA = Node::create(document);
+    NodePtr nodeB = Node::create(document);
+    NodePtr nodeC = Node::create(document);
+    EdgePtr edgeAB = Edge::create(nodeA, nodeB);
+    edgeAB->setDynamicProperty("weight", 3);
+    EdgePtr edgeBC = Edge::create(nodeB, nodeC);
+    edgeBC->setType(bidirectional);
+
+    GraphSnapshot snapshot(document, "weight");
+    QVERIFY(snapshot.isValid());
+    QCOMPARE(snapshot.nodeCount(), 3);
+    QCOMPARE(snapshot.edgeCount(), 2);
+    QCOMPARE(snapshot.edgeTypeCount(), 2);
+    QCOMPARE(snapshot.node(nodeB->documentIndex()), nodeB);
+
+    // outgoing: A->B, B->C, C->B
+    const GraphSnapshot::Adjacency &out = snapshot.outAdjacency();
+    const int a = nodeA->documentIndex();
+    const int b = nodeB->documentIndex();
+    const int c = nodeC->documentIndex();
+    QCOMPARE(out.offsets.size(), 4);
+    QCOMPARE(out.offsets.at(a + 1) - out.offsets.at(a), 1);
+    QCOMPARE(out.offsets.at(b + 1) - out.offsets.at(b), 1);
+    QCOMPARE(out.offsets.at(c + 1) - out.offsets.at(c), 1);
+    QCOMPARE(out.nodes.at(out.offsets.at(a)), b);
+    QCOMPARE(out.weights.at(out.offsets.at(a)), qreal(3));
+    QCOMPARE(out.nodes.at(out.offsets.at(c)), b);
+
+    // incoming of unidirectional type only
+    const GraphSnapshot::Adjacency &in = snapshot.inAdjacency(snapshot.edgeTypeIndex(unidirectional));
+    QCOMPARE(in.offsets.at(b + 1) - in.offsets.at(b), 1);
+    QCOMPARE(in.nodes.at(in.offsets.at(b)), a);
+    QCOMPARE(in.offsets.at(a + 1) - in.offsets.at(a), 0);
+    QCOMPARE(in.offsets.at(c + 1) - in.offsets.at(c), 0);
+
+    // any structural change invalidates the snapshot
+    edgeAB->setDynamicProperty("weight", 4);
+    QVERIFY(!snapshot.isValid());
+    GraphSnapshot secondSnapshot(document);
+    QVERIFY(secondSnapshot.isValid());
+    Node::create(document);
+    QVERIFY(!secondSnapshot.isValid());
+
+    document->destroy();
+
+    // the snapshot does not keep its document alive
+    GraphSnapshot orphan;
+    {
+        GraphDocumentPtr other = GraphDocument::create();
+        Edge::create(Node::create(other), Node::create(other));
+        orphan = GraphSnapshot(other);
+        QCOMPARE(orphan.document(), other);
+        other->destroy();
+    }
+    QVERIFY(!orphan.document());
+    QVERIFY(!orphan.isValid());
+    QVERIFY(!orphan.node(0));
+    QCOMPARE(orphan.edgeCount(), 1);
+}
+
+void TestGraphOperations::testSpatialGrid()
+{
+    SpatialGrid grid(100);
+    grid.insert(0, QRectF(10, 10, 20, 20));
+    grid.insert(1, QRectF(150, 150, 20, 20));
+    grid.insert(2, QRectF(90, 90, 20, 20)); // spans four cells
+    grid.insert(3, QRectF(-5000, -5000, 10000, 10000)); // oversized
+    QCOMPARE(grid.count(), 4);
+
+    QVector<int> items = grid.items(QRectF(0, 0, 50, 50));
+    std::sort(items.begin(), items.end());
+    QCOMPARE(items, QVector<int>() << 0 << 3);
+
+    // items spanning several cells are reported once
+    items = grid.items(QRectF(0, 0, 200, 200));
+    std::sort(items.begin(), items.end());
+    QCOMPARE(items, QVector<int>() << 0 << 1 << 2 << 3);
+
+    // point queries
+    items = grid.items(QRectF(105, 105, 0, 0));
+    std::sort(items.begin(), items.end());
+    QCOMPARE(items, QVector<int>() << 2 << 3);
+
+    // update and removal
+    grid.insert(0, QRectF(155, 155, 5, 5));
+    grid.remove(3);
+    QCOMPARE(grid.count(), 3);
+    QVERIFY(!grid.contains(3));
+    QCOMPARE(grid.bounds(0), QRectF(155, 155, 5, 5));
+    QVERIFY(grid.items(QRectF(0, 0, 50, 50)).isEmpty());
+    items = grid.items(QRectF(150, 150, 10, 10));
+    std::sort(items.begin(), items.end());
+    QCOMPARE(items, QVector<int>() << 0 << 1);
+
+    QCOMPARE(grid.cell(QPointF(-1, 250)), QPoint(-1, 2));
+    grid.clear();
+    QCOMPARE(grid.count(), 0);
+    QVERIFY(grid.items(QRectF(0, 0, 200, 200)).isEmpty());
+}
+
+void TestGraphOperations::testNodeSpatialIndex()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    NodePtr nodeA = Node::create(document);
+    NodePtr nodeB = Node::create(document);
+    NodePtr nodeC = Node::create(document);
+    nodeA->setX(10);
+    nodeA->setY(10);
+    nodeB->setX(500);
+    nodeB->setY(500);
+    nodeC->setX(12);
+    nodeC->setY(12);
+
+    QCOMPARE(document->nodesAt(QRectF(0, 0, 50, 50)), NodeList() << nodeA << nodeC);
+    QCOMPARE(document->nodeAt(QPointF(11, 11), 5), nodeC); // last node is topmost
+    QVERIFY(!document->nodeAt(QPointF(100, 100), 5));
+
+    // index follows movements
+    nodeB->setX(20);
+    nodeB->setY(20);
+    QCOMPARE(document->nodesAt(QRectF(0, 0, 50, 50)), NodeList() << nodeA << nodeB << nodeC);
+    QVERIFY(document->nodesAt(QRectF(450, 450, 100, 100)).isEmpty());
+
+    // removal moves the last node to the freed position
+    nodeA->destroy();
+    QCOMPARE(document->nodesAt(QRectF(0, 0, 50, 50)), NodeList() << nodeC << nodeB);
+    nodeC->setX(1000);
+    QCOMPARE(document->nodesAt(QRectF(0, 0, 50, 50)), NodeList() << nodeB);
+
+    document->destroy();
+}
+
+void TestGraphOperations::testNodeSelectionModel()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    NodePtr nodeA = Node::create(document);
+    NodePtr nodeB = Node::create(document);
+    NodePtr nodeC = Node::create(document);
+    nodeB->setX(100);
+    nodeC->setX(200);
+
+    NodeSelectionModel selection;
+    selection.setDocument(document);
+    QSignalSpy spy(&selection, &NodeSelectionModel::selectionChanged);
+
+    selection.selectArea(QRectF(-10, -10, 120, 20));
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(spy.last().at(0).value<NodeList>().count(), 2);
+    QVERIFY(spy.last().at(1).value<NodeList>().isEmpty());
+    QVERIFY(selection.isSelected(nodeA.data()));
+    QVERIFY(selection.isSelected(nodeB.data()));
+
+    // only the difference is reported
+    selection.selectArea(QRectF(90, -10, 120, 20));
+    QCOMPARE(spy.count(), 2);
+    QCOMPARE(spy.last().at(0).value<NodeList>(), NodeList() << nodeC);
+    QCOMPARE(spy.last().at(1).value<NodeList>(), NodeList() << nodeA);
+    selection.selectArea(QRectF(90, -10, 120, 20));
+    QCOMPARE(spy.count(), 2);
+
+    // removed nodes leave the selection
+    nodeB->destroy();
+    QCOMPARE(spy.count(), 3);
+    QCOMPARE(spy.last().at(1).value<NodeList>(), NodeList() << nodeB);
+    QCOMPARE(selection.count(), 1);
+
+    selection.clear();
+    QCOMPARE(selection.count(), 0);
+    QCOMPARE(spy.count(), 4);
+
+    document->destroy();
+}
+
+void TestGraphOperations::testNodePositionSignals()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    NodePtr nodeA = Node::create(document);
+    NodePtr nodeB = Node::create(document);
+    QSignalSpy nodeSpy(nodeA.data(), &Node::positionChanged);
+    QSignalSpy documentSpy(document.data(), &GraphDocument::nodePositionsChanged);
+
+    // atomic position change
+    nodeA->setPosition(QPointF(10, 20));
+    QCOMPARE(nodeSpy.count(), 1);
+    QCOMPARE(documentSpy.count(), 1);
+    QCOMPARE(nodeA->position(), QPointF(10, 20));
+    nodeA->setPosition(QPointF(10, 20));
+    QCOMPARE(nodeSpy.count(), 1);
+
+    // movements during a batch are announced once when the batch is closed
+    NodePtr nodeC;
+    {
+        BatchGuard batch(document);
+        nodeA->setX(30);
+        nodeA->setY(40);
+        nodeB->setPosition(QPointF(50, 60));
+        nodeC = Node::create(document);
+        nodeC->setPosition(QPointF(70, 80));
+        QCOMPARE(nodeSpy.count(), 1);
+        QCOMPARE(documentSpy.count(), 1);
+    }
+    QCOMPARE(nodeSpy.count(), 2);
+    QCOMPARE(nodeSpy.last().at(0).toPointF(), QPointF(30, 40));
+    QCOMPARE(documentSpy.count(), 2);
+    // nodes inserted during the batch are announced by the insertion
+    QCOMPARE(documentSpy.last().at(0).value<NodeList>(), NodeList() << nodeA << nodeB);
+    QCOMPARE(document->nodesAt(QRectF(65, 75, 10, 10)), NodeList() << nodeC);
+
+    document->destroy();
+}
+
+void TestGraphOperations::testForceDirectedLayout()
+{
+    // cycle of coincident nodes
+    GraphDocumentPtr document = GraphDocument::create();
+    NodeList nodes;
+    for (int i = 0; i < 40; ++i) {
+        nodes.append(Node::create(document));
+        if (i > 0) {
+            Edge::create(nodes.at(i - 1), nodes.at(i));
+        }
+    }
+    Edge::create(nodes.last(), nodes.first());
+
+    ForceDirectedLayout layout;
+    layout.apply(nodes);
+    QVERIFY(layout.isConverged());
+    QVERIFY(layout.iterations() < layout.maximumIterations());
+    // nodes are separated and adjacent nodes are placed closer than average
+    qreal distance = 0;
+    for (int i = 0; i < nodes.count(); ++i) {
+        for (int j = i + 1; j < nodes.count(); ++j) {
+            const qreal length = QLineF(nodes.at(i)->position(), nodes.at(j)->position()).length();
+            QVERIFY(length > layout.edgeLength() / 10);
+            distance += length;
+        }
+    }
+    distance /= nodes.count() * (nodes.count() - 1) / 2;
+    qreal edgeDistance = 0;
+    foreach (EdgePtr edge, document->edges()) {
+        edgeDistance += QLineF(edge->from()->position(), edge->to()->position()).length();
+    }
+    edgeDistance /= document->edges().count();
+    QVERIFY(edgeDistance > layout.edgeLength() / 2);
+    QVERIFY(edgeDistance < distance / 2);
+
+    // asynchronous layout moves the nodes and announces the end
+    QSignalSpy finishedSpy(&layout, &ForceDirectedLayout::finished);
+    QSignalSpy positionSpy(document.data(), &GraphDocument::nodePositionsChanged);
+    layout.setEdgeLength(50);
+    QVERIFY(layout.start(nodes));
+    QVERIFY(layout.isRunning());
+    QVERIFY(!layout.start(nodes));
+    QVERIFY(finishedSpy.wait());
+    QVERIFY(!layout.isRunning());
+    QVERIFY(!layout.isCanceled());
+    QVERIFY(positionSpy.count() > 0);
+
+    // canceled layouts stop early and still apply their last positions
+    layout.setTolerance(0);
+    layout.setMaximumIterations(1000000);
+    QVERIFY(layout.start(nodes));
+    layout.cancel();
+    QVERIFY(finishedSpy.count() == 2 || finishedSpy.wait());
+    QVERIFY(layout.isCanceled());
+    QVERIFY(!layout.isConverged());
+    QVERIFY(layout.iterations() < layout.maximumIterations());
+
+    document->destroy();
+}
+
+void TestGraphOperations::testMultilevelLayout()
+{
+    // grid graph with all nodes at the same position, as created by importers
+    const int width = 12;
+    GraphDocumentPtr document = GraphDocument::create();
+    NodeList nodes;
+    for (int i = 0; i < width * width; ++i) {
+        nodes.append(Node::create(document));
+        if (i % width > 0) {
+            Edge::create(nodes.at(i - 1), nodes.at(i));
+        }
+        if (i >= width) {
+            Edge::create(nodes.at(i - width), nodes.at(i));
+        }
+    }
+
+    Topology topology;
+    topology.undirectedGraphDefaultTopology(document);
+    qreal edgeDistance = 0;
+    foreach (EdgePtr edge, document->edges()) {
+        edgeDistance += QLineF(edge->from()->position(), edge->to()->position()).length();
+    }
+    edgeDistance /= document->edges().count();
+    QVERIFY(edgeDistance > 0);
+
+    // the grid is unfolded: opposite corners are far apart
+    const qreal diagonal = QLineF(nodes.first()->position(), nodes.last()->position()).length();
+    const qreal antiDiagonal = QLineF(nodes.at(width - 1)->position(), nodes.at(width * (width - 1))->position()).length();
+    QVERIFY(diagonal > (width - 1) * edgeDistance);
+    QVERIFY(antiDiagonal > (width - 1) * edgeDistance);
+
+    // multilevel layouts converge on each level
+    ForceDirectedLayout layout;
+    layout.setMultilevel(true);
+    layout.apply(nodes);
+    QVERIFY(layout.isConverged());
+
+    document->destroy();
+}
+
+void TestGraphOperations::testLayeredLayout()
+{
+    // binary tree with edges from parents to children
+    GraphDocumentPtr document = GraphDocument::create();
+    document->edgeTypes().first()->setDirection(EdgeType::Unidirectional);
+    NodeList nodes;
+    for (int i = 0; i < 31; ++i) {
+        nodes.append(Node::create(document));
+        if (i > 0) {
+            Edge::create(nodes.at((i - 1) / 2), nodes.at(i));
+        }
+    }
+    QVERIFY(LayeredLayout::isAcyclic(nodes));
+
+    LayeredLayout layout;
+    layout.apply(nodes);
+    QCOMPARE(layout.reversedEdges(), 0);
+    QCOMPARE(layout.crossings(), qint64(0));
+    foreach (EdgePtr edge, document->edges()) {
+        QCOMPARE(edge->to()->y() - edge->from()->y(), layout.layerDistance());
+    }
+    // nodes of a layer keep their distance, parents are centered above their children
+    for (int i = 0; i < nodes.count(); ++i) {
+        for (int j = i + 1; j < nodes.count(); ++j) {
+            if (nodes.at(i)->y() == nodes.at(j)->y()) {
+                QVERIFY(qAbs(nodes.at(i)->x() - nodes.at(j)->x()) >= layout.nodeDistance() - 0.001);
+            }
+        }
+    }
+    QVERIFY(qAbs(nodes.at(0)->x() - (nodes.at(1)->x() + nodes.at(2)->x()) / 2) < 0.001);
+
+    // closing a cycle requires to reverse one edge
+    Edge::create(nodes.last(), nodes.first());
+    QVERIFY(!LayeredLayout::isAcyclic(nodes));
+    layout.apply(nodes);
+    QCOMPARE(layout.reversedEdges(), 1);
+    int downwards = 0;
+    foreach (EdgePtr edge, document->edges()) {
+        if (edge->to()->y() > edge->from()->y()) {
+            ++downwards;
+        }
+    }
+    QCOMPARE(downwards, document->edges().count() - 1);
+
+    // directed acyclic graphs get layers by default
+    document->edges().last()->destroy();
+    Topology topology;
+    topology.directedGraphDefaultTopology(document);
+    QVERIFY(nodes.at(0)->y() < nodes.at(1)->y());
+    QCOMPARE(nodes.at(1)->y(), nodes.at(2)->y());
+
+    document->destroy();
+}
+
+void TestGraphOperations::testIncrementalLayout()
+{
+    // path with laid out nodes
+    GraphDocumentPtr document = GraphDocument::create();
+    NodeList nodes;
+    for (int i = 0; i < 10; ++i) {
+        nodes.append(Node::create(document));
+        nodes.last()->setPosition(QPointF(100 * i, 0));
+        if (i > 0) {
+            Edge::create(nodes.at(i - 1), nodes.at(i));
+        }
+    }
+    IncrementalLayout layout(document);
+    QVERIFY(!layout.hasChanges());
+
+    // a new leaf only moves itself and its neighbor
+    NodePtr leaf = Node::create(document);
+    Edge::create(nodes.at(5), leaf);
+    QVERIFY(layout.hasChanges());
+    QCOMPARE(layout.changedNodes().count(), 2);
+    layout.apply();
+    QVERIFY(!layout.hasChanges());
+    for (int i = 0; i < nodes.count(); ++i) {
+        if (i != 5) {
+            QCOMPARE(nodes.at(i)->position(), QPointF(100 * i, 0));
+        }
+    }
+    const qreal distance = QLineF(leaf->position(), nodes.at(5)->position()).length();
+    QVERIFY(distance > 0);
+    QVERIFY(distance < 2 * layout.edgeLength());
+
+    // pinned nodes keep their position in force directed layouts
+    ForceDirectedLayout forceDirected;
+    forceDirected.setPinnedNodes(nodes.mid(0, 9));
+    forceDirected.apply(nodes);
+    for (int i = 0; i < 9; ++i) {
+        QCOMPARE(nodes.at(i)->position(), QPointF(100 * i, 0));
+    }
+
+    document->destroy();
+}
+
+void TestGraphOperations::testRandomGraphGenerators()
+{
+    // every edge is within range, undirected edges are normalized, no duplicates
+    auto verifyEdges = [] (const RandomGraphGenerator::EdgeVector &edges, int nodes, bool normalized) {
+        QSet<QPair<int, int>> seen;
+        foreach (const auto &edge, edges) {
+            QVERIFY(edge.first >= 0 && edge.first < nodes);
+            QVERIFY(edge.second >= 0 && edge.second < nodes);
+            QVERIFY(edge.first != edge.second);
+            if (normalized) {
+                QVERIFY(edge.first > edge.second);
+            }
+            QVERIFY(!seen.contains(edge));
+            seen.insert(edge);
+        }
+    };
+
+    RandomGraphGenerator generator(42);
+    const RandomGraphGenerator::EdgeVector gnp = generator.gnp(1000, 0.01);
+    verifyEdges(gnp, 1000, true);
+    QVERIFY(qAbs(gnp.size() - 4995) < 400);
+    QCOMPARE(generator.gnp(1000, 0.01), gnp);
+    QCOMPARE(generator.gnp(20, 1).size(), 190);
+    QCOMPARE(generator.gnp(20, 1, true).size(), 210);
+
+    const RandomGraphGenerator::EdgeVector gnm = generator.gnm(1000, 5000);
+    verifyEdges(gnm, 1000, true);
+    QCOMPARE(gnm.size(), 5000);
+    QCOMPARE(generator.gnm(10, 100).size(), 45);
+
+    const RandomGraphGenerator::EdgeVector barabasiAlbert = generator.barabasiAlbert(1000, 3);
+    verifyEdges(barabasiAlbert, 1000, true);
+    QCOMPARE(barabasiAlbert.size(), (1000 - 3) * 3);
+
+    const RandomGraphGenerator::EdgeVector wattsStrogatz = generator.wattsStrogatz(1000, 6, 0.2);
+    verifyEdges(wattsStrogatz, 1000, true);
+    QCOMPARE(wattsStrogatz.size(), 3000);
+
+    QVector<QPointF> positions;
+    const RandomGraphGenerator::EdgeVector geometric = generator.randomGeometric(500, 0.1, &positions);
+    verifyEdges(geometric, 500, true);
+    QCOMPARE(positions.size(), 500);
+    int close = 0;
+    for (int i = 0; i < positions.size(); ++i) {
+        for (int j = 0; j < i; ++j) {
+            if (QLineF(positions.at(i), positions.at(j)).length() <= 0.1) {
+                ++close;
+            }
+        }
+    }
+    QCOMPARE(geometric.size(), close);
+
+    const RandomGraphGenerator::EdgeVector rmat = generator.rmat(10, 5000);
+    verifyEdges(rmat, 1024, false);
+    QVERIFY(rmat.size() <= 5000);
+    QCOMPARE(generator.rmat(10, 5000), rmat);
+
+    // another seed gives another graph
+    generator.setSeed(43);
+    QVERIFY(generator.gnp(1000, 0.01) != gnp);
+}
+
+void TestGraphOperations::testBulkCreation()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    EdgeTypePtr edgeType = EdgeType::create(document);
+    QSignalSpy nodesSpy(document.data(), SIGNAL(nodesAboutToBeAdded(int,int)));
+    QSignalSpy edgesSpy(document.data(), SIGNAL(edgesAboutToBeAdded(int,int)));
+
+    QVector<QPointF> positions;
+    for (int i = 0; i < 100; ++i) {
+        positions.append(QPointF(i, 2 * i));
+    }
+    const NodeList nodes = Node::create(document, positions);
+    QCOMPARE(nodesSpy.count(), 1);
+    QCOMPARE(document->nodes().count(), 100);
+    QCOMPARE(nodes.at(7)->position(), QPointF(7, 14));
+    QCOMPARE(document->nodesAt(QRectF(6.5, 13.5, 1, 1)).count(), 1);
+
+    RandomGraphGenerator::EdgeVector pairs;
+    for (int i = 0; i < 100; ++i) {
+        pairs.append(qMakePair(i, (i + 1) % 100));
+    }
+    pairs.append(qMakePair(5, 5));
+    const EdgeList edges = Edge::create(nodes, pairs, edgeType);
+    QCOMPARE(edgesSpy.count(), 1);
+    QCOMPARE(edges.count(), 101);
+    QCOMPARE(edges.at(3)->from(), nodes.at(3));
+    QCOMPARE(edges.at(3)->to(), nodes.at(4));
+    QCOMPARE(edges.at(3)->type(), edgeType);
+    QCOMPARE(nodes.at(0)->edges().count(), 2);
+    // self edges are attached once
+    QCOMPARE(nodes.at(5)->edges().count(), 3);
+
+    document->destroy();
+}
+
+void TestGraphOperations::testCompactStorage()
+{
+    GraphDocumentPtr document = GraphDocument::create(GraphDocument::CompactStorage);
+    QCOMPARE(document->storageMode(), GraphDocument::CompactStorage);
+    NodeTypePtr nodeType = NodeType::create(document);
+    const PropertyKey label = nodeType->addDynamicProperty("label");
+    EdgeTypePtr edgeType = document->edgeTypes().first();
+    edgeType->setDirection(EdgeType::Unidirectional);
+    const PropertyKey weight = edgeType->addDynamicProperty("weight");
+    const uint nodeObjects = Node::objects();
+    const uint edgeObjects = Edge::objects();
+
+    // nodes and edges are created and accessed without objects
+    QVector<QPointF> positions;
+    for (int i = 0; i < 10; ++i) {
+        positions.append(QPointF(i, -i));
+    }
+    QCOMPARE(document->createNodes(positions), 0);
+    NodeHandle nodeA = document->createNode(QPointF(20, 30), nodeType);
+    QCOMPARE(nodeA.index(), 10);
+    nodeA.setDynamicProperty(label, "a");
+    nodeA.setColor(QColor("#ff0000"));
+    nodeA.setId(42);
+    RandomGraphGenerator::EdgeVector pairs;
+    for (int i = 0; i < 10; ++i) {
+        pairs.append(qMakePair(i, (i + 1) % 10));
+    }
+    QCOMPARE(document->createEdges(pairs), 0);
+    const quint64 revision = document->revision();
+    EdgeHandle edgeA = document->createEdge(nodeA, document->nodeHandle(3));
+    edgeA.setDynamicProperty(weight, 2.5);
+    QVERIFY(document->revision() > revision);
+    QCOMPARE(document->nodeCount(), 11);
+    QCOMPARE(document->edgeCount(), 11);
+    QCOMPARE(document->nodeHandle(7).position(), QPointF(7, -7));
+    QCOMPARE(nodeA.type(), nodeType);
+    QCOMPARE(nodeA.dynamicProperty(label), QVariant("a"));
+    QCOMPARE(document->edgeHandle(4).from(), document->nodeHandle(4));
+    QCOMPARE(document->edgeHandle(4).to(), document->nodeHandle(5));
+    QCOMPARE(edgeA.dynamicProperty(weight), QVariant(2.5));
+
+    // snapshots read the compact storage
+    const GraphSnapshot snapshot(document, "weight");
+    QCOMPARE(snapshot.nodeCount(), 11);
+    QCOMPARE(snapshot.edgeWeights().at(10), qreal(2.5));
+    QCOMPARE(snapshot.outAdjacency().nodes.at(snapshot.outAdjacency().offsets.at(10)), 3);
+    QCOMPARE(Node::objects(), nodeObjects);
+    QCOMPARE(Edge::objects(), edgeObjects);
+    QCOMPARE(document->storageMode(), GraphDocument::CompactStorage);
+
+    // accessing a single element creates only its object, silently and with all values
+    QSignalSpy nodesSpy(document.data(), SIGNAL(nodesAboutToBeAdded(int,int)));
+    const NodePtr node = nodeA.node();
+    QCOMPARE(document->storageMode(), GraphDocument::CompactStorage);
+    QCOMPARE(Node::objects(), nodeObjects + 1);
+    QCOMPARE(Edge::objects(), edgeObjects);
+    QCOMPARE(nodeA.node(), node);
+    QVERIFY(snapshot.isValid());
+    QCOMPARE(snapshot.node(10), node);
+    QCOMPARE(document->node(42), node);
+    QCOMPARE(node->documentIndex(), 10);
+    QCOMPARE(node->type(), nodeType);
+    QCOMPARE(node->position(), QPointF(20, 30));
+    QCOMPARE(node->color(), QColor("#ff0000"));
+    QCOMPARE(node->dynamicProperty("label"), QVariant("a"));
+    QCOMPARE(Node::objects(), nodeObjects + 1);
+
+    // the object holds the data of its node from now on
+    node->setPosition(QPointF(25, 30));
+    node->setId(43);
+    QCOMPARE(nodeA.position(), QPointF(25, 30));
+    QCOMPARE(document->node(43), node);
+    QVERIFY(!document->node(42));
+    QCOMPARE(document->nodesAt(QRectF(24, 29, 2, 2)), NodeList() << node);
+    QCOMPARE(document->nodeAt(QPointF(7, -7), 0.5), document->nodeHandle(7).node());
+    QCOMPARE(Node::objects(), nodeObjects + 2);
+
+    // adjacency lists are completed by the objects of the incident edges and their end points
+    QCOMPARE(node->outEdges().count(), 1);
+    QCOMPARE(Node::objects(), nodeObjects + 3);
+    QCOMPARE(Edge::objects(), edgeObjects + 1);
+    QCOMPARE(node->outEdges().first()->to(), document->nodeHandle(3).node());
+    QCOMPARE(node->outEdges().first()->dynamicProperty("weight"), QVariant(2.5));
+    QCOMPARE(edgeA.edge(), node->outEdges().first());
+    QCOMPARE(Edge::objects(), edgeObjects + 1);
+    QCOMPARE(document->storageMode(), GraphDocument::CompactStorage);
+
+    // accessing all elements creates the missing objects and takes over the existing ones
+    QCOMPARE(document->nodes().at(10), node);
+    QCOMPARE(document->storageMode(), GraphDocument::ObjectStorage);
+    QCOMPARE(Node::objects(), nodeObjects + 11);
+    QCOMPARE(Edge::objects(), edgeObjects + 11);
+    QCOMPARE(nodesSpy.count(), 0);
+    QCOMPARE(document->node(43), node);
+    QCOMPARE(node->outEdges().count(), 1);
+    QCOMPARE(document->nodes().at(0)->edges().count(), 2);
+    QCOMPARE(document->nodesAt(QRectF(6.5, -7.5, 1, 1)).count(), 1);
+
+    // handles keep working on objects
+    document->nodeHandle(1).setPosition(QPointF(5, 5));
+    QCOMPARE(document->nodes().at(1)->position(), QPointF(5, 5));
+    QCOMPARE(edgeA.from(), nodeA);
+    QCOMPARE(edgeA.edge(), node->outEdges().first());
+    const EdgeHandle edgeB = document->createEdge(document->nodeHandle(0), nodeA);
+    QCOMPARE(edgeB.index(), 11);
+    QCOMPARE(Edge::objects(), edgeObjects + 12);
+
+    document->destroy();
+}
+
+void TestGraphOperations::testValueAssign()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    NodeTypePtr type = document->nodeTypes().first();
+    type->addDynamicProperty("weight");
+    // enough nodes to generate the values in several blocks
+    const NodeList nodes = Node::create(document, QVector<QPointF>(70000));
+    QSignalSpy valuesSpy(type.data(), SIGNAL(dynamicPropertyValuesChanged(int)));
+    QSignalSpy nodeSpy(nodes.first().data(), SIGNAL(dynamicPropertyChanged(int)));
+
+    // random values are typed, announced once and do not depend on the number of threads
+    ValueAssign modifier;
+    modifier.assignRandomReals(nodes, "weight", 1, 2, 42);
+    QCOMPARE(valuesSpy.count(), 1);
+    QCOMPARE(valuesSpy.first().at(0).toInt(), 0);
+    QCOMPARE(nodeSpy.count(), 0);
+    PropertyTable *table = type->propertyTable();
+    const int column = table->column("weight");
+    QCOMPARE(table->valueType(column), PropertyTable::Real);
+    QVector<qreal> values;
+    foreach (const NodePtr &node, nodes) {
+        const qreal value = table->realValue(column, node->propertyRow());
+        QVERIFY(value >= 1 && value <= 2);
+        values.append(value);
+    }
+    const int threads = QThreadPool::globalInstance()->maxThreadCount();
+    QThreadPool::globalInstance()->setMaxThreadCount(1);
+    modifier.assignRandomReals(nodes, "weight", 1, 2, 42);
+    QThreadPool::globalInstance()->setMaxThreadCount(threads);
+    for (int i = 0; i < nodes.count(); ++i) {
+        QCOMPARE(nodes.at(i)->dynamicProperty("weight").toReal(), values.at(i));
+    }
+    modifier.assignRandomReals(nodes, "weight", 1, 2, 43);
+    QVERIFY(nodes.first()->dynamicProperty("weight").toReal() != values.first());
+
+    // integers from the closed range
+    modifier.assignRandomIntegers(nodes, "weight", -1, 1, 42);
+    QSet<int> integers;
+    foreach (const NodePtr &node, nodes) {
+        integers.insert(node->dynamicProperty("weight").toInt());
+    }
+    QCOMPARE(integers, QSet<int>() << -1 << 0 << 1);
+
+    // existing values are kept unless overridden, enumeration skips them
+    NodeTypePtr otherType = NodeType::create(document);
+    const NodeList smallList = nodes.mid(0, 4);
+    smallList.at(3)->setType(otherType);
+    smallList.at(1)->setDynamicProperty("label", "kept");
+    modifier.enumerate(smallList, "label", 5, "", false);
+    QCOMPARE(smallList.at(0)->dynamicProperty("label"), QVariant(5));
+    QCOMPARE(smallList.at(1)->dynamicProperty("label"), QVariant("kept"));
+    QCOMPARE(smallList.at(2)->dynamicProperty("label"), QVariant(6));
+    QCOMPARE(smallList.at(3)->dynamicProperty("label"), QVariant(7));
+    modifier.assignConstantValue(smallList, "label", "constant");
+    foreach (const NodePtr &node, smallList) {
+        QCOMPARE(node->dynamicProperty("label"), QVariant("constant"));
+    }
+    modifier.enumerateAlpha(smallList, "label", "a");
+    QCOMPARE(smallList.at(2)->dynamicProperty("label"), QVariant("c"));
+
+    document->destroy();
+}
+
+
 QTEST_MAIN(TestGraphOperations)
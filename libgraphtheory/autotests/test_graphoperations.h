@@ -42,16 +42,35 @@ private Q_SLOTS:
     void testDocumentCreateDelete();
     void testNodeCreateDelete();
     void testEdgeCreateDelete();
+    void testNodeRemovalSignals();
+    void testHubEdgeRemoval();
+    void testBatchSignals();
     void testNodeTypeCreateDelete();
     void testEdgeTypeCreateDelete();
     void testNodeDynamicProperties();
     void testEdgeDynamicProperties();
     void testNodeIdentifiers();
+    void testNodeLookupById();
     void testUnidirectionalEdges();
     void testBidirectionalEdges();
     void testEdgesOfDifferentType();
     void testEdgeDirectionChange();
     void testDynamicPropertyRename();
+    void testPropertyTable();
+    void testPropertyKeys();
+    void testGraphSnapshot();
+    void testSpatialGrid();
+    void testNodeSpatialIndex();
+    void testNodeSelectionModel();
+    void testNodePositionSignals();
+    void testForceDirectedLayout();
+    void testMultilevelLayout();
+    void testLayeredLayout();
+    void testIncrementalLayout();
+    void testRandomGraphGenerators();
+    void testBulkCreation();
+    void testCompactStorage();
+    void testValueAssign();
 };
 
 #endif
@@ -25,8 +25,12 @@
 #include "libgraphtheory/edgetype.h"
 #include "libgraphtheory/node.h"
 #include "libgraphtheory/edge.h"
+#include "libgraphtheory/algorithms/distancematrix.h"
 
+#include <QCoreApplication>
+#include <QSignalSpy>
 #include <QTest>
+#include <limits>
 
 void TestKernel::initTestCase()
 {
@@ -596,6 +600,28 @@ void TestKernel::createNode()
     result = kernel.execute(document, script);
     QCOMPARE(document->nodes().count(), 1);
 
+    // creations are published together at the end of the execution
+    QSignalSpy addedSpy(document.data(), SIGNAL(nodesAboutToBeAdded(int,int)));
+    script = "Document.createNode(0, 0); Document.createNode(0, 0);";
+    result = kernel.execute(document, script);
+    QCOMPARE(document->nodes().count(), 3);
+    QCOMPARE(addedSpy.count(), 1);
+    QCOMPARE(addedSpy.at(0).at(0).toInt(), 1);
+    QCOMPARE(addedSpy.at(0).at(1).toInt(), 2);
+
+    // and whenever the running script processes events, here forced by each console message
+    addedSpy.clear();
+    QMetaObject::Connection turn = connect(&kernel, &Kernel::message, []() {
+        QCoreApplication::processEvents();
+    });
+    script = "Document.createNode(0, 0); Console.log('turn'); Document.createNode(0, 0);";
+    result = kernel.execute(document, script);
+    disconnect(turn);
+    QCOMPARE(document->nodes().count(), 5);
+    QCOMPARE(addedSpy.count(), 2);
+    QCOMPARE(addedSpy.at(0).at(0).toInt(), 3);
+    QCOMPARE(addedSpy.at(1).at(0).toInt(), 4);
+
     // cleanup
     document->destroy();
 }
@@ -686,6 +712,115 @@ void TestKernel::distance()
     result = kernel.execute(document, script);
     QCOMPARE(result.toInteger(), qreal(2));
 
+    // shortcut that is longer than the path via B
+    EdgePtr edgeAC = Edge::create(nodeA, nodeC);
+    edgeAC->setDynamicProperty("dist", "5");
+    script = "Document.nodes()[0].distance(\"dist\", Document.nodes())[2];";
+    result = kernel.execute(document, script);
+    QCOMPARE(result.toInteger(), qreal(2));
+    edgeAC->setDynamicProperty("dist", "1.5");
+    result = kernel.execute(document, script);
+    QCOMPARE(result.toNumber(), qreal(1.5));
+
+    // unreachable node
+    Node::create(document);
+    script = "Document.nodes()[0].distance(\"dist\", Document.nodes())[3];";
+    result = kernel.execute(document, script);
+    QCOMPARE(result.toNumber(), std::numeric_limits<qreal>::max());
+
+    // cleanup
+    document->destroy();
+}
+
+void TestKernel::distanceMatrix()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    NodePtr nodeA = Node::create(document);
+    NodePtr nodeB = Node::create(document);
+    NodePtr nodeC = Node::create(document);
+    EdgePtr edgeAB = Edge::create(nodeA, nodeB);
+    EdgePtr edgeBC = Edge::create(nodeB, nodeC);
+    document->edgeTypes().first()->addDynamicProperty("dist");
+    document->edgeTypes().first()->setDirection(EdgeType::Unidirectional);
+    edgeAB->setDynamicProperty("dist", "1");
+    edgeBC->setDynamicProperty("dist", "2");
+
+    Kernel kernel;
+    QString script;
+    QScriptValue result;
+
+    script = "Document.distanceMatrix(\"dist\")[0][2];";
+    result = kernel.execute(document, script);
+    QCOMPARE(result.toNumber(), qreal(3));
+    QVERIFY(document->hasDistanceMatrix("dist"));
+    QCOMPARE(document->distanceMatrix("dist").distance(2, 0), std::numeric_limits<qreal>::max());
+
+    // single-source queries use the cached matrix
+    script = "var sum = 0; var nodes = Document.nodes();"
+             "for (var i = 0; i < nodes.length; ++i) { sum += nodes[i].distance(\"dist\", nodes)[2]; }"
+             "sum;";
+    result = kernel.execute(document, script);
+    QCOMPARE(result.toNumber(), qreal(5));
+
+    // changed weights invalidate the cache
+    edgeBC->setDynamicProperty("dist", "4");
+    QVERIFY(!document->hasDistanceMatrix("dist"));
+
+    // repeated single-source queries do not compute a matrix on their own
+    for (int i = 0; i < 2; ++i) {
+        result = kernel.execute(document, script);
+        QCOMPARE(result.toNumber(), qreal(9));
+        QVERIFY(!document->hasDistanceMatrix("dist"));
+    }
+
+    script = "Document.distanceMatrix(\"dist\")[0][2];";
+    result = kernel.execute(document, script);
+    QCOMPARE(result.toNumber(), qreal(5));
+
+    // renamed or removed length properties invalidate the cache
+    QVERIFY(document->hasDistanceMatrix("dist"));
+    document->edgeTypes().first()->renameDynamicProperty("dist", "length");
+    QVERIFY(!document->hasDistanceMatrix("dist"));
+    QCOMPARE(document->distanceMatrix("length").distance(0, 2), qreal(5));
+    QVERIFY(document->hasDistanceMatrix("length"));
+    document->edgeTypes().first()->removeDynamicProperty("length");
+    QVERIFY(!document->hasDistanceMatrix("length"));
+
+    // documents beyond the size limit get no matrix
+    document->setDistanceMatrixLimit(2);
+    script = "Document.distanceMatrix(\"dist\").length;";
+    result = kernel.execute(document, script);
+    QCOMPARE(result.toInteger(), qreal(0));
+    QVERIFY(document->distanceMatrix("dist").isNull());
+    document->setDistanceMatrixLimit(3);
+    result = kernel.execute(document, script);
+    QCOMPARE(result.toInteger(), qreal(3));
+
+    // cleanup
+    document->destroy();
+}
+
+void TestKernel::layout()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    NodePtr nodeA = Node::create(document);
+    NodePtr nodeB = Node::create(document);
+    NodePtr nodeC = Node::create(document);
+    Edge::create(nodeA, nodeB);
+    Edge::create(nodeA, nodeC);
+    document->edgeTypes().first()->setDirection(EdgeType::Unidirectional);
+
+    Kernel kernel;
+    kernel.execute(document, "Document.layout(\"layered\");");
+    QVERIFY(nodeA->y() < nodeB->y());
+    QCOMPARE(nodeB->y(), nodeC->y());
+    QVERIFY(nodeB->x() != nodeC->x());
+
+    // unknown methods do not move nodes
+    const QPointF position = nodeA->position();
+    kernel.execute(document, "Document.layout(\"unknown\");");
+    QCOMPARE(nodeA->position(), position);
+
     // cleanup
     document->destroy();
 }
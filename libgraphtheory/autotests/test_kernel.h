@@ -79,6 +79,9 @@ private Q_SLOTS:
     void deleteEdge();
     /** test Node::distance function **/
     void distance();
+    /** test Document::distanceMatrix function **/
+    void distanceMatrix();
+    void layout();
 };
 
 #endif
@@ -0,0 +1,83 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmarkreport.h"
+#include <QDateTime>
+#include <QDebug>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSysInfo>
+#include <QXmlStreamReader>
+
+bool writeBenchmarkReport(const QString &xmlLogFile, const QString &jsonFile)
+{
+    QFile log(xmlLogFile);
+    if (!log.open(QIODevice::ReadOnly)) {
+        qCritical() << "Could not open benchmark log" << xmlLogFile << log.errorString();
+        return false;
+    }
+
+    QJsonObject report;
+    QJsonArray results;
+    QString testFunction;
+    QXmlStreamReader xml(&log);
+    while (!xml.atEnd()) {
+        if (xml.readNext() != QXmlStreamReader::StartElement) {
+            continue;
+        }
+        const QXmlStreamAttributes attributes = xml.attributes();
+        if (xml.name() == QLatin1String("TestCase")) {
+            report.insert("testCase", attributes.value("name").toString());
+        } else if (xml.name() == QLatin1String("QtVersion")) {
+            report.insert("qtVersion", xml.readElementText());
+        } else if (xml.name() == QLatin1String("TestFunction")) {
+            testFunction = attributes.value("name").toString();
+        } else if (xml.name() == QLatin1String("BenchmarkResult")) {
+            const qreal value = attributes.value("value").toDouble();
+            const int iterations = qMax(1, attributes.value("iterations").toInt());
+            QJsonObject result;
+            result.insert("function", testFunction);
+            result.insert("tag", attributes.value("tag").toString());
+            result.insert("metric", attributes.value("metric").toString());
+            result.insert("value", value);
+            result.insert("iterations", iterations);
+            result.insert("valuePerIteration", value / iterations);
+            results.append(result);
+        }
+    }
+    if (xml.hasError()) {
+        qCritical() << "Could not parse benchmark log" << xmlLogFile << xml.errorString();
+        return false;
+    }
+    report.insert("timestamp", QDateTime::currentDateTimeUtc().toString(Qt::ISODate));
+    report.insert("cpuArchitecture", QSysInfo::currentCpuArchitecture());
+    report.insert("kernelVersion", QSysInfo::kernelVersion());
+    report.insert("results", results);
+
+    QFile output(jsonFile);
+    if (!output.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qCritical() << "Could not write benchmark report" << jsonFile << output.errorString();
+        return false;
+    }
+    output.write(QJsonDocument(report).toJson());
+    return true;
+}
@@ -0,0 +1,36 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BENCHMARKREPORT_H
+#define BENCHMARKREPORT_H
+
+#include <QString>
+
+/**
+ * Convert the XML log written by QTest (option "-o <file>,xml") into a JSON report.
+ * Each QBENCHMARK result becomes one entry with test function, data tag, metric,
+ * total value, iteration count and the value per iteration. The report is meant to
+ * be archived and compared between releases.
+ *
+ * @return @e true if the report was written, otherwise @e false
+ */
+bool writeBenchmarkReport(const QString &xmlLogFile, const QString &jsonFile);
+
+#endif
@@ -0,0 +1,574 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "graphtheorybenchmarks.h"
+#include "benchmarkreport.h"
+#include "graphdocument.h"
+#include "node.h"
+#include "edge.h"
+#include "nodetype.h"
+#include "edgetype.h"
+#include "graphsnapshot.h"
+#include "fileformats/fileformatinterface.h"
+#include "kernel/documentwrapper.h"
+#include "kernel/nodewrapper.h"
+#include "models/nodemodel.h"
+#include "algorithms/randomgraphgenerator.h"
+#include "modifiers/topology.h"
+#include "modifiers/valueassign.h"
+
+#include <QApplication>
+#include <QDir>
+#include <QRegularExpression>
+#include <QScriptEngine>
+#include <QTest>
+#include <qmath.h>
+#include <random>
+
+namespace {
+
+/** Largest exponent of the generated graph sizes. */
+int maxExponent()
+{
+    bool ok = false;
+    const int exponent = qgetenv("GRAPHTHEORY_BENCHMARK_MAX_EXPONENT").toInt(&ok);
+    return ok ? exponent : 6;
+}
+
+/** Largest generated graph size. */
+int maxSize()
+{
+    int size = 1;
+    for (int exponent = 0; exponent < maxExponent(); ++exponent) {
+        size *= 10;
+    }
+    return size;
+}
+
+/** Add data rows "10^minExponent" ... "10^maxExponent" for column "size". */
+void addSizeRows(int minExponent, int maxExponentLimit)
+{
+    QTest::addColumn<int>("size");
+    const int last = qMin(maxExponentLimit, maxExponent());
+    int size = 1;
+    for (int exponent = 0; exponent <= last; ++exponent) {
+        if (exponent >= minExponent) {
+            QTest::newRow(QByteArray::number(size).constData()) << size;
+        }
+        size *= 10;
+    }
+}
+
+/**
+ * Create a document with @p nodeCount nodes at random positions and @p edgesPerNode
+ * outgoing edges per node with random targets and random "weight" property.
+ * The generator is seeded, hence all runs use the same graph.
+ */
+GraphDocumentPtr createGraph(int nodeCount, int edgesPerNode)
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    document->edgeTypes().first()->addDynamicProperty("weight");
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> target(0, qMax(0, nodeCount - 1));
+    std::uniform_real_distribution<qreal> coordinate(0, 1000);
+    std::uniform_real_distribution<qreal> weight(1, 10);
+
+    BatchGuard batch(document);
+    NodeList nodes;
+    nodes.reserve(nodeCount);
+    for (int i = 0; i < nodeCount; ++i) {
+        NodePtr node = Node::create(document);
+        node->setX(coordinate(generator));
+        node->setY(coordinate(generator));
+        nodes.append(node);
+    }
+    for (int i = 0; i < nodeCount; ++i) {
+        for (int k = 0; k < edgesPerNode; ++k) {
+            const int to = target(generator);
+            if (to == i) {
+                continue;
+            }
+            EdgePtr edge = Edge::create(nodes.at(i), nodes.at(to));
+            edge->setDynamicProperty("weight", weight(generator));
+        }
+    }
+    return document;
+}
+
+/** @return first file suffix of @p backend, e.g. "graph2" for "Rocs Graph File (*.graph2)" */
+QString suffix(FileFormatInterface *backend)
+{
+    QRegularExpressionMatch match = QRegularExpression("\\*\\.([a-zA-Z0-9]+)").match(backend->extensions().join(QString()));
+    return match.hasMatch() ? match.captured(1) : QString();
+}
+
+}
+
+void GraphTheoryBenchmarks::initTestCase()
+{
+    QVERIFY(m_directory.isValid());
+    QVERIFY(GraphDocument::objects() == 0);
+}
+
+void GraphTheoryBenchmarks::cleanupTestCase()
+{
+    QVERIFY(GraphDocument::objects() == 0);
+    QVERIFY(Node::objects() == 0);
+    QVERIFY(Edge::objects() == 0);
+}
+
+void GraphTheoryBenchmarks::nodeCreateDestroy_data()
+{
+    addSizeRows(3, 6);
+}
+
+void GraphTheoryBenchmarks::nodeCreateDestroy()
+{
+    QFETCH(int, size);
+    QBENCHMARK {
+        GraphDocumentPtr document = GraphDocument::create();
+        {
+            BatchGuard batch(document);
+            for (int i = 0; i < size; ++i) {
+                Node::create(document);
+            }
+        }
+        document->destroy();
+    }
+}
+
+void GraphTheoryBenchmarks::edgeCreateDestroy_data()
+{
+    addSizeRows(3, 6);
+}
+
+void GraphTheoryBenchmarks::edgeCreateDestroy()
+{
+    QFETCH(int, size);
+    GraphDocumentPtr document = createGraph(size, 0);
+    const NodeList nodes = document->nodes();
+    QBENCHMARK {
+        EdgeList edges;
+        edges.reserve(size);
+        {
+            BatchGuard batch(document);
+            for (int i = 0; i < size; ++i) {
+                edges.append(Edge::create(nodes.at(i), nodes.at((i + 1) % size)));
+            }
+        }
+        BatchGuard batch(document);
+        foreach (EdgePtr edge, edges) {
+            edge->destroy();
+        }
+    }
+    document->destroy();
+}
+
+void GraphTheoryBenchmarks::nodeIncidentEdges_data()
+{
+    addSizeRows(3, 6);
+}
+
+void GraphTheoryBenchmarks::nodeIncidentEdges()
+{
+    QFETCH(int, size);
+    GraphDocumentPtr document = createGraph(size, 4);
+    const NodeList nodes = document->nodes();
+    int degrees = 0;
+    QBENCHMARK {
+        degrees = 0;
+        foreach (NodePtr node, nodes) {
+            degrees += node->inEdges().count() + node->outEdges().count();
+        }
+    }
+    QVERIFY(degrees > 0);
+    document->destroy();
+}
+
+void GraphTheoryBenchmarks::documentNodesByType_data()
+{
+    addSizeRows(3, 6);
+}
+
+void GraphTheoryBenchmarks::documentNodesByType()
+{
+    QFETCH(int, size);
+    GraphDocumentPtr document = createGraph(size, 0);
+    NodeTypePtr type = NodeType::create(document);
+    const NodeList nodes = document->nodes();
+    for (int i = 0; i < nodes.count(); i += 2) {
+        nodes.at(i)->setType(type);
+    }
+    QBENCHMARK {
+        document->nodes(type);
+    }
+    document->destroy();
+}
+
+void GraphTheoryBenchmarks::wrapperNodeById_data()
+{
+    addSizeRows(3, 6);
+}
+
+void GraphTheoryBenchmarks::wrapperNodeById()
+{
+    QFETCH(int, size);
+    GraphDocumentPtr document = createGraph(size, 0);
+    QScriptEngine engine;
+    DocumentWrapper wrapper(document, &engine);
+    const NodeList nodes = document->nodes();
+    const int step = qMax(1, size / 1000);
+    QBENCHMARK {
+        for (int i = 0; i < size; i += step) {
+            wrapper.node(nodes.at(i)->id());
+        }
+    }
+    document->destroy();
+}
+
+void GraphTheoryBenchmarks::wrapperDistance_data()
+{
+    addSizeRows(3, 5);
+}
+
+void GraphTheoryBenchmarks::wrapperDistance()
+{
+    QFETCH(int, size);
+    GraphDocumentPtr document = createGraph(size, 4);
+    QScriptEngine engine;
+    DocumentWrapper wrapper(document, &engine);
+    const NodeList nodes = document->nodes();
+    QList<NodeWrapper*> targets;
+    for (int i = 0; i < size; i += qMax(1, size / 10)) {
+        targets.append(wrapper.nodeWrapper(nodes.at(i)));
+    }
+    // measure a single query: repeated queries at the same revision use the cached
+    // all-pairs matrix, which is a different operation
+    QBENCHMARK_ONCE {
+        wrapper.nodeWrapper(nodes.first())->distance("weight", targets);
+    }
+    document->destroy();
+}
+
+void GraphTheoryBenchmarks::fileFormatData()
+{
+    QTest::addColumn<int>("backend");
+    QTest::addColumn<int>("size");
+    const QList<FileFormatInterface*> backends = m_manager.backends();
+    for (int i = 0; i < backends.count(); ++i) {
+        if (backends.at(i)->pluginCapability() != FileFormatInterface::ImportAndExport) {
+            continue;
+        }
+        const QString ext = suffix(backends.at(i));
+        for (int size = 1000; size <= 100000 && size <= maxSize(); size *= 10) {
+            QTest::newRow(QString("%1:%2").arg(ext).arg(size).toLatin1().constData()) << i << size;
+        }
+    }
+}
+
+void GraphTheoryBenchmarks::fileFormatWrite_data()
+{
+    fileFormatData();
+}
+
+void GraphTheoryBenchmarks::fileFormatWrite()
+{
+    QFETCH(int, backend);
+    QFETCH(int, size);
+    FileFormatInterface *plugin = m_manager.backends().at(backend);
+    GraphDocumentPtr document = createGraph(size, 4);
+    plugin->setFile(QUrl::fromLocalFile(m_directory.path() + QString("/write-%1.%2").arg(size).arg(suffix(plugin))));
+    QBENCHMARK {
+        plugin->writeFile(document);
+    }
+    QVERIFY2(!plugin->hasError(), qPrintable(plugin->errorString()));
+    document->destroy();
+}
+
+void GraphTheoryBenchmarks::fileFormatRead_data()
+{
+    fileFormatData();
+}
+
+void GraphTheoryBenchmarks::fileFormatRead()
+{
+    QFETCH(int, backend);
+    QFETCH(int, size);
+    FileFormatInterface *plugin = m_manager.backends().at(backend);
+    const QUrl file = QUrl::fromLocalFile(m_directory.path() + QString("/read-%1.%2").arg(size).arg(suffix(plugin)));
+    {
+        GraphDocumentPtr document = createGraph(size, 4);
+        plugin->setFile(file);
+        plugin->writeFile(document);
+        document->destroy();
+        QVERIFY2(!plugin->hasError(), qPrintable(plugin->errorString()));
+    }
+    QBENCHMARK {
+        plugin->setFile(file);
+        plugin->readFile();
+        QVERIFY2(!plugin->hasError(), qPrintable(plugin->errorString()));
+        plugin->graphDocument()->destroy();
+    }
+}
+
+void GraphTheoryBenchmarks::topologyLayout_data()
+{
+    QTest::addColumn<QString>("layout");
+    QTest::addColumn<int>("size");
+    const QStringList layouts = QStringList() << "circle" << "layered" << "directed" << "undirected";
+    foreach (const QString &layout, layouts) {
+        for (int size = 100; size <= 1000 && size <= maxSize(); size *= 10) {
+            QTest::newRow(QString("%1:%2").arg(layout).arg(size).toLatin1().constData()) << layout << size;
+        }
+    }
+}
+
+void GraphTheoryBenchmarks::topologyLayout()
+{
+    QFETCH(QString, layout);
+    QFETCH(int, size);
+    GraphDocumentPtr document = createGraph(size, 2);
+    Topology topology;
+    QBENCHMARK {
+        if (layout == "circle") {
+            topology.applyCircleAlignment(document->nodes());
+        } else if (layout == "layered") {
+            topology.applyLayeredAlignment(document->nodes());
+        } else if (layout == "directed") {
+            topology.directedGraphDefaultTopology(document);
+        } else {
+            topology.undirectedGraphDefaultTopology(document);
+        }
+    }
+    document->destroy();
+}
+
+void GraphTheoryBenchmarks::randomGraphGeneration_data()
+{
+    QTest::addColumn<QString>("model");
+    QTest::addColumn<int>("size");
+    const QStringList models = QStringList() << "gnp" << "gnm" << "barabasialbert"
+        << "wattsstrogatz" << "geometric" << "rmat";
+    foreach (const QString &model, models) {
+        for (int size = 10000; size <= 1000000 && size <= maxSize(); size *= 10) {
+            QTest::newRow(QString("%1:%2").arg(model).arg(size).toLatin1().constData()) << model << size;
+        }
+    }
+}
+
+void GraphTheoryBenchmarks::randomGraphGeneration()
+{
+    // all models generate about size edges on size / 4 nodes
+    QFETCH(QString, model);
+    QFETCH(int, size);
+    const int nodes = size / 4;
+    const RandomGraphGenerator generator(42);
+    RandomGraphGenerator::EdgeVector edges;
+    QBENCHMARK {
+        if (model == "gnp") {
+            edges = generator.gnp(nodes, 8.0 / nodes);
+        } else if (model == "gnm") {
+            edges = generator.gnm(nodes, size);
+        } else if (model == "barabasialbert") {
+            edges = generator.barabasiAlbert(nodes, 4);
+        } else if (model == "wattsstrogatz") {
+            edges = generator.wattsStrogatz(nodes, 8, 0.1);
+        } else if (model == "geometric") {
+            edges = generator.randomGeometric(nodes, qSqrt(8 / (M_PI * nodes)));
+        } else {
+            edges = generator.rmat(qCeil(qLn(nodes) / M_LN2), size);
+        }
+    }
+    QVERIFY(!edges.isEmpty());
+}
+
+void GraphTheoryBenchmarks::bulkGraphCreation_data()
+{
+    addSizeRows(3, 6);
+}
+
+void GraphTheoryBenchmarks::bulkGraphCreation()
+{
+    // G(n,m) graph with size edges on size / 4 nodes
+    QFETCH(int, size);
+    const RandomGraphGenerator generator(42);
+    const RandomGraphGenerator::EdgeVector edges = generator.gnm(size / 4, size);
+    const QVector<QPointF> positions(size / 4);
+    QBENCHMARK {
+        GraphDocumentPtr document = GraphDocument::create();
+        Edge::create(Node::create(document, positions), edges);
+        document->destroy();
+    }
+}
+
+void GraphTheoryBenchmarks::compactGraphCreation_data()
+{
+    addSizeRows(3, 6);
+}
+
+void GraphTheoryBenchmarks::compactGraphCreation()
+{
+    // like bulkGraphCreation, but without node and edge objects; the snapshot stands for an
+    // algorithm processing the document
+    QFETCH(int, size);
+    const RandomGraphGenerator generator(42);
+    const RandomGraphGenerator::EdgeVector edges = generator.gnm(size / 4, size);
+    const QVector<QPointF> positions(size / 4);
+    QBENCHMARK {
+        GraphDocumentPtr document = GraphDocument::create(GraphDocument::CompactStorage);
+        document->createNodes(positions);
+        document->createEdges(edges);
+        const GraphSnapshot snapshot(document);
+        QCOMPARE(snapshot.edgeCount(), edges.size());
+        document->destroy();
+    }
+}
+
+void GraphTheoryBenchmarks::randomValueAssignment_data()
+{
+    addSizeRows(3, 6);
+}
+
+void GraphTheoryBenchmarks::randomValueAssignment()
+{
+    // random weights for size edges on a cycle
+    QFETCH(int, size);
+    GraphDocumentPtr document = GraphDocument::create();
+    RandomGraphGenerator::EdgeVector pairs(size);
+    for (int i = 0; i < size; ++i) {
+        pairs[i] = qMakePair(i, (i + 1) % size);
+    }
+    const EdgeList edges = Edge::create(Node::create(document, QVector<QPointF>(size)), pairs);
+    document->edgeTypes().first()->addDynamicProperty("weight");
+    ValueAssign modifier;
+    QBENCHMARK {
+        modifier.assignRandomReals(edges, "weight", 0, 1, 42);
+    }
+    document->destroy();
+}
+
+void GraphTheoryBenchmarks::nodeModelInsertion_data()
+{
+    addSizeRows(3, 5);
+}
+
+void GraphTheoryBenchmarks::nodeModelInsertion()
+{
+    QFETCH(int, size);
+    NodeModel model;
+    QBENCHMARK {
+        GraphDocumentPtr document = GraphDocument::create();
+        model.setDocument(document);
+        {
+            BatchGuard batch(document);
+            for (int i = 0; i < size; ++i) {
+                Node::create(document);
+            }
+        }
+        model.setDocument(GraphDocumentPtr());
+        document->destroy();
+    }
+}
+
+void GraphTheoryBenchmarks::nodeModelPositionUpdates_data()
+{
+    addSizeRows(3, 5);
+}
+
+void GraphTheoryBenchmarks::nodeModelPositionUpdates()
+{
+    QFETCH(int, size);
+    GraphDocumentPtr document = createGraph(size, 0);
+    NodeModel model;
+    model.setDocument(document);
+    int changes = 0;
+    connect(&model, &NodeModel::dataChanged, [&changes]() { ++changes; });
+    const NodeList nodes = document->nodes();
+    QBENCHMARK {
+        foreach (NodePtr node, nodes) {
+            node->setX(node->x() + 1);
+        }
+    }
+    QVERIFY(changes > 0);
+    model.setDocument(GraphDocumentPtr());
+    document->destroy();
+}
+
+void GraphTheoryBenchmarks::nodeModelBatchedPositionUpdates_data()
+{
+    addSizeRows(3, 5);
+}
+
+void GraphTheoryBenchmarks::nodeModelBatchedPositionUpdates()
+{
+    QFETCH(int, size);
+    GraphDocumentPtr document = createGraph(size, 0);
+    NodeModel model;
+    model.setDocument(document);
+    int changes = 0;
+    connect(&model, &NodeModel::dataChanged, [&changes]() { ++changes; });
+    const NodeList nodes = document->nodes();
+    int iterations = 0;
+    QBENCHMARK {
+        BatchGuard batch(document);
+        foreach (NodePtr node, nodes) {
+            node->setPosition(node->position() + QPointF(1, 1));
+        }
+        ++iterations;
+    }
+    // one notification per batch
+    QCOMPARE(changes, iterations);
+    model.setDocument(GraphDocumentPtr());
+    document->destroy();
+}
+
+/**
+ * Runs the benchmarks like QTEST_MAIN. The additional option "-json <file>" writes
+ * the QBENCHMARK results as JSON report, see writeBenchmarkReport().
+ */
+int main(int argc, char *argv[])
+{
+    QApplication app(argc, argv);
+    app.setAttribute(Qt::AA_Use96Dpi, true);
+
+    QStringList arguments = app.arguments();
+    QString jsonFile;
+    const int jsonOption = arguments.indexOf("-json");
+    if (jsonOption != -1 && jsonOption + 1 < arguments.count()) {
+        jsonFile = arguments.at(jsonOption + 1);
+        arguments.removeAt(jsonOption + 1);
+        arguments.removeAt(jsonOption);
+    }
+
+    GraphTheoryBenchmarks benchmarks;
+    if (jsonFile.isEmpty()) {
+        return QTest::qExec(&benchmarks, arguments);
+    }
+
+    // keep human readable output on stdout and write the XML log for the report
+    QTemporaryDir logDirectory;
+    const QString xmlLogFile = QDir(logDirectory.path()).filePath("benchmarks.xml");
+    arguments << "-o" << "-,txt" << "-o" << xmlLogFile + ",xml";
+    const int result = QTest::qExec(&benchmarks, arguments);
+    if (!writeBenchmarkReport(xmlLogFile, jsonFile)) {
+        return result == 0 ? 1 : result;
+    }
+    return result;
+}
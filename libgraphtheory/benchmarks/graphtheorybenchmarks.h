@@ -0,0 +1,83 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GRAPHTHEORYBENCHMARKS_H
+#define GRAPHTHEORYBENCHMARKS_H
+
+#include "fileformats/fileformatmanager.h"
+#include <QObject>
+#include <QTemporaryDir>
+
+using namespace GraphTheory;
+
+/**
+ * \class GraphTheoryBenchmarks
+ * QBENCHMARK based measurements of the libgraphtheory core operations. Data driven
+ * functions use the number of nodes as data tag. The largest generated graph is
+ * limited by the environment variable GRAPHTHEORY_BENCHMARK_MAX_EXPONENT (default 6,
+ * i.e. 10^6 nodes).
+ */
+class GraphTheoryBenchmarks : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase();
+    void cleanupTestCase();
+    void nodeCreateDestroy_data();
+    void nodeCreateDestroy();
+    void edgeCreateDestroy_data();
+    void edgeCreateDestroy();
+    void nodeIncidentEdges_data();
+    void nodeIncidentEdges();
+    void documentNodesByType_data();
+    void documentNodesByType();
+    void wrapperNodeById_data();
+    void wrapperNodeById();
+    void wrapperDistance_data();
+    void wrapperDistance();
+    void fileFormatWrite_data();
+    void fileFormatWrite();
+    void fileFormatRead_data();
+    void fileFormatRead();
+    void topologyLayout_data();
+    void topologyLayout();
+    void randomGraphGeneration_data();
+    void randomGraphGeneration();
+    void bulkGraphCreation_data();
+    void bulkGraphCreation();
+    void compactGraphCreation_data();
+    void compactGraphCreation();
+    void randomValueAssignment_data();
+    void randomValueAssignment();
+    void nodeModelInsertion_data();
+    void nodeModelInsertion();
+    void nodeModelPositionUpdates_data();
+    void nodeModelPositionUpdates();
+    void nodeModelBatchedPositionUpdates_data();
+    void nodeModelBatchedPositionUpdates();
+
+private:
+    void fileFormatData();
+    FileFormatManager m_manager;
+    QTemporaryDir m_directory;
+};
+
+#endif
@@ -20,6 +20,7 @@
 
 #include "edge.h"
 #include "edgetypestyle.h"
+#include "propertytable.h"
 #include "logging_p.h"
 #include <QVariant>
 
@@ -32,6 +33,8 @@ class GraphTheory::EdgePrivate {
 public:
     EdgePrivate()
         : m_valid(false)
+        , m_documentIndex(-1)
+        , m_propertyRow(-1)
     {
     }
 
@@ -44,6 +47,8 @@ public:
     NodePtr m_to;
     EdgeTypePtr m_type;
     bool m_valid;
+    int m_documentIndex;
+    int m_propertyRow;
 };
 
 Edge::Edge()
@@ -55,10 +60,13 @@ Edge::Edge()
 
 Edge::~Edge()
 {
+    if (d->m_type) {
+        d->m_type->propertyTable()->releaseRow(d->m_propertyRow);
+    }
     --Edge::objectCounter;
 }
 
-EdgePtr Edge::create(NodePtr from, NodePtr to)
+EdgePtr Edge::create(NodePtr from, NodePtr to, EdgeTypePtr type)
 {
     Q_ASSERT(from);
     Q_ASSERT(to);
@@ -67,17 +75,55 @@ EdgePtr Edge::create(NodePtr from, NodePtr to)
     pi->setQpointer(pi);
     pi->d->m_from = from;
     pi->d->m_to = to;
-    pi->setType(from->document()->edgeTypes().first());
+    pi->setType(type ? type : from->document()->edgeTypes().first());
 
-    // insert completely initialized edge into nodes' connections
-    to->insert(pi->d->q);
-    from->insert(pi->d->q);
+    // insert completely initialized edge into nodes' connections, the new edge cannot be
+    // contained yet
+    to->attach(pi->d->q);
+    if (from != to) {
+        from->attach(pi->d->q);
+    }
     to->document()->insert(pi->d->q);
     pi->d->m_valid = true;
 
     return pi;
 }
 
+EdgeList Edge::create(const NodeList &nodes, const QVector<QPair<int, int>> &pairs, EdgeTypePtr type)
+{
+    EdgeList edges;
+    if (pairs.isEmpty()) {
+        return edges;
+    }
+    GraphDocumentPtr document = nodes.first()->document();
+    if (!type) {
+        type = document->edgeTypes().first();
+    }
+    edges.reserve(pairs.size());
+    BatchGuard batch(document);
+    foreach (const auto &pair, pairs) {
+        edges.append(create(nodes.at(pair.first), nodes.at(pair.second), type));
+    }
+    return edges;
+}
+
+EdgePtr Edge::createObject(NodePtr from, NodePtr to, EdgeTypePtr type, int propertyRow)
+{
+    EdgePtr pi(new Edge);
+    pi->setQpointer(pi);
+    pi->d->m_from = from;
+    pi->d->m_to = to;
+    pi->d->m_type = type;
+    pi->d->m_propertyRow = propertyRow;
+    pi->connectType();
+    to->attach(pi->d->q);
+    if (from != to) {
+        from->attach(pi->d->q);
+    }
+    pi->d->m_valid = true;
+    return pi;
+}
+
 EdgePtr Edge::self() const
 {
     return d->q;
@@ -85,6 +131,8 @@ EdgePtr Edge::self() const
 
 void Edge::destroy()
 {
+    // removal renumbers the elements of the document, which needs all objects
+    d->m_to->document()->createObjects();
     d->m_valid = false;
     d->m_from->remove(d->q);
     d->m_to->remove(d->q);
@@ -109,6 +157,16 @@ NodePtr Edge::to() const
     return d->m_to;
 }
 
+Node * Edge::fromNode() const
+{
+    return d->m_from.data();
+}
+
+Node * Edge::toNode() const
+{
+    return d->m_to.data();
+}
+
 EdgeTypePtr Edge::type() const
 {
     Q_ASSERT(d->m_type);
@@ -121,35 +179,68 @@ void Edge::setType(EdgeTypePtr type)
     if (d->m_type == type) {
         return;
     }
+    // move values to the property table of the new type, including values of properties
+    // that are not registered at the new type
+    PropertyTable *properties = type->propertyTable();
+    const int row = properties->allocateRow();
     if (d->m_type) {
         d->m_type->disconnect(this);
         d->m_type->style()->disconnect(this);
+        PropertyTable *oldProperties = d->m_type->propertyTable();
+        foreach (const QString &property, oldProperties->columnNames()) {
+            const int column = oldProperties->column(property);
+            if (oldProperties->hasValue(column, d->m_propertyRow)) {
+                properties->setValue(properties->addColumn(property), row, oldProperties->value(column, d->m_propertyRow));
+            }
+        }
+        oldProperties->releaseRow(d->m_propertyRow);
     }
     d->m_type = type;
-    connect(type.data(), &EdgeType::dynamicPropertyAboutToBeAdded,
+    d->m_propertyRow = row;
+    d->m_from->document()->updateRevision();
+    connectType();
+
+    emit typeChanged(type);
+    emit styleChanged();
+}
+
+void Edge::connectType()
+{
+    EdgeType *type = d->m_type.data();
+    connect(type, &EdgeType::dynamicPropertyAboutToBeAdded,
         this, &Edge::dynamicPropertyAboutToBeAdded);
-    connect(type.data(), &EdgeType::dynamicPropertyAdded,
+    connect(type, &EdgeType::dynamicPropertyAdded,
         this, &Edge::dynamicPropertyAdded);
-    connect(type.data(), &EdgeType::dynamicPropertiesAboutToBeRemoved,
+    connect(type, &EdgeType::dynamicPropertiesAboutToBeRemoved,
         this, &Edge::dynamicPropertiesAboutToBeRemoved);
-    connect(type.data(), &EdgeType::dynamicPropertyRemoved,
+    connect(type, &EdgeType::dynamicPropertyRemoved,
         this, &Edge::dynamicPropertyRemoved);
-    connect(type.data(), &EdgeType::dynamicPropertyRemoved,
+    connect(type, &EdgeType::dynamicPropertyRemoved,
         this, &Edge::updateDynamicProperty);
-    connect(type.data(), &EdgeType::directionChanged,
+    connect(type, &EdgeType::directionChanged,
         this, &Edge::directionChanged);
-    connect(type.data(), &EdgeType::dynamicPropertyRenamed,
+    connect(type, &EdgeType::dynamicPropertyRenamed,
         this, &Edge::renameDynamicProperty);
     connect(type->style(), &EdgeTypeStyle::changed,
         this, &Edge::styleChanged);
-
-    emit typeChanged(type);
-    emit styleChanged();
 }
 
 QVariant Edge::dynamicProperty(const QString &property) const
 {
-    return Edge::property(("_graph_" + property).toLatin1());
+    if (!d->m_type) {
+        return QVariant();
+    }
+    const PropertyTable *properties = d->m_type->propertyTable();
+    return properties->value(properties->column(property), d->m_propertyRow);
+}
+
+QVariant Edge::dynamicProperty(const PropertyKey &key) const
+{
+    if (!d->m_type) {
+        return QVariant();
+    }
+    const PropertyTable *properties = d->m_type->propertyTable();
+    return properties->value(properties->column(key), d->m_propertyRow);
 }
 
 QStringList Edge::dynamicProperties() const
@@ -161,12 +252,37 @@ void Edge::setDynamicProperty(const QString &property, const QVariant &value)
 {
     if (!d->m_type) {
         qCWarning(GRAPHTHEORY_GENERAL) << "No type registered, aborting to set property.";
+        return;
     }
-    if (value.isValid() && !d->m_type->dynamicProperties().contains(property)) {
+    PropertyTable *properties = d->m_type->propertyTable();
+    setDynamicPropertyValue(value.isValid() ? properties->addColumn(property) : properties->column(property), value);
+}
+
+void Edge::setDynamicProperty(const PropertyKey &key, const QVariant &value)
+{
+    if (!d->m_type) {
+        qCWarning(GRAPHTHEORY_GENERAL) << "No type registered, aborting to set property.";
+        return;
+    }
+    PropertyTable *properties = d->m_type->propertyTable();
+    int column = properties->column(key);
+    if (column < 0 && value.isValid() && key.isValid()) {
+        column = properties->addColumn(key.name());
+    }
+    setDynamicPropertyValue(column, value);
+}
+
+void Edge::setDynamicPropertyValue(int column, const QVariant &value)
+{
+    const int index = d->m_type->dynamicPropertyIndex(column);
+    if (value.isValid() && index < 0) {
         qCWarning(GRAPHTHEORY_GENERAL) << "Dynamic property not registered at type, aborting to set property.";
     }
-    setProperty(("_graph_" + property).toLatin1(), value);
-    emit dynamicPropertyChanged(d->m_type->dynamicProperties().indexOf(property));
+    if (column >= 0) {
+        d->m_type->propertyTable()->setValue(column, d->m_propertyRow, value);
+    }
+    d->m_from->document()->updateRevision();
+    emit dynamicPropertyChanged(index);
 }
 
 void Edge::updateDynamicProperty(const QString &property)
@@ -181,12 +297,27 @@ void Edge::updateDynamicProperty(const QString &property)
 
 void Edge::renameDynamicProperty(const QString &oldProperty, const QString &newProperty)
 {
-    setDynamicProperty(newProperty, dynamicProperty(oldProperty));
-    setDynamicProperty(oldProperty, QVariant::Invalid);
+    // values are already moved by the property table of the type
+    Q_UNUSED(oldProperty);
     emit dynamicPropertyChanged(d->m_type->dynamicProperties().indexOf(newProperty));
 }
 
+int Edge::propertyRow() const
+{
+    return d->m_propertyRow;
+}
+
 void Edge::setQpointer(EdgePtr q)
 {
     d->q = q;
 }
+
+int Edge::documentIndex() const
+{
+    return d->m_documentIndex;
+}
+
+void Edge::setDocumentIndex(int index)
+{
+    d->m_documentIndex = index;
+}
@@ -33,6 +33,7 @@ namespace GraphTheory
 {
 
 class EdgePrivate;
+class PropertyKey;
 
 /**
  * \class Edge
@@ -41,6 +42,8 @@ class GRAPHTHEORY_EXPORT Edge : public QObject
 {
     Q_OBJECT
     Q_PROPERTY(QStringList dynamicProperties READ dynamicProperties NOTIFY dynamicPropertiesChanged)
+    Q_PROPERTY(GraphTheory::Node * fromNode READ fromNode CONSTANT)
+    Q_PROPERTY(GraphTheory::Node * toNode READ toNode CONSTANT)
 
 public:
     /**
@@ -49,9 +52,24 @@ public:
      *
      * @param from  the Node this edge points from
      * @param to    the Node this edge points to
+     * @param type  the EdgeType of the edge, the default edge type if not set
      * @return a Edge object
      */
-    static EdgePtr create(NodePtr from, NodePtr to);
+    static EdgePtr create(NodePtr from, NodePtr to, EdgeTypePtr type = EdgeTypePtr());
+
+    /**
+     * Creates one new Edge for each of the given pairs of indices into @p nodes, pointing from the
+     * first to the second node. All edges are inserted in one batch of the document of the nodes,
+     * i.e., they are announced by a single GraphDocument::edgesAboutToBeAdded(). Use this method
+     * to construct large graphs, e.g., from the edge lists of RandomGraphGenerator.
+     *
+     * @param nodes  the nodes that are connected, all of the same document
+     * @param pairs  indices of the start and end node of each edge
+     * @param type  the EdgeType of the edges, the default edge type if not set
+     * @return the created edges, ordered like @p pairs
+     */
+    static EdgeList create(const NodeList &nodes, const QVector<QPair<int, int>> &pairs,
+                           EdgeTypePtr type = EdgeTypePtr());
 
     /** Destroys the edge */
     virtual ~Edge();
@@ -84,6 +102,16 @@ public:
      */
     NodePtr to() const;
 
+    /**
+     * @return raw pointer to from() for use in QML
+     */
+    Node * fromNode() const;
+
+    /**
+     * @return raw pointer to to() for use in QML
+     */
+    Node * toNode() const;
+
     /**
      * Return the EdgeType of the edge. This value is always valid.
      *
@@ -105,6 +133,11 @@ public:
      */
     QVariant dynamicProperty(const QString &property) const;
 
+    /**
+     * Overload of dynamicProperty() that accesses the property by a key of the edge type.
+     */
+    QVariant dynamicProperty(const PropertyKey &key) const;
+
     /**
      * @return list of dynamic properties registered at edge type
      */
@@ -112,8 +145,8 @@ public:
 
     /**
      * Set dynamic property with identifier @c property. If @c value is
-     * QVariant::Invalid, the dynamic property is unset. Internally, this
-     * method use the QObject::setProperty mechanism but prefixes properties to avoid name clashes.
+     * QVariant::Invalid, the dynamic property is unset. The value is stored in the
+     * property table of the edge type.
      *
      * @param property is the identifier for the new property
      * @param value is the value of this property
@@ -121,13 +154,33 @@ public:
     void setDynamicProperty(const QString &property, const QVariant &value);
 
     /**
-     * Rename dynamic property from identifier @c oldProperty to @c newProperty.
+     * Overload of setDynamicProperty() that accesses the property by a key of the edge type,
+     * which avoids looking up the property by name.
+     */
+    void setDynamicProperty(const PropertyKey &key, const QVariant &value);
+
+    /**
+     * Notify about renaming of dynamic property @c oldProperty to @c newProperty at the type.
+     * The values are moved by the property table of the type.
      *
      * @param oldProperty the former value of the property
      * @param newProperty the new value of the property
      */
     void renameDynamicProperty(const QString &oldProperty, const QString &newProperty);
 
+    /**
+     * @return row of this edge in the property table of its type, see EdgeType::propertyTable()
+     */
+    int propertyRow() const;
+
+    /**
+     * The document index is the position of the edge in GraphDocument::edges(). It changes
+     * when other edges are removed from the document.
+     *
+     * @return position of the edge in the list of edges of its document, -1 if not registered
+     */
+    int documentIndex() const;
+
     /**
      * Debug method that tracks how many node objects exist.
      *
@@ -164,6 +217,27 @@ private:
     Q_DISABLE_COPY(Edge)
     const QScopedPointer<EdgePrivate> d;
     void setQpointer(EdgePtr q);
+    /**
+     * Store @p value in @p column of the property table of the type, -1 if no column exists.
+     */
+    void setDynamicPropertyValue(int column, const QVariant &value);
+    /**
+     * Set position of the edge in the list of edges of its document to @p index.
+     * Only GraphDocument maintains this value.
+     */
+    void setDocumentIndex(int index);
+    /**
+     * Create the object of an edge of a document in compact storage. The edge takes over the
+     * row @p propertyRow of the property table of @p type and is attached to its end points,
+     * but not inserted into the document. Only GraphDocument uses this method.
+     */
+    static EdgePtr createObject(NodePtr from, NodePtr to, EdgeTypePtr type, int propertyRow);
+    /**
+     * Connect to the signals of the current type and its style.
+     */
+    void connectType();
+    friend class GraphDocument;
+    friend class GraphDocumentPrivate;
     static uint objectCounter;
 };
 }
@@ -0,0 +1,92 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "edgehandle.h"
+#include "graphdocument.h"
+#include "edge.h"
+#include "edgetype.h"
+#include "propertytable.h"
+#include "elementpool_p.h"
+
+using namespace GraphTheory;
+
+NodeHandle EdgeHandle::from() const
+{
+    if (const EdgePool *pool = m_document->edgePool(m_index)) {
+        return NodeHandle(m_document, pool->from.at(m_index));
+    }
+    return NodeHandle(m_document, m_document->edgeObject(m_index)->fromNode()->documentIndex());
+}
+
+NodeHandle EdgeHandle::to() const
+{
+    if (const EdgePool *pool = m_document->edgePool(m_index)) {
+        return NodeHandle(m_document, pool->to.at(m_index));
+    }
+    return NodeHandle(m_document, m_document->edgeObject(m_index)->toNode()->documentIndex());
+}
+
+EdgeTypePtr EdgeHandle::type() const
+{
+    if (const EdgePool *pool = m_document->edgePool(m_index)) {
+        return pool->types.at(m_index)->self();
+    }
+    return m_document->edgeObject(m_index)->type();
+}
+
+int EdgeHandle::propertyRow() const
+{
+    if (const EdgePool *pool = m_document->edgePool(m_index)) {
+        return pool->propertyRows.at(m_index);
+    }
+    return m_document->edgeObject(m_index)->propertyRow();
+}
+
+QVariant EdgeHandle::dynamicProperty(const PropertyKey &key) const
+{
+    if (const EdgePool *pool = m_document->edgePool(m_index)) {
+        const PropertyTable *properties = pool->types.at(m_index)->propertyTable();
+        return properties->value(properties->column(key), pool->propertyRows.at(m_index));
+    }
+    return m_document->edgeObject(m_index)->dynamicProperty(key);
+}
+
+void EdgeHandle::setDynamicProperty(const PropertyKey &key, const QVariant &value)
+{
+    if (EdgePool *pool = m_document->edgePool(m_index)) {
+        PropertyTable *properties = pool->types.at(m_index)->propertyTable();
+        int column = properties->column(key);
+        if (column < 0 && value.isValid() && key.isValid()) {
+            column = properties->addColumn(key.name());
+        }
+        if (column >= 0) {
+            properties->setValue(column, pool->propertyRows.at(m_index), value);
+        }
+        // like Edge, value changes invalidate derived data as edge weights
+        m_document->updateRevision();
+        return;
+    }
+    m_document->edgeObject(m_index)->setDynamicProperty(key, value);
+}
+
+EdgePtr EdgeHandle::edge() const
+{
+    return m_document->edgeObject(m_index);
+}
@@ -0,0 +1,113 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EDGEHANDLE_H
+#define EDGEHANDLE_H
+
+#include "graphtheory_export.h"
+#include "typenames.h"
+#include "nodehandle.h"
+
+#include <QVariant>
+
+namespace GraphTheory
+{
+class PropertyKey;
+
+/**
+ * \class EdgeHandle
+ * Lightweight reference to an edge of a GraphDocument by its position in
+ * GraphDocument::edges().
+ *
+ * Like NodeHandle, edge handles access edges in both storage modes of the document without
+ * creating Edge objects and are only valid until edges are removed from the document.
+ */
+class GRAPHTHEORY_EXPORT EdgeHandle
+{
+public:
+    /**
+     * Creates an invalid handle.
+     */
+    EdgeHandle()
+        : m_document(nullptr)
+        , m_index(-1)
+    {
+    }
+
+    /**
+     * @return @c true if the handle refers to an edge
+     */
+    bool isValid() const
+    {
+        return m_document != nullptr && m_index >= 0;
+    }
+
+    /**
+     * @return position of the edge in GraphDocument::edges()
+     */
+    int index() const
+    {
+        return m_index;
+    }
+
+    NodeHandle from() const;
+    NodeHandle to() const;
+    EdgeTypePtr type() const;
+
+    /**
+     * @return row of the edge in the property table of its type
+     */
+    int propertyRow() const;
+
+    QVariant dynamicProperty(const PropertyKey &key) const;
+    void setDynamicProperty(const PropertyKey &key, const QVariant &value);
+
+    /**
+     * Return the Edge object of this edge. For a document in compact storage, this creates the
+     * objects of this edge and of its end points only.
+     *
+     * @return the edge object
+     */
+    EdgePtr edge() const;
+
+    bool operator==(const EdgeHandle &other) const
+    {
+        return m_document == other.m_document && m_index == other.m_index;
+    }
+
+    bool operator!=(const EdgeHandle &other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    friend class GraphDocument;
+    EdgeHandle(GraphDocument *document, int index)
+        : m_document(document)
+        , m_index(index)
+    {
+    }
+
+    GraphDocument *m_document;
+    int m_index;
+};
+}
+
+#endif
@@ -20,6 +20,7 @@
 
 #include "edgetype.h"
 #include "edgetypestyle.h"
+#include "propertytable.h"
 #include "graphdocument.h"
 #include <QDebug>
 
@@ -45,10 +46,20 @@ public:
         m_style->deleteLater();
     }
 
+    void updatePropertyIndices()
+    {
+        m_propertyIndices.fill(-1, m_properties.columnCount());
+        for (int i = 0; i < m_dynamicProperties.count(); ++i) {
+            m_propertyIndices[m_properties.column(m_dynamicProperties.at(i))] = i;
+        }
+    }
+
     EdgeTypePtr q;
     GraphDocumentPtr m_document;
     int m_id;
     QStringList m_dynamicProperties;
+    PropertyTable m_properties;
+    QVector<int> m_propertyIndices; //!< positions in m_dynamicProperties by column
     EdgeTypeStyle *m_style;
     EdgeType::Direction m_direction;
     QString m_name;
@@ -137,19 +148,50 @@ EdgeTypeStyle * EdgeType::style() const
     return d->m_style;
 }
 
+PropertyTable * EdgeType::propertyTable() const
+{
+    return &d->m_properties;
+}
+
+void EdgeType::notifyDynamicPropertyValuesChanged(const PropertyKey &key)
+{
+    emit dynamicPropertyValuesChanged(dynamicPropertyIndex(d->m_properties.column(key)));
+}
+
 QStringList EdgeType::dynamicProperties() const
 {
     return d->m_dynamicProperties;
 }
 
-void EdgeType::addDynamicProperty(const QString& property)
+PropertyKey EdgeType::addDynamicProperty(const QString& property)
 {
-    if (d->m_dynamicProperties.contains(property)) {
-        return;
+    const int column = d->m_properties.column(property);
+    if (dynamicPropertyIndex(column) >= 0) {
+        return d->m_properties.key(column);
     }
     emit dynamicPropertyAboutToBeAdded(property, d->m_dynamicProperties.count());
     d->m_dynamicProperties.append(property);
+    d->m_properties.addColumn(property);
+    d->updatePropertyIndices();
     emit dynamicPropertyAdded();
+    return d->m_properties.key(d->m_properties.column(property));
+}
+
+PropertyKey EdgeType::dynamicPropertyKey(const QString &property) const
+{
+    const int column = d->m_properties.column(property);
+    if (dynamicPropertyIndex(column) < 0) {
+        return PropertyKey();
+    }
+    return d->m_properties.key(column);
+}
+
+int EdgeType::dynamicPropertyIndex(int column) const
+{
+    if (column < 0 || column >= d->m_propertyIndices.size()) {
+        return -1;
+    }
+    return d->m_propertyIndices.at(column);
 }
 
 void EdgeType::removeDynamicProperty(const QString& property)
@@ -160,6 +202,8 @@ void EdgeType::removeDynamicProperty(const QString& property)
     int index = d->m_dynamicProperties.indexOf(property);
     emit dynamicPropertiesAboutToBeRemoved(index, index);
     d->m_dynamicProperties.removeOne(property);
+    d->m_properties.removeColumn(property);
+    d->updatePropertyIndices();
     emit dynamicPropertyRemoved(property);
 }
 
@@ -173,6 +217,7 @@ void EdgeType::renameDynamicProperty(const QString& oldProperty, const QString&
     }
     int index = d->m_dynamicProperties.indexOf(oldProperty);
     d->m_dynamicProperties[index] = newProperty;
+    d->m_properties.renameColumn(oldProperty, newProperty);
     emit dynamicPropertyRenamed(oldProperty, newProperty);
     emit dynamicPropertyChanged(index);
 }
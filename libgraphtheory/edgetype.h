@@ -23,6 +23,7 @@
 
 #include "graphtheory_export.h"
 #include "typenames.h"
+#include "propertykey.h"
 
 #include <QObject>
 #include <QSharedPointer>
@@ -31,6 +32,7 @@ namespace GraphTheory
 {
 
 class EdgeTypePrivate;
+class PropertyTable;
 class EdgeTypeStyle;
 
 /**
@@ -94,8 +96,21 @@ public:
     /**
      * Add dynamic property @c property to list of dynamic properties.
      * Signal dynamicPropertyAdded(@c property) is emitted afterwards
+     *
+     * @return key of the property, also if it was registered before
+     */
+    PropertyKey addDynamicProperty(const QString &property);
+
+    /**
+     * @return key of registered dynamic property @p property, an invalid key if it is not registered
+     */
+    PropertyKey dynamicPropertyKey(const QString &property) const;
+
+    /**
+     * @return position in dynamicProperties() of the property stored in column @p column of
+     *         propertyTable(), -1 if the property is not registered
      */
-    void addDynamicProperty(const QString &property);
+    int dynamicPropertyIndex(int column) const;
 
     /**
      * Remove dynamic property @c property from list of dynamic properties.
@@ -110,6 +125,21 @@ public:
      */
     void renameDynamicProperty(const QString &oldProperty, const QString &newProperty);
 
+    /**
+     * The property table stores the dynamic property values of all edges of this type, each edge
+     * owns the row Edge::propertyRow().
+     *
+     * @return storage of dynamic property values
+     */
+    PropertyTable * propertyTable() const;
+
+    /**
+     * Announce that values of dynamic property @p key were written to propertyTable() directly
+     * for many edges. Signal dynamicPropertyValuesChanged() is emitted once instead of
+     * Edge::dynamicPropertyChanged() at each edge.
+     */
+    void notifyDynamicPropertyValuesChanged(const PropertyKey &key);
+
     /**
      * Set direction for edges of this type. Setting this, emits signal
      * directionChanged(@p direction).
@@ -164,6 +194,8 @@ Q_SIGNALS:
     void dynamicPropertyRemoved(const QString &property);
     void dynamicPropertyRenamed(const QString &oldProperty, const QString &newProperty);
     void dynamicPropertyChanged(int index);
+    /** values of the dynamic property at @p index changed for several edges **/
+    void dynamicPropertyValuesChanged(int index);
     void nameChanged(const QString &name);
 
 protected:
@@ -23,10 +23,9 @@
 #include "graphdocument.h"
 #include "node.h"
 #include "edge.h"
-#include "fileformats/fileformatmanager.h"
+#include "fileformats/documentimporter.h"
 #include "logging_p.h"
 #include <QUrl>
-#include <QFileInfo>
 
 using namespace GraphTheory;
 
@@ -42,7 +41,6 @@ public:
     }
 
     QList<GraphDocumentPtr> m_documents;
-    FileFormatManager m_fileFormatManager;
 };
 
 Editor::Editor()
@@ -69,24 +67,25 @@ GraphDocumentPtr Editor::createDocument()
     return document;
 }
 
-GraphDocumentPtr Editor::openDocument(const QUrl &documentUrl)
+bool Editor::openDocument(const QUrl &documentUrl)
 {
-    // get file extension/format
-    QFileInfo fi(documentUrl.toLocalFile());
-    QString ext = fi.completeSuffix();
-
-    GraphTheory::FileFormatInterface *importer = d->m_fileFormatManager.backendByExtension(ext);
-    if (!importer) {
-        qCCritical(GRAPHTHEORY_GENERAL) << "No graph file backend found for extension" << ext << ", aborting.";
-        return GraphDocumentPtr();
-    }
-    importer->setFile(documentUrl);
-    importer->readFile();
-    if (importer->hasError()) {
-        qCCritical(GRAPHTHEORY_GENERAL) << "Graph file importer reported the following error, aborting.";
-        importer->errorString();
-        return GraphDocumentPtr();
+    // the importer is owned by the editor, such that pending imports are canceled on destruction
+    DocumentImporter *importer = new DocumentImporter(this);
+    if (!importer->start(documentUrl)) {
+        qCCritical(GRAPHTHEORY_GENERAL) << "Graph file import failed, aborting:" << importer->errorString();
+        delete importer;
+        return false;
     }
-    importer->graphDocument()->setDocumentUrl(documentUrl);
-    return importer->graphDocument();
+    connect(importer, &DocumentImporter::finished, this, [this, importer, documentUrl]() {
+        importer->deleteLater();
+        GraphDocumentPtr document = importer->document();
+        if (!document) {
+            qCCritical(GRAPHTHEORY_GENERAL) << "Graph file importer reported the following error, aborting:" << importer->errorString();
+            emit documentOpened(documentUrl, GraphDocumentPtr());
+            return;
+        }
+        document->setDocumentUrl(documentUrl);
+        emit documentOpened(documentUrl, document);
+    });
+    return true;
 }
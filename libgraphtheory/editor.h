@@ -43,14 +43,21 @@ public:
     GraphDocumentPtr createDocument();
 
     /**
-     * Load document from @p documentUrl..
-     * @return the loaded document
+     * Start loading the document from @p documentUrl. The file is read in a worker thread by
+     * a DocumentImporter of its own, such that several documents can be loaded at the same
+     * time. The method returns immediately, documentOpened() is emitted when loading is done.
+     * @return @e true if loading was started, otherwise @e false and documentOpened() is not emitted
      */
-    GraphDocumentPtr openDocument(const QUrl &documentUrl);
+    bool openDocument(const QUrl &documentUrl);
 
 Q_SIGNALS:
     void documentCreated(GraphDocumentPtr document);
 
+    /**
+     * Loading of @p documentUrl by openDocument() finished. On failure @p document is null.
+     */
+    void documentOpened(const QUrl &documentUrl, GraphTheory::GraphDocumentPtr document);
+
 private:
     Q_DISABLE_COPY(Editor)
     const QScopedPointer<EditorPrivate> d;
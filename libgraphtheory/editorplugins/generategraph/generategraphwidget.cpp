@@ -37,33 +37,12 @@
 
 #include <cmath>
 
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/iteration_macros.hpp>
-#include <boost/graph/random.hpp>
-#include <boost/graph/random_layout.hpp>
-#include <boost/graph/topology.hpp>
-#include <boost/graph/fruchterman_reingold.hpp>
 #include <boost/random/mersenne_twister.hpp>
-#include <boost/graph/erdos_renyi_generator.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
 #include <boost/math/constants/constants.hpp>
 
 using namespace GraphTheory;
 
-// typedefs used for the boost graph library
-typedef boost::adjacency_list < boost::listS, boost::vecS, boost::undirectedS,
-        boost::property<boost::vertex_name_t, std::string> >
-        Graph;
-
-typedef boost::rectangle_topology<> topology_type;
-
-typedef topology_type::point_type point_type;
-
-typedef std::vector<point_type> PositionVec;
-
-typedef boost::iterator_property_map < PositionVec::iterator,
-        boost::property_map<Graph, boost::vertex_index_t>::type >
-        PositionMap;
-
 // handle boost exceptions
 namespace boost {
     void throw_exception(std::exception const &e) {
@@ -83,6 +62,10 @@ GenerateGraphWidget::GenerateGraphWidget(GraphDocumentPtr document, QWidget *par
     m_defaultIdentifiers.insert(CircleGraph, "CircleGraph");
     m_defaultIdentifiers.insert(ErdosRenyiRandomGraph, "RandomGraph");
     m_defaultIdentifiers.insert(RandomTree, "RandomTree");
+    m_defaultIdentifiers.insert(ScaleFreeGraph, "ScaleFreeGraph");
+    m_defaultIdentifiers.insert(SmallWorldGraph, "SmallWorldGraph");
+    m_defaultIdentifiers.insert(RandomGeometricGraph, "GeometricGraph");
+    m_defaultIdentifiers.insert(RmatGraph, "RmatGraph");
     m_defaultIdentifiers.insert(MeshGraph, "MeshGraph");
     m_graphGenerator = MeshGraph;
 
@@ -112,6 +95,10 @@ GenerateGraphWidget::GenerateGraphWidget(GraphDocumentPtr document, QWidget *par
     ui->randomGeneratorSeed->setValue(badRandomSeed);
     ui->GNPGeneratorSeed->setValue(badRandomSeed);
     ui->randomTreeGeneratorSeed->setValue(badRandomSeed);
+    ui->scaleFreeGeneratorSeed->setValue(badRandomSeed);
+    ui->smallWorldGeneratorSeed->setValue(badRandomSeed);
+    ui->geometricGeneratorSeed->setValue(badRandomSeed);
+    ui->rmatGeneratorSeed->setValue(badRandomSeed);
 
     // set visibility for advanced options
     // TODO move to containers for easier handling
@@ -121,6 +108,14 @@ GenerateGraphWidget::GenerateGraphWidget(GraphDocumentPtr document, QWidget *par
     ui->GNPGeneratorSeed->setVisible(false);
     ui->label_randomTreeGeneratorSeed->setVisible(false);
     ui->randomTreeGeneratorSeed->setVisible(false);
+    ui->label_scaleFreeGeneratorSeed->setVisible(false);
+    ui->scaleFreeGeneratorSeed->setVisible(false);
+    ui->label_smallWorldGeneratorSeed->setVisible(false);
+    ui->smallWorldGeneratorSeed->setVisible(false);
+    ui->label_geometricGeneratorSeed->setVisible(false);
+    ui->geometricGeneratorSeed->setVisible(false);
+    ui->label_rmatGeneratorSeed->setVisible(false);
+    ui->rmatGeneratorSeed->setVisible(false);
 
     for (int i = 0; i < document->edgeTypes().length(); ++i) {
         EdgeTypePtr type = document->edgeTypes().at(i);
@@ -187,6 +182,8 @@ void GenerateGraphWidget::generateGraph()
 {
     setGraphIdentifier(ui->identifier->text());
 
+    // publish all created nodes and edges at once
+    BatchGuard batch(m_document);
     switch (m_graphGenerator) {
     case MeshGraph:
         generateMesh(ui->meshRows->value(), ui->meshColumns->value());
@@ -202,15 +199,15 @@ void GenerateGraphWidget::generateGraph()
         generateRandomGraph(
             ui->randomNodes->value(),
             ui->randomEdges->value(),
-            ui->randomAllowSelfedges->isTristate()
+            ui->randomAllowSelfedges->isChecked()
         );
         break;
     case ErdosRenyiRandomGraph:
-        setSeed(ui->randomGeneratorSeed->value());
+        setSeed(ui->GNPGeneratorSeed->value());
         generateErdosRenyiRandomGraph(
             ui->GNPNodes->value(),
             ui->GNPEdgeProbability->value(),
-            ui->GNPAllowSelfedges->isTristate()
+            ui->GNPAllowSelfedges->isChecked()
         );
         break;
     case RandomTree:
@@ -218,6 +215,36 @@ void GenerateGraphWidget::generateGraph()
         generateRandomTreeGraph(
             ui->randomTreeNodes->value()
         );
+        break;
+    case ScaleFreeGraph:
+        setSeed(ui->scaleFreeGeneratorSeed->value());
+        generateScaleFreeGraph(
+            ui->scaleFreeNodes->value(),
+            ui->scaleFreeEdgesPerNode->value()
+        );
+        break;
+    case SmallWorldGraph:
+        setSeed(ui->smallWorldGeneratorSeed->value());
+        generateSmallWorldGraph(
+            ui->smallWorldNodes->value(),
+            ui->smallWorldNeighbors->value(),
+            ui->smallWorldRewiring->value()
+        );
+        break;
+    case RandomGeometricGraph:
+        setSeed(ui->geometricGeneratorSeed->value());
+        generateRandomGeometricGraph(
+            ui->geometricNodes->value(),
+            ui->geometricRadius->value()
+        );
+        break;
+    case RmatGraph:
+        setSeed(ui->rmatGeneratorSeed->value());
+        generateRmatGraph(
+            ui->rmatScale->value(),
+            ui->rmatEdges->value()
+        );
+        break;
     default:
         break;
     }
@@ -236,10 +263,11 @@ QPointF GenerateGraphWidget::documentCenter() const
     QPointF center = QPointF(0, 0);
     qreal xSum = 0;
     qreal ySum = 0;
-    int number = m_document->nodes().length();
-    foreach (NodePtr node, m_document->nodes()) {
-        xSum += node->x();
-        ySum += node->y();
+    const int number = m_document->nodeCount();
+    for (int i = 0; i < number; ++i) {
+        const QPointF position = m_document->nodeHandle(i).position();
+        xSum += position.x();
+        ySum += position.y();
     }
     if (number > 0) {
         center.setX(xSum / number);
@@ -266,8 +294,8 @@ void GenerateGraphWidget::generateMesh(int rows, int columns)
     for (int i = 0; i < columns; ++i) {
         for (int j = 0; j < rows; ++j) {
             NodePtr node = Node::create(m_document);
-            node->setX(i * 50 - (int)25 * columns + center.x());
-            node->setY(j * 50 - (int)25 * rows + center.y());
+            node->setPosition(QPointF(i * 50 - (int)25 * columns + center.x(),
+                                      j * 50 - (int)25 * rows + center.y()));
             node->setType(m_nodeType);
             meshNodes[qMakePair(i, j)] = node;
         }
@@ -299,16 +327,15 @@ void GenerateGraphWidget::generateStar(int satelliteNodes)
     NodeList nodes;
     for (int i = 1; i <= satelliteNodes; i++) {
         NodePtr node = Node::create(m_document);
-        node->setX(sin(i * 2 * boost::math::constants::pi<double>() / satelliteNodes)*radius + center.x());
-        node->setY(cos(i * 2 * boost::math::constants::pi<double>() / satelliteNodes)*radius + center.y());
+        node->setPosition(QPointF(sin(i * 2 * boost::math::constants::pi<double>() / satelliteNodes)*radius + center.x(),
+                                  cos(i * 2 * boost::math::constants::pi<double>() / satelliteNodes)*radius + center.y()));
         node->setType(m_nodeType);
         nodes.append(node);
     }
 
     // center
     NodePtr node = Node::create(m_document);
-    node->setX(center.x());
-    node->setY(center.y());
+    node->setPosition(QPointF(center.x(), center.y()));
     node->setType(m_nodeType);
     nodes.prepend(node);
 
@@ -333,8 +360,8 @@ void GenerateGraphWidget::generateCircle(int number)
     NodeList nodes;
     for (int i = 1; i <= number; i++) {
         NodePtr node = Node::create(m_document);
-        node->setX(sin(i * 2 * boost::math::constants::pi<double>() / number)*radius + center.x());
-        node->setY(cos(i * 2 * boost::math::constants::pi<double>() / number)*radius + center.y());
+        node->setPosition(QPointF(sin(i * 2 * boost::math::constants::pi<double>() / number)*radius + center.x(),
+                                  cos(i * 2 * boost::math::constants::pi<double>() / number)*radius + center.y()));
         node->setType(m_nodeType);
         nodes.append(node);
     }
@@ -350,93 +377,14 @@ void GenerateGraphWidget::generateCircle(int number)
 
 void GenerateGraphWidget::generateRandomGraph(int nodes, int edges, bool selfEdges)
 {
-    QPointF center = documentCenter();
-
-    Graph randomGraph;
-    boost::mt19937 gen;
-    gen.seed(static_cast<unsigned int>(m_seed));
-
-    // generate graph
-    boost::generate_random_graph<Graph, boost::mt19937>(
-        randomGraph,
-        nodes,
-        edges,
-        gen,
-        selfEdges
-    );
-
-    // generate distribution topology and apply
-    boost::rectangle_topology< boost::mt19937 > topology(gen, center.x() - 20 * nodes, center.y() - 20 * nodes, center.x() + 20 * nodes, center.y() + 20 * nodes);
-    PositionVec position_vec(boost::num_vertices(randomGraph));
-    PositionMap positionMap(position_vec.begin(), get(boost::vertex_index, randomGraph));
-
-    boost::random_graph_layout(randomGraph, positionMap, topology);
-
-    // minimize cuts by Fruchtman-Reingold layout algorithm
-    boost::fruchterman_reingold_force_directed_layout< boost::rectangle_topology< boost::mt19937 >, Graph, PositionMap >
-    (randomGraph,
-     positionMap,
-     topology,
-     boost::cooling(boost::linear_cooling<double>(100))
-    );
-
-    // put nodes at whiteboard as generated
-    QMap<int, NodePtr > mapNodes;
-    boost::graph_traits<Graph>::vertex_iterator vi, vi_end;
-    for (boost::tie(vi, vi_end) = boost::vertices(randomGraph); vi != vi_end; ++vi) {
-        mapNodes[*vi] = Node::create(m_document);
-        mapNodes[*vi]->setX(positionMap[*vi][0]);
-        mapNodes[*vi]->setY(positionMap[*vi][1]);
-        mapNodes[*vi]->setType(m_nodeType);
-    }
-
-    boost::graph_traits<Graph>::edge_iterator ei, ei_end;
-    for (boost::tie(ei, ei_end) = boost::edges(randomGraph); ei != ei_end; ++ei) {
-        EdgePtr edge = Edge::create(mapNodes[boost::source(*ei, randomGraph)], mapNodes[boost::target(*ei, randomGraph)]);
-        edge->setType(m_edgeType);
-    }
+    const RandomGraphGenerator generator(m_seed);
+    createGraphWithLayout(nodes, generator.gnm(nodes, edges, selfEdges));
 }
 
 void GenerateGraphWidget::generateErdosRenyiRandomGraph(int nodes, double edgeProbability, bool selfEdges)
 {
-    QPointF center = documentCenter();
-
-    boost::mt19937 gen;
-    gen.seed(static_cast<unsigned int>(m_seed));
-
-    // generate graph
-    typedef boost::erdos_renyi_iterator<boost::mt19937, Graph> ergen;
-    Graph randomGraph(ergen(gen, nodes, edgeProbability, selfEdges), ergen(), nodes);
-
-    // generate distribution topology and apply
-    boost::rectangle_topology< boost::mt19937 > topology(gen, center.x() - 20 * nodes, center.y() - 20 * nodes, center.x() + 20 * nodes, center.y() + 20 * nodes);
-    PositionVec position_vec(boost::num_vertices(randomGraph));
-    PositionMap positionMap(position_vec.begin(), get(boost::vertex_index, randomGraph));
-    boost::random_graph_layout(randomGraph, positionMap, topology);
-
-    // minimize cuts by Fruchtman-Reingold layout algorithm
-    boost::fruchterman_reingold_force_directed_layout< boost::rectangle_topology< boost::mt19937 >, Graph, PositionMap >
-    (randomGraph,
-     positionMap,
-     topology,
-     boost::cooling(boost::linear_cooling<double>(100))
-    );
-
-    // put nodes at whiteboard as generated
-    QMap<int, NodePtr > mapNodes;
-    boost::graph_traits<Graph>::vertex_iterator vi, vi_end;
-    for (boost::tie(vi, vi_end) = boost::vertices(randomGraph); vi != vi_end; ++vi) {
-        mapNodes[*vi] = Node::create(m_document);
-        mapNodes[*vi]->setX(positionMap[*vi][0]);
-        mapNodes[*vi]->setY(positionMap[*vi][1]);
-        mapNodes[*vi]->setType(m_nodeType);
-    }
-
-    boost::graph_traits<Graph>::edge_iterator ei, ei_end;
-    for (boost::tie(ei, ei_end) = boost::edges(randomGraph); ei != ei_end; ++ei) {
-        EdgePtr edge = Edge::create(mapNodes[boost::source(*ei, randomGraph)], mapNodes[boost::target(*ei, randomGraph)]);
-        edge->setType(m_edgeType);
-    }
+    const RandomGraphGenerator generator(m_seed);
+    createGraphWithLayout(nodes, generator.gnp(nodes, edgeProbability, selfEdges));
 }
 
 void GenerateGraphWidget::generateRandomTreeGraph(int number)
@@ -444,22 +392,17 @@ void GenerateGraphWidget::generateRandomTreeGraph(int number)
     boost::mt19937 gen;
     gen.seed(static_cast<unsigned int>(m_seed));
 
-    NodeList nodes;
-
-    NodePtr node = Node::create(m_document);
-    node->setType(m_nodeType);
-    nodes.append(node);
+    QVector<NodeHandle> nodes;
+    nodes.reserve(number);
+    nodes.append(m_document->createNode(QPointF(), m_nodeType));
 
     for (int i = 1; i < number; ++i) {
-        NodePtr thisNode = Node::create(m_document);
-        node->setType(m_nodeType);
+        const NodeHandle thisNode = m_document->createNode(QPointF(), m_nodeType);
         boost::random::uniform_int_distribution<> randomEarlierNodeGen(0, i-1);
         int randomEarlierNode = randomEarlierNodeGen(gen);
-        EdgePtr edge = Edge::create(thisNode, nodes.at(randomEarlierNode));
-        edge->setType(m_edgeType);
+        m_document->createEdge(thisNode, nodes.at(randomEarlierNode), m_edgeType);
         if (m_edgeType->direction() == EdgeType::Unidirectional) {
-            edge = Edge::create(nodes.at(randomEarlierNode), thisNode);
-            edge->setType(m_edgeType);
+            m_document->createEdge(nodes.at(randomEarlierNode), thisNode, m_edgeType);
         }
         nodes.append(thisNode);
     }
@@ -467,3 +410,66 @@ void GenerateGraphWidget::generateRandomTreeGraph(int number)
     Topology topology = Topology();
     topology.directedGraphDefaultTopology(m_document);
 }
+
+void GenerateGraphWidget::generateScaleFreeGraph(int nodes, int edgesPerNode)
+{
+    const RandomGraphGenerator generator(m_seed);
+    createGraphWithLayout(nodes, generator.barabasiAlbert(nodes, edgesPerNode));
+}
+
+void GenerateGraphWidget::generateSmallWorldGraph(int nodes, int neighbors, double rewiring)
+{
+    QPointF center = documentCenter();
+
+    // same spacing as for circle graphs
+    const qreal radius = 50 * nodes / (2 * boost::math::constants::pi<double>());
+    QVector<QPointF> positions(nodes);
+    for (int i = 0; i < nodes; ++i) {
+        const qreal angle = i * 2 * boost::math::constants::pi<double>() / nodes;
+        positions[i] = QPointF(sin(angle) * radius + center.x(), cos(angle) * radius + center.y());
+    }
+    const RandomGraphGenerator generator(m_seed);
+    createGraph(positions, generator.wattsStrogatz(nodes, neighbors, rewiring));
+}
+
+void GenerateGraphWidget::generateRandomGeometricGraph(int nodes, double radius)
+{
+    QPointF center = documentCenter();
+
+    // scale the unit square such that nodes have space ~50 between each other
+    const qreal side = 50 * std::sqrt(qreal(nodes));
+    QVector<QPointF> positions;
+    const RandomGraphGenerator generator(m_seed);
+    const RandomGraphGenerator::EdgeVector edges = generator.randomGeometric(nodes, radius, &positions);
+    for (int i = 0; i < positions.size(); ++i) {
+        positions[i] = (positions.at(i) - QPointF(0.5, 0.5)) * side + center;
+    }
+    createGraph(positions, edges);
+}
+
+void GenerateGraphWidget::generateRmatGraph(int scale, int edges)
+{
+    const RandomGraphGenerator generator(m_seed);
+    createGraphWithLayout(1 << scale, generator.rmat(scale, edges));
+}
+
+int GenerateGraphWidget::createGraph(const QVector<QPointF> &positions, const RandomGraphGenerator::EdgeVector &edges)
+{
+    const int first = m_document->createNodes(positions, m_nodeType);
+    // generators count nodes from zero, the document continues after its existing nodes
+    RandomGraphGenerator::EdgeVector pairs(edges);
+    for (int i = 0; i < pairs.size(); ++i) {
+        pairs[i].first += first;
+        pairs[i].second += first;
+    }
+    m_document->createEdges(pairs, m_edgeType);
+    return first;
+}
+
+void GenerateGraphWidget::createGraphWithLayout(int nodes, const RandomGraphGenerator::EdgeVector &edges)
+{
+    // the multilevel layout only respects the center of the initial positions
+    const int first = createGraph(QVector<QPointF>(nodes, documentCenter()), edges);
+    Topology topology;
+    topology.applyMultilevelAlignment(m_document->nodes().mid(first));
+}
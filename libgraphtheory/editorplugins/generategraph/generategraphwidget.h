@@ -21,6 +21,7 @@
 
 #include "ui_generategraphwidget.h"
 #include "typenames.h"
+#include "algorithms/randomgraphgenerator.h"
 #include <QWidget>
 #include <QDialog>
 
@@ -36,7 +37,11 @@ class GenerateGraphWidget : public QDialog
         CircleGraph,
         RandomEdgeGraph,
         ErdosRenyiRandomGraph,
-        RandomTree
+        RandomTree,
+        ScaleFreeGraph,
+        SmallWorldGraph,
+        RandomGeometricGraph,
+        RmatGraph
     };
 
 public:
@@ -140,6 +145,53 @@ private:
      */
     void generateRandomTreeGraph(int nodes);
 
+    /**
+     * Generate a scale-free graph by the Barabási-Albert preferential attachment model.
+     *
+     * \param nodes is the number of nodes of the generated graph
+     * \param edgesPerNode is the number of edges by which each new node attaches to earlier nodes
+     */
+    void generateScaleFreeGraph(int nodes, int edgesPerNode);
+
+    /**
+     * Generate a small world graph by the Watts-Strogatz model, the nodes are placed on a circle.
+     *
+     * \param nodes is the number of nodes of the generated graph
+     * \param neighbors is the number of ring neighbors of each node before rewiring
+     * \param rewiring is the probability to rewire an edge
+     */
+    void generateSmallWorldGraph(int nodes, int neighbors, double rewiring);
+
+    /**
+     * Generate a random geometric graph, which connects all nodes closer than \p radius after
+     * placing them uniformly at random in the unit square. The square is scaled to the document.
+     *
+     * \param nodes is the number of nodes of the generated graph
+     * \param radius is the connection radius relative to the side of the square
+     */
+    void generateRandomGeometricGraph(int nodes, double radius);
+
+    /**
+     * Generate a recursive matrix (R-MAT) graph with skewed degree distribution.
+     *
+     * \param scale is the logarithm of the number of nodes
+     * \param edges is the number of generated edges before removing duplicates and self edges
+     */
+    void generateRmatGraph(int scale, int edges);
+
+    /**
+     * Create nodes at \p positions and the \p edges between them by the bulk factories of
+     * the document, which create no objects for documents in compact storage.
+     *
+     * \return position of the first created node in the document, the others follow in order
+     */
+    int createGraph(const QVector<QPointF> &positions, const RandomGraphGenerator::EdgeVector &edges);
+
+    /**
+     * Create \p nodes many nodes with \p edges and apply the multilevel force directed layout.
+     */
+    void createGraphWithLayout(int nodes, const RandomGraphGenerator::EdgeVector &edges);
+
     GraphDocumentPtr m_document;
     int m_seed;
     NodeTypePtr m_nodeType;
@@ -0,0 +1,99 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "layoutgraphwidget.h"
+#include "graphdocument.h"
+#include "modifiers/forcedirectedlayout.h"
+#include "modifiers/layeredlayout.h"
+
+#include <KLocalizedString>
+#include <QPushButton>
+
+using namespace GraphTheory;
+
+LayoutGraphWidget::LayoutGraphWidget(GraphDocumentPtr document, QWidget *parent)
+    : QDialog(parent)
+    , m_document(document)
+    , m_layout(new ForceDirectedLayout(this))
+{
+    setWindowTitle(i18nc("@title:window", "Layout Graph"));
+    QVBoxLayout *mainLayout = new QVBoxLayout(this);
+    setLayout(mainLayout);
+
+    QWidget *widget = new QWidget(this);
+    ui = new Ui::LayoutGraphWidget;
+    ui->setupUi(widget);
+    mainLayout->addWidget(widget);
+
+    ui->edgeLength->setValue(m_layout->edgeLength());
+    if (!document->edges().isEmpty() && LayeredLayout::isAcyclic(document->nodes())) {
+        ui->method->setCurrentIndex(Layered);
+    } else if (document->nodes().count() > 1000) {
+        ui->method->setCurrentIndex(MultilevelForceDirected);
+    }
+    ui->progress->setValue(0);
+
+    connect(ui->buttons, &QDialogButtonBox::accepted, this, &LayoutGraphWidget::startLayout);
+    connect(ui->buttons, &QDialogButtonBox::rejected, this, &LayoutGraphWidget::reject);
+    connect(m_layout, &ForceDirectedLayout::progressChanged, this, &LayoutGraphWidget::updateProgress);
+    connect(m_layout, &ForceDirectedLayout::finished, this, &LayoutGraphWidget::accept);
+}
+
+LayoutGraphWidget::~LayoutGraphWidget()
+{
+    delete ui;
+}
+
+void LayoutGraphWidget::startLayout()
+{
+    if (ui->method->currentIndex() == Layered) {
+        // fast enough to run at once
+        LayeredLayout layout;
+        layout.setLayerDistance(ui->edgeLength->value());
+        layout.setNodeDistance(ui->edgeLength->value());
+        layout.apply(m_document->nodes());
+        accept();
+        return;
+    }
+    m_layout->setEdgeLength(ui->edgeLength->value());
+    m_layout->setMultilevel(ui->method->currentIndex() == MultilevelForceDirected);
+    if (!m_layout->start(m_document->nodes())) {
+        return;
+    }
+    ui->edgeLength->setEnabled(false);
+    ui->method->setEnabled(false);
+    ui->buttons->button(QDialogButtonBox::Ok)->setEnabled(false);
+}
+
+void LayoutGraphWidget::reject()
+{
+    // keep the positions computed so far, finished() closes the dialog
+    if (m_layout->isRunning()) {
+        m_layout->cancel();
+        return;
+    }
+    QDialog::reject();
+}
+
+void LayoutGraphWidget::updateProgress(int iteration, int maximum)
+{
+    ui->progress->setMaximum(maximum);
+    ui->progress->setValue(iteration);
+}
@@ -0,0 +1,63 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LAYOUTGRAPHWIDGET_H
+#define LAYOUTGRAPHWIDGET_H
+
+#include "ui_layoutgraphwidget.h"
+#include "typenames.h"
+#include <QDialog>
+
+namespace GraphTheory {
+
+class ForceDirectedLayout;
+
+/**
+ * Dialog to lay out all nodes of a document. Force directed layouts run in a worker thread,
+ * the nodes are moved while they run and they can be canceled at any time.
+ */
+class LayoutGraphWidget : public QDialog
+{
+    Q_OBJECT
+
+public:
+    explicit LayoutGraphWidget(GraphDocumentPtr document, QWidget *parent = 0);
+    ~LayoutGraphWidget();
+
+public Q_SLOTS:
+    void reject() Q_DECL_OVERRIDE;
+
+private Q_SLOTS:
+    void startLayout();
+    void updateProgress(int iteration, int maximum);
+
+private:
+    enum Method {
+        ForceDirected = 0,
+        MultilevelForceDirected = 1,
+        Layered = 2
+    };
+    GraphDocumentPtr m_document;
+    ForceDirectedLayout *m_layout;
+    Ui::LayoutGraphWidget *ui;
+};
+}
+
+#endif
@@ -22,6 +22,8 @@
 #include "typenames.h"
 #include "graphdocument.h"
 #include "edge.h"
+#include "node.h"
+#include "propertytable.h"
 #include "modifiers/topology.h"
 
 #include <KLocalizedString>
@@ -143,25 +145,24 @@ qreal TransformEdgesWidget::makeSpanningTree()
 
     /* weight[i][j] denotes distance between nodes i and j. If no
      * path is present between i and j in the previous tree the weight
-     * must be set to 0.
+     * must be set to 0. Weights are read from the dynamic edge property
+     * "value", edges without value have weight 1.
      */
     QMap< QPair<int, int>, qreal> weight;
+    const QString property = QStringLiteral("value");
 
     for (int i = 0; i < n; i++) {
-        for (int j = 0; j < n; j++) {
-            if (i == j)   weight[QPair<int, int>(i, j)] = 0;
-
-            EdgeList out;
-            out = nodes[i]->edges();
-
-            for (int k = 0; k < out.size(); k++) {
-                if (out[k]->to() == nodes[j]) {
-                    if (!out[k]->property("value").toString().isEmpty())
-                        weight[QPair<int, int>(i, j)] = out[k]->property("value").toDouble();
-                    else
-                        weight[QPair<int, int>(i, j)] = 1;
-
-                }
+        weight[QPair<int, int>(i, i)] = 0;
+    }
+    for (int i = 0; i < n; i++) {
+        foreach (const EdgePtr &edge, nodes[i]->edges()) {
+            const PropertyTable *properties = edge->type()->propertyTable();
+            const int column = properties->column(property);
+            const int j = edge->to()->documentIndex();
+            if (properties->hasValue(column, edge->propertyRow())) {
+                weight[QPair<int, int>(i, j)] = properties->realValue(column, edge->propertyRow());
+            } else {
+                weight[QPair<int, int>(i, j)] = 1;
             }
         }
     }
@@ -216,9 +217,7 @@ qreal TransformEdgesWidget::makeSpanningTree()
         EdgePtr edge = Edge::create(nodes[MST[i].first], nodes[MST[i].second]);
 
         if (weight[QPair<int, int>(MST[i].first, MST[i].second)] != 1) {
-            QString value;
-            value.setNum(weight[QPair<int, int>(MST[i].first, MST[i].second)]);
-            edge->setDynamicProperty("value", value);
+            edge->setDynamicProperty(property, weight[QPair<int, int>(MST[i].first, MST[i].second)]);
         }
     }
 
@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ELEMENTPOOL_P_H
+#define ELEMENTPOOL_P_H
+
+#include <QColor>
+#include <QVector>
+
+namespace GraphTheory
+{
+class NodeType;
+class EdgeType;
+
+/**
+ * \internal
+ * Struct-of-arrays storage of the nodes of a GraphDocument in compact storage mode. Entries
+ * are indexed by the position of the node in GraphDocument::nodes(). Types are not owned.
+ */
+struct NodePool
+{
+    QVector<int> ids;
+    QVector<qreal> xs;
+    QVector<qreal> ys;
+    QVector<QRgb> colors;
+    QVector<NodeType*> types;
+    QVector<int> propertyRows;
+
+    int count() const
+    {
+        return ids.size();
+    }
+
+    void reserve(int size)
+    {
+        ids.reserve(size);
+        xs.reserve(size);
+        ys.reserve(size);
+        colors.reserve(size);
+        types.reserve(size);
+        propertyRows.reserve(size);
+    }
+
+    void clear()
+    {
+        *this = NodePool();
+    }
+};
+
+/**
+ * \internal
+ * Struct-of-arrays storage of the edges of a GraphDocument in compact storage mode. Entries
+ * are indexed by the position of the edge in GraphDocument::edges(), end points are node
+ * positions. Types are not owned.
+ */
+struct EdgePool
+{
+    QVector<int> from;
+    QVector<int> to;
+    QVector<EdgeType*> types;
+    QVector<int> propertyRows;
+
+    int count() const
+    {
+        return from.size();
+    }
+
+    void reserve(int size)
+    {
+        from.reserve(size);
+        to.reserve(size);
+        types.reserve(size);
+        propertyRows.reserve(size);
+    }
+
+    void clear()
+    {
+        *this = EdgePool();
+    }
+};
+}
+
+#endif
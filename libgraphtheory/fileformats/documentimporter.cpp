@@ -0,0 +1,148 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "documentimporter.h"
+#include "fileformatmanager.h"
+#include "fileformatinterface.h"
+#include "graphdocument.h"
+#include "logging_p.h"
+#include <KLocalizedString>
+#include <QFileInfo>
+#include <QFutureWatcher>
+#include <QThread>
+#include <QtConcurrent>
+
+using namespace GraphTheory;
+
+class GraphTheory::DocumentImporterPrivate
+{
+public:
+    DocumentImporterPrivate()
+        : backend(0)
+        , canceled(false)
+    {
+    }
+
+    FileFormatManager manager;
+    FileFormatInterface *backend;
+    QFutureWatcher<void> watcher;
+    QUrl file;
+    GraphDocumentPtr document;
+    QString errorString;
+    bool canceled;
+};
+
+DocumentImporter::DocumentImporter(QObject *parent)
+    : QObject(parent)
+    , d(new DocumentImporterPrivate)
+{
+    connect(&d->watcher, &QFutureWatcher<void>::finished, this, [this]() {
+        // the worker hands over the document with all of its objects to the importer's thread
+        Q_ASSERT(!d->document || d->document->thread() == thread());
+        emit finished();
+    });
+}
+
+DocumentImporter::~DocumentImporter()
+{
+    if (isRunning()) {
+        d->backend->cancel();
+        d->watcher.waitForFinished();
+    }
+}
+
+bool DocumentImporter::start(const QUrl &file)
+{
+    if (isRunning()) {
+        d->errorString = i18n("Another import is still running.");
+        return false;
+    }
+    d->document.reset();
+    d->errorString.clear();
+    d->canceled = false;
+
+    const QString ext = QFileInfo(file.toLocalFile()).completeSuffix();
+    FileFormatInterface *backend = d->manager.backendByExtension(ext);
+    if (!backend) {
+        d->errorString = i18n("No graph file backend found for file \"%1\".", file.toLocalFile());
+        qCCritical(GRAPHTHEORY_FILEFORMAT) << "No graph file backend found for extension" << ext << ", aborting.";
+        return false;
+    }
+    if (d->backend != backend) {
+        if (d->backend) {
+            d->backend->disconnect(this);
+        }
+        connect(backend, &FileFormatInterface::progressChanged, this, &DocumentImporter::progressChanged);
+        d->backend = backend;
+    }
+    d->file = file;
+    d->backend->setFile(file);
+    d->watcher.setFuture(QtConcurrent::run(this, &DocumentImporter::read));
+    return true;
+}
+
+void DocumentImporter::read()
+{
+    // executed in worker thread: only touch the backend and the private result fields
+    const GraphDocumentPtr previous = d->backend->graphDocument();
+    d->backend->readFile();
+    const GraphDocumentPtr document = d->backend->graphDocument();
+    if (d->backend->hasError()) {
+        d->canceled = d->backend->error() == FileFormatInterface::Canceled;
+        d->errorString = d->backend->errorString();
+        if (document && document != previous) {
+            document->destroy();
+        }
+        return;
+    }
+    if (!document || document == previous) {
+        d->errorString = i18n("Could not read file \"%1\".", d->file.toLocalFile());
+        return;
+    }
+    document->transferToThread(thread());
+    d->document = document;
+}
+
+void DocumentImporter::cancel()
+{
+    if (isRunning()) {
+        d->backend->cancel();
+    }
+}
+
+bool DocumentImporter::isRunning() const
+{
+    return d->watcher.isRunning();
+}
+
+bool DocumentImporter::isCanceled() const
+{
+    return d->canceled;
+}
+
+GraphDocumentPtr DocumentImporter::document() const
+{
+    return d->document;
+}
+
+QString DocumentImporter::errorString() const
+{
+    return d->errorString;
+}
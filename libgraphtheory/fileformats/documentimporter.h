@@ -0,0 +1,98 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DOCUMENTIMPORTER_H
+#define DOCUMENTIMPORTER_H
+
+#include "graphtheory_export.h"
+#include "typenames.h"
+#include <QObject>
+#include <QString>
+#include <QUrl>
+
+namespace GraphTheory
+{
+
+class DocumentImporterPrivate;
+
+/**
+ * \class DocumentImporter
+ * Reads a graph file with the matching file format plugin in a worker thread.
+ * The plugin reports its progress via progressChanged() and the import can be
+ * aborted by cancel(). When the worker is done, the created document is moved to
+ * the thread of the importer and finished() is emitted.
+ */
+class GRAPHTHEORY_EXPORT DocumentImporter : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit DocumentImporter(QObject *parent = 0);
+
+    /**
+     * Cancels a running import and waits for the worker to finish.
+     */
+    ~DocumentImporter();
+
+    /**
+     * Start asynchronous import of @p file. The file format plugin is selected by the
+     * file suffix.
+     * @return @e true if the import was started, otherwise @e false and errorString()
+     *         describes the problem
+     */
+    bool start(const QUrl &file);
+
+    /**
+     * Request the running import to stop. The plugin aborts at its next check and
+     * finished() is emitted without a document.
+     */
+    void cancel();
+
+    /**
+     * @return @e true while an import is running, otherwise @e false
+     */
+    bool isRunning() const;
+
+    /**
+     * @return @e true if the last import was canceled, otherwise @e false
+     */
+    bool isCanceled() const;
+
+    /**
+     * @return imported document after finished() or a null pointer on failure
+     */
+    GraphDocumentPtr document() const;
+
+    /**
+     * @return message describing why the last import failed
+     */
+    QString errorString() const;
+
+Q_SIGNALS:
+    void progressChanged(qint64 value, qint64 maximum);
+    void finished();
+
+private:
+    void read();
+    const QScopedPointer<DocumentImporterPrivate> d;
+};
+}
+
+#endif
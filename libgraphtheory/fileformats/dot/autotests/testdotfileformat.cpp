@@ -27,6 +27,8 @@
 #include "logging_p.h"
 #include <string>
 #include <QtTest>
+#include <QSignalSpy>
+#include <QtConcurrent>
 #include <QUrl>
 
 using namespace GraphTheory;
@@ -722,4 +724,46 @@ void DotFileFormatTest::writeAndParseTest()
     QCOMPARE(document->edges().count(), 1);
 }
 
+void DotFileFormatTest::readProgressAndCancel()
+{
+    DotFileFormat importer(this, QList<QVariant>());
+    QSignalSpy progressSpy(&importer, SIGNAL(progressChanged(qint64,qint64)));
+    importer.setFile(QUrl::fromLocalFile("undirected/ER.gv"));
+    importer.readFile();
+    QVERIFY(!importer.hasError());
+    QVERIFY(progressSpy.count() > 0);
+    const QList<QVariant> last = progressSpy.last();
+    QVERIFY(last.at(0).toLongLong() <= last.at(1).toLongLong());
+
+    // a canceled import stops at the first statement
+    importer.setFile(QUrl::fromLocalFile("undirected/ER.gv"));
+    importer.cancel();
+    importer.readFile();
+    QCOMPARE(importer.error(), FileFormatInterface::Canceled);
+}
+
+void DotFileFormatTest::parseConcurrently()
+{
+    auto parseRepeatedly = [] () {
+        for (int i = 0; i < 20; ++i) {
+            GraphDocumentPtr document = GraphDocument::create();
+            const bool valid = DotParser::parse(simple, document)
+                && document->nodes().count() == 5
+                && document->edges().count() == 2;
+            document->destroy();
+            if (!valid) {
+                return false;
+            }
+        }
+        return true;
+    };
+    QList<QFuture<bool>> results;
+    for (int i = 0; i < 4; ++i) {
+        results.append(QtConcurrent::run(parseRepeatedly));
+    }
+    foreach (QFuture<bool> result, results) {
+        QVERIFY(result.result());
+    }
+}
+
 QTEST_MAIN(DotFileFormatTest)
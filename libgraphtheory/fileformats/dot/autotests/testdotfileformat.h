@@ -106,6 +106,12 @@ private slots:
 
     // parsing of exported files
     void writeAndParseTest();
+
+    // progress and cancellation of imports
+    void readProgressAndCancel();
+
+    // imports running at the same time do not share parser state
+    void parseConcurrently();
 };
 
 #endif
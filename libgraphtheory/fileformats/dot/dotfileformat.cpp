@@ -34,8 +34,6 @@
 #include "dotgrammarhelper.h"
 #include "dotgrammar.h"
 
-extern DotParser::DotGraphParsingHelper* phelper;
-
 using namespace GraphTheory;
 
 K_PLUGIN_FACTORY_WITH_JSON( FilePluginFactory,
@@ -60,6 +58,7 @@ const QStringList DotFileFormat::extensions() const
 void DotFileFormat::readFile()
 {
     GraphDocumentPtr document = GraphDocument::create();
+    BatchGuard batch(document);
     setGraphDocument(document);
 
     QList < QPair<QString, QString> > edges;
@@ -69,13 +68,25 @@ void DotFileFormat::readFile()
         return;
     }
     QString content = fileHandle.readAll();
-    if (!DotParser::parse(content.toStdString(), document)) {
+    const bool parsed = DotParser::parse(content.toStdString(), document, this);
+    if (isCanceled()) {
+        document->destroy();
+        setError(Canceled, i18n("Import of file \"%1\" was canceled.", file().toLocalFile()));
+        return;
+    }
+    if (!parsed) {
         setError(EncodingProblem, i18n("Could not parse file \"%1\".", file().toLocalFile()));
         return;
     }
     Topology layouter;
+    layouter.setCancelCondition([this]() { return isCanceled(); });
     layouter.directedGraphDefaultTopology(document);
-     setError(None);
+    if (isCanceled()) {
+        document->destroy();
+        setError(Canceled, i18n("Import of file \"%1\" was canceled.", file().toLocalFile()));
+        return;
+    }
+    setError(None);
 }
 
 void DotFileFormat::writeFile(GraphDocumentPtr document)
@@ -122,14 +133,14 @@ QString DotFileFormat::processEdge(EdgePtr edge) const
         edgeStr.append("[");
         edgeStr.append(QString(" label = \"%2\" ").arg(edge->property("name").toString()));
     }
-    foreach(const QByteArray& property, edge->dynamicPropertyNames()) {
+    foreach(const QString& property, edge->dynamicProperties()) {
         if (firstProperty == true) {
                 firstProperty = false;
                 edgeStr.append("[");
             } else {
                 edgeStr.append(", ");
         }
-        edgeStr.append(QString(" %1 = \"%2\" ").arg(QString(property)).arg(edge->property(property).toString()));
+        edgeStr.append(QString(" %1 = \"%2\" ").arg(property).arg(edge->dynamicProperty(property).toString()));
     }
     if (!firstProperty) { // at least one property was inserted
         edgeStr.append("]");
@@ -148,9 +159,9 @@ QString DotFileFormat::processNode(NodePtr node) const
         nodeStr.append(QString("label=\"%1\" ").arg(node->dynamicProperty("name").toString()));
     }
 
-    foreach(const QByteArray& property, node->dynamicPropertyNames()) {
+    foreach(const QString& property, node->dynamicProperties()) {
         nodeStr.append(", ");
-        nodeStr.append(QString(" %1 = \"%2\" ").arg(QString(property)).arg(node->property(property).toString()));
+        nodeStr.append(QString(" %1 = \"%2\" ").arg(property).arg(node->dynamicProperty(property).toString()));
     }
 
     // at least one property was inserted
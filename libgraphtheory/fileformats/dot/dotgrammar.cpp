@@ -29,6 +29,8 @@
 #include <boost/spirit/include/qi_string.hpp>
 #include <boost/spirit/repository/include/qi_distinct.hpp>
 #include <boost/spirit/repository/include/qi_confix.hpp>
+#include <boost/spirit/repository/include/qi_iter_pos.hpp>
+#include <boost/spirit/include/phoenix_bind.hpp>
 #include <boost/spirit/include/phoenix_core.hpp>
 #include <boost/spirit/include/phoenix_operator.hpp>
 #include <boost/spirit/include/phoenix_stl.hpp>
@@ -152,6 +154,7 @@ using boost::spirit::standard::digit;
 using boost::spirit::standard::string;
 using boost::spirit::standard::space;
 using boost::spirit::qi::_1;
+using boost::spirit::qi::_pass;
 using boost::spirit::qi::_val;
 using boost::spirit::qi::char_;
 using boost::spirit::qi::eol;
@@ -161,61 +164,61 @@ using boost::spirit::qi::phrase_parse;
 using boost::spirit::qi::rule;
 using boost::spirit::qi::standard::space_type;
 using boost::spirit::repository::qi::confix;
+using boost::spirit::repository::qi::iter_pos;
 
 typedef BOOST_TYPEOF(SKIPPER) skipper_type;
 
-DotGraphParsingHelper* phelper = 0;
-
 template <typename Iterator, typename Skipper = space_type>
 struct DotGrammar : boost::spirit::qi::grammar<Iterator, Skipper> {
 
-    DotGrammar() : DotGrammar::base_type(graph) {
+    explicit DotGrammar(DotGraphParsingHelper *helper) : DotGrammar::base_type(graph) {
 
         graph = -distinct::keyword["strict"][&setStrict]
-                >> (distinct::keyword["graph"][&setUndirected] | distinct::keyword["digraph"][&setDirected])
+                >> (distinct::keyword["graph"][phx::bind(&setUndirected, helper)] | distinct::keyword["digraph"][phx::bind(&setDirected, helper)])
                 >> -ID[&setGraphId]
                 >> '{'
                 >> stmt_list
                 >> '}';
 
-        stmt_list = stmt >> -char_(';') >> -stmt_list;
+        // a canceled import fails the statement list and thereby the whole parse
+        stmt_list = iter_pos[_pass = phx::bind(&checkProgress, helper, _1)] >> stmt >> -char_(';') >> -stmt_list;
 
-        stmt = (    (ID[&attributeId] >> '=' >> ID[&valid])[&applyAttributeList]
+        stmt = (    (ID[phx::bind(&attributeId, helper, _1)] >> '=' >> ID[phx::bind(&valid, helper, _1)])[phx::bind(&applyAttributeList, helper)]
                     | attr_stmt
                     | edge_stmt
                     | node_stmt
                     | subgraph
                 );
 
-        attr_stmt = ( (distinct::keyword["graph"][phx::ref(phelper->attributed)="graph"] >> attr_list[&applyAttributeList])[&setGraphAttributes]
-                    | (distinct::keyword["node"][phx::ref(phelper->attributed)="node"] >> attr_list[&applyAttributeList])
-                    | (distinct::keyword["edge"][phx::ref(phelper->attributed)="edge"] >> attr_list[&applyAttributeList])
+        attr_stmt = ( (distinct::keyword["graph"][phx::ref(helper->attributed)="graph"] >> attr_list[phx::bind(&applyAttributeList, helper)])[phx::bind(&setGraphAttributes, helper)]
+                    | (distinct::keyword["node"][phx::ref(helper->attributed)="node"] >> attr_list[phx::bind(&applyAttributeList, helper)])
+                    | (distinct::keyword["edge"][phx::ref(helper->attributed)="edge"] >> attr_list[phx::bind(&applyAttributeList, helper)])
                     );
 
         attr_list = '[' >> -a_list >>']';
 
-        a_list = (ID[&attributeId] >> -('=' >> ID[&valid]))[&insertAttributeIntoAttributeList]
+        a_list = (ID[phx::bind(&attributeId, helper, _1)] >> -('=' >> ID[phx::bind(&valid, helper, _1)]))[phx::bind(&insertAttributeIntoAttributeList, helper)]
                  >> -char_(',') >> -a_list;
 
         edge_stmt = (
-                        (node_id[&edgebound] | subgraph) >> edgeRHS >> -(attr_list[phx::ref(phelper->attributed)="edge"])
-                    )[&createAttributeList][&applyAttributeList][&createEdge][&removeAttributeList];
+                        (node_id[phx::bind(&edgebound, helper, _1)] | subgraph) >> edgeRHS >> -(attr_list[phx::ref(helper->attributed)="edge"])
+                    )[phx::bind(&createAttributeList, helper)][phx::bind(&applyAttributeList, helper)][phx::bind(&createEdge, helper)][phx::bind(&removeAttributeList, helper)];
 
-        edgeRHS = edgeop[&checkEdgeOperator] >> (node_id[&edgebound] | subgraph) >> -edgeRHS;
+        edgeRHS = edgeop[phx::bind(&checkEdgeOperator, helper, _1)] >> (node_id[phx::bind(&edgebound, helper, _1)] | subgraph) >> -edgeRHS;
 
         node_stmt  = (
-                         node_id[&createNode] >> -attr_list
-                     )[phx::ref(phelper->attributed)="node"][&createAttributeList][&applyAttributeList][&setNodeAttributes][&removeAttributeList];
+                         node_id[phx::bind(&createNode, helper, _1)] >> -attr_list
+                     )[phx::ref(helper->attributed)="node"][phx::bind(&createAttributeList, helper)][phx::bind(&applyAttributeList, helper)][phx::bind(&setNodeAttributes, helper)][phx::bind(&removeAttributeList, helper)];
 
         node_id = ID >> -port;
 
         port = (':' >> ID >> -(':' >> compass_pt))
                | (':' >> compass_pt);
 
-        subgraph = -(distinct::keyword["subgraph"] >> -ID[&subGraphId])
-                   >> char_('{')[&createSubGraph][&createAttributeList]
+        subgraph = -(distinct::keyword["subgraph"] >> -ID[phx::bind(&subGraphId, helper, _1)])
+                   >> char_('{')[phx::bind(&createSubGraph, helper)][phx::bind(&createAttributeList, helper)]
                    >> stmt_list
-                   >> char_('}')[&leaveSubGraph][&removeAttributeList];
+                   >> char_('}')[phx::bind(&leaveSubGraph, helper)][phx::bind(&removeAttributeList, helper)];
 
         compass_pt  = (distinct::keyword["n"] | distinct::keyword["ne"] | distinct::keyword["e"]
                     | distinct::keyword["se"] | distinct::keyword["s"] | distinct::keyword["sw"]
@@ -254,12 +257,14 @@ struct DotGrammar : boost::spirit::qi::grammar<Iterator, Skipper> {
     rule<Iterator, std::string(), Skipper> compass_pt;
 };
 
-void leaveSubGraph()
+bool checkProgress(DotGraphParsingHelper *helper, std::string::const_iterator position)
 {
-    if (!phelper) {
-        return;
-    }
-    phelper->leaveSubGraph();
+    return helper->reportProgress(position - helper->inputBegin);
+}
+
+void leaveSubGraph(DotGraphParsingHelper *helper)
+{
+    helper->leaveSubGraph();
 }
 
 void setStrict()
@@ -267,14 +272,14 @@ void setStrict()
     qCCritical(GRAPHTHEORY_FILEFORMAT) << "Graphviz \"strict\" keyword is not implemented.";
 }
 
-void setUndirected()
+void setUndirected(DotGraphParsingHelper *helper)
 {
-    phelper->document->edgeTypes().first()->setDirection(EdgeType::Bidirectional);
+    helper->document->edgeTypes().first()->setDirection(EdgeType::Bidirectional);
 }
 
-void setDirected()
+void setDirected(DotGraphParsingHelper *helper)
 {
-    phelper->document->edgeTypes().first()->setDirection(EdgeType::Unidirectional);
+    helper->document->edgeTypes().first()->setDirection(EdgeType::Unidirectional);
 }
 
 void setGraphId(const std::string& str)
@@ -284,11 +289,8 @@ void setGraphId(const std::string& str)
     //TODO not implemented
 }
 
-void attributeId(const std::string& str)
+void attributeId(DotGraphParsingHelper *helper, const std::string& str)
 {
-    if (!phelper) {
-        return;
-    }
     // remove quotation marks
     QString id = QString::fromStdString(str);
     if (id.endsWith('"')) {
@@ -297,15 +299,12 @@ void attributeId(const std::string& str)
     if (id.startsWith('"')) {
         id.remove(0, 1);
     }
-    phelper->attributeId = id;
-    phelper->valid.clear();
+    helper->attributeId = id;
+    helper->valid.clear();
 }
 
-void subGraphId(const std::string& str)
+void subGraphId(DotGraphParsingHelper *helper, const std::string& str)
 {
-    if (!phelper) {
-        return;
-    }
     // remove quotation marks
     QString id = QString::fromStdString(str);
     if (id.endsWith('"')) {
@@ -314,14 +313,11 @@ void subGraphId(const std::string& str)
     if (id.startsWith('"')) {
         id.remove(0, 1);
     }
-    phelper->setSubGraphId(id);
+    helper->setSubGraphId(id);
 }
 
-void valid(const std::string& str)
+void valid(DotGraphParsingHelper *helper, const std::string& str)
 {
-    if (!phelper) {
-        return;
-    }
     // remove quotation marks
     QString id = QString::fromStdString(str);
     if (id.endsWith('"')) {
@@ -330,44 +326,35 @@ void valid(const std::string& str)
     if (id.startsWith('"')) {
         id.remove(0, 1);
     }
-    phelper->valid = id;
+    helper->valid = id;
 }
 
-void insertAttributeIntoAttributeList()
+void insertAttributeIntoAttributeList(DotGraphParsingHelper *helper)
 {
-    if (!phelper) {
-        return;
-    }
-    phelper->unprocessedAttributes.insert(phelper->attributeId, phelper->valid);
+    helper->unprocessedAttributes.insert(helper->attributeId, helper->valid);
 }
 
-void createAttributeList()
+void createAttributeList(DotGraphParsingHelper *helper)
 {
-    if (!phelper) {
-        return;
-    }
-    phelper->graphAttributeStack.push_back(phelper->graphAttributes);
-    phelper->nodeAttributeStack.push_back(phelper->nodeAttributes);
-    phelper->edgeAttributeStack.push_back(phelper->edgeAttributes);
+    helper->graphAttributeStack.push_back(helper->graphAttributes);
+    helper->nodeAttributeStack.push_back(helper->nodeAttributes);
+    helper->edgeAttributeStack.push_back(helper->edgeAttributes);
 }
 
-void removeAttributeList()
+void removeAttributeList(DotGraphParsingHelper *helper)
 {
-    if (!phelper) {
-        return;
-    }
-    phelper->graphAttributes = phelper->graphAttributeStack.back();
-    phelper->graphAttributeStack.pop_back();
-    phelper->nodeAttributes = phelper->nodeAttributeStack.back();
-    phelper->nodeAttributeStack.pop_back();
-    phelper->edgeAttributes = phelper->edgeAttributeStack.back();
-    phelper->edgeAttributeStack.pop_back();
+    helper->graphAttributes = helper->graphAttributeStack.back();
+    helper->graphAttributeStack.pop_back();
+    helper->nodeAttributes = helper->nodeAttributeStack.back();
+    helper->nodeAttributeStack.pop_back();
+    helper->edgeAttributes = helper->edgeAttributeStack.back();
+    helper->edgeAttributeStack.pop_back();
 }
 
-void createNode(const std::string& str)
+void createNode(DotGraphParsingHelper *helper, const std::string& str)
 {
     QString label = QString::fromStdString(str);
-    if (!phelper || label.length() == 0) {
+    if (label.length() == 0) {
         return;
     }
     // remove quotation marks
@@ -377,51 +364,35 @@ void createNode(const std::string& str)
     if (label.startsWith('"')) {
         label.remove(0, 1);
     }
-    if (!phelper->nodeMap.contains(label)) {
-        phelper->createNode(label);
+    if (!helper->nodeMap.contains(label)) {
+        helper->createNode(label);
     }
 }
 
-void createSubGraph()
+void createSubGraph(DotGraphParsingHelper *helper)
 {
-    if (!phelper) {
-        return;
-    }
-    phelper->createSubGraph();
+    helper->createSubGraph();
 }
 
-void setGraphAttributes()
+void setGraphAttributes(DotGraphParsingHelper *helper)
 {
-    if (!phelper) {
-        return;
-    }
-    phelper->setDocumentAttributes();
+    helper->setDocumentAttributes();
 }
 
-void setNodeAttributes()
+void setNodeAttributes(DotGraphParsingHelper *helper)
 {
-    if (!phelper) {
-        return;
-    }
-    phelper->setNodeAttributes();
+    helper->setNodeAttributes();
 }
 
-void applyAttributeList()
+void applyAttributeList(DotGraphParsingHelper *helper)
 {
-    if (!phelper) {
-        return;
-    }
-    phelper->applyAttributedList();
+    helper->applyAttributedList();
 }
 
-void checkEdgeOperator(const std::string& str)
+void checkEdgeOperator(DotGraphParsingHelper *helper, const std::string& str)
 {
-    if (!phelper) {
-        return;
-    }
-
-    if (((phelper->document->edgeTypes().first()->direction() == EdgeType::Unidirectional) && (str.compare("->") == 0)) ||
-            ((phelper->document->edgeTypes().first()->direction() == EdgeType::Bidirectional) && (str.compare("--") == 0)))
+    if (((helper->document->edgeTypes().first()->direction() == EdgeType::Unidirectional) && (str.compare("->") == 0)) ||
+            ((helper->document->edgeTypes().first()->direction() == EdgeType::Bidirectional) && (str.compare("--") == 0)))
     {
         return;
     }
@@ -429,11 +400,8 @@ void checkEdgeOperator(const std::string& str)
     qCCritical(GRAPHTHEORY_FILEFORMAT) << "Error: incoherent edge direction relation" << endl;
 }
 
-void edgebound(const std::string& str)
+void edgebound(DotGraphParsingHelper *helper, const std::string& str)
 {
-    if (!phelper) {
-        return;
-    }
     // remove quotation marks
     QString id = QString::fromStdString(str);
     if (id.endsWith('"')) {
@@ -442,15 +410,12 @@ void edgebound(const std::string& str)
     if (id.startsWith('"')) {
         id.remove(0, 1);
     }
-    phelper->addEdgeBound(id);
+    helper->addEdgeBound(id);
 }
 
-void createEdge()
+void createEdge(DotGraphParsingHelper *helper)
 {
-    if (!phelper) {
-        return;
-    }
-    phelper->createEdge();
+    helper->createEdge();
 }
 
 bool parseIntegers(const std::string& str, std::vector<int>& v)
@@ -466,19 +431,24 @@ bool parseIntegers(const std::string& str, std::vector<int>& v)
         space);
 }
 
-bool parse(const std::string& str, GraphDocumentPtr document)
+bool parse(const std::string& str, GraphDocumentPtr document, FileFormatInterface *format)
 {
-    delete phelper;
-    phelper = new DotGraphParsingHelper;
-    phelper->document = document;
+    // all parser state lives in the helper of this parse, such that files can be parsed concurrently
+    DotGraphParsingHelper helper;
+    helper.document = document;
 
     std::string input(str);
     std::string::iterator iter = input.begin();
-    DotGrammar<std::string::iterator, skipper_type> r;
+    helper.format = format;
+    helper.inputBegin = input.begin();
+    helper.inputSize = input.size();
+    DotGrammar<std::string::iterator, skipper_type> r(&helper);
 
     if (phrase_parse(iter, input.end(), r, SKIPPER)) {
         qCDebug(GRAPHTHEORY_FILEFORMAT) << "Complete dot file was parsed successfully.";
         return true;
+    } else if (format && format->isCanceled()) {
+        qCDebug(GRAPHTHEORY_FILEFORMAT) << "Dot file parsing was canceled.";
     } else {
         qCWarning(GRAPHTHEORY_FILEFORMAT) << "Dot file parsing failed. Unable to parse:";
         qCDebug(GRAPHTHEORY_FILEFORMAT) << "///// FILE CONTENT BEGIN /////";
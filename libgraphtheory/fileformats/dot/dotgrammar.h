@@ -25,36 +25,49 @@
 
 class Document;
 
+namespace GraphTheory {
+    class FileFormatInterface;
+}
+
 namespace DotParser {
+    struct DotGraphParsingHelper;
+
     /**
     * Parse the given string \p str that represents the textual respresentation of a
     * graph in DOT/Graphviz format. The given document \p graphDoc must
-    * be of plugin type "Graph.
+    * be of plugin type "Graph. If \p format is given, the parser reports its position in
+    * \p str as progress of \p format and stops as soon as its import is canceled.
+    */
+    bool parse(const std::string& str, GraphTheory::GraphDocumentPtr document, GraphTheory::FileFormatInterface *format = 0);
+
+    /**
+    * Report the parser \p position at the begin of a statement to the \p helper of the parse.
+    * \return false if the import was canceled
     */
-    bool parse(const std::string& str, GraphTheory::GraphDocumentPtr document);
+    bool checkProgress(DotGraphParsingHelper *helper, std::string::const_iterator position);
 
     bool parseIntegers(const std::string& str, std::vector<int>& v);
 
+    // semantic actions, each operates on the state of the parse given by \p helper
     void setStrict();
-    void setUndirected();
-    void setDirected();
+    void setUndirected(DotGraphParsingHelper *helper);
+    void setDirected(DotGraphParsingHelper *helper);
     void setGraphId(const std::string &str);
-    void attributeId(const std::string &str);
-    void subGraphId(const std::string &str);
-    void valid(const std::string &str);
-    void insertAttributeIntoAttributeList();
-    void createAttributeList();
-    void removeAttributeList();
-    void createSubGraph();
-    void leaveSubGraph();
-    void createNode(const std::string &str);
-    void setGraphAttributes();
-    void setSubGraphAttributes(char const* first, char const* last);
-    void setNodeAttributes();
-    void applyAttributeList();
-    void checkEdgeOperator(const std::string &str);
-    void edgebound(const std::string &str);
-    void createEdge();
+    void attributeId(DotGraphParsingHelper *helper, const std::string &str);
+    void subGraphId(DotGraphParsingHelper *helper, const std::string &str);
+    void valid(DotGraphParsingHelper *helper, const std::string &str);
+    void insertAttributeIntoAttributeList(DotGraphParsingHelper *helper);
+    void createAttributeList(DotGraphParsingHelper *helper);
+    void removeAttributeList(DotGraphParsingHelper *helper);
+    void createSubGraph(DotGraphParsingHelper *helper);
+    void leaveSubGraph(DotGraphParsingHelper *helper);
+    void createNode(DotGraphParsingHelper *helper, const std::string &str);
+    void setGraphAttributes(DotGraphParsingHelper *helper);
+    void setNodeAttributes(DotGraphParsingHelper *helper);
+    void applyAttributeList(DotGraphParsingHelper *helper);
+    void checkEdgeOperator(DotGraphParsingHelper *helper, const std::string &str);
+    void edgebound(DotGraphParsingHelper *helper, const std::string &str);
+    void createEdge(DotGraphParsingHelper *helper);
 }
 
 #endif
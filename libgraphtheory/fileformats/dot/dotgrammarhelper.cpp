@@ -28,8 +28,6 @@
 
 #include <QFile>
 
-extern DotParser::DotGraphParsingHelper* phelper;
-
 using namespace GraphTheory;
 
 namespace DotParser
@@ -49,10 +47,28 @@ DotGraphParsingHelper::DotGraphParsingHelper():
     edgebounds(),
     currentNode(),
     currentEdge(),
-    nodeMap()
+    nodeMap(),
+    format(0),
+    inputSize(0),
+    reportedPosition(0)
 {
 }
 
+bool DotGraphParsingHelper::reportProgress(qint64 position)
+{
+    if (!format) {
+        return true;
+    }
+    if (format->isCanceled()) {
+        return false;
+    }
+    if (position - reportedPosition >= inputSize / 100) {
+        reportedPosition = position;
+        emit format->progressChanged(position, inputSize);
+    }
+    return true;
+}
+
 void DotGraphParsingHelper::setObjectAttributes(QObject *graphElement, const AttributesMap &attributes)
 {
     AttributesMap::const_iterator iter;
@@ -86,14 +102,12 @@ void DotGraphParsingHelper::setNodeAttributes()
     AttributesMap::ConstIterator iter;
     iter = nodeAttributes.constBegin();
     for (; iter != nodeAttributes.constEnd(); ++iter) {
-        if (!currentNode->dynamicProperties().contains(iter.key())) {
-            currentNode->type()->addDynamicProperty(iter.key());
-        }
-        QString key = iter.key(); // do not overwrite labels
-        if (key == "name") {
-            key = "dot_name";
+        const PropertyKey key = currentNode->type()->addDynamicProperty(iter.key());
+        if (iter.key() == "name") { // do not overwrite labels
+            currentNode->setDynamicProperty(QStringLiteral("dot_name"), iter.value());
+        } else {
+            currentNode->setDynamicProperty(key, iter.value());
         }
-        currentNode->setDynamicProperty(key, iter.value());
     }
 }
 
@@ -105,10 +119,7 @@ void DotGraphParsingHelper::setEdgeAttributes()
     AttributesMap::ConstIterator iter;
     iter = edgeAttributes.constBegin();
     for (; iter != edgeAttributes.constEnd(); ++iter) {
-        if (!currentEdge->dynamicProperties().contains(iter.key())) {
-            currentEdge->type()->addDynamicProperty(iter.key());
-        }
-        currentEdge->setDynamicProperty(iter.key(), iter.value());
+        currentEdge->setDynamicProperty(currentEdge->type()->addDynamicProperty(iter.key()), iter.value());
     }
 }
 
@@ -155,10 +166,7 @@ void DotGraphParsingHelper::createNode(const QString &name)
         return;
     }
     currentNode = GraphTheory::Node::create(document);
-    if (!currentNode->type()->dynamicProperties().contains("name")) {
-        currentNode->type()->addDynamicProperty("name");
-    }
-    currentNode->setDynamicProperty("name", name);
+    currentNode->setDynamicProperty(currentNode->type()->addDynamicProperty("name"), name);
     nodeMap.insert(name, currentNode);
 }
 
@@ -194,10 +202,7 @@ void DotGraphParsingHelper::createEdge()
         // if necessary create from id
         if (!nodeMap.contains(fromId)) {
             NodePtr from = Node::create(document);
-            from->setDynamicProperty("name", fromId);
-            if (from->dynamicProperties().contains("name")) {
-                from->type()->addDynamicProperty("name");
-            }
+            from->setDynamicProperty(from->type()->addDynamicProperty("name"), fromId);
             nodeMap.insert(fromId, from);
             currentNode = from;
             setNodeAttributes();
@@ -207,10 +212,7 @@ void DotGraphParsingHelper::createEdge()
         // if necessary create to node
         if (!nodeMap.contains(toId)) {
             NodePtr to = Node::create(document);
-            if (to->dynamicProperties().contains("name")) {
-                to->type()->addDynamicProperty("name");
-            }
-            to->setDynamicProperty("name", toId);
+            to->setDynamicProperty(to->type()->addDynamicProperty("name"), toId);
             nodeMap.insert(toId, to);
             currentNode = to;
             setNodeAttributes();
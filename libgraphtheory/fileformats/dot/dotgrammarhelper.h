@@ -22,8 +22,10 @@
 #define DOT_GRAPHPARSINGHELPER_H
 
 #include "typenames.h"
+#include "fileformats/fileformatinterface.h"
 #include <QStringList>
 #include <QObject>
+#include <QHash>
 #include <QMap>
 
 namespace DotParser
@@ -68,6 +70,13 @@ struct DotGraphParsingHelper {
     }
     void setObjectAttributes(QObject *graphElement, const DotParser::DotGraphParsingHelper::AttributesMap &attributes);
 
+    /**
+     * Reports that the parser reached byte \p position of the input to \see format, at most
+     * once per percent of the input.
+     * \return false if the import of \see format was canceled, otherwise true
+     */
+    bool reportProgress(qint64 position);
+
     QString attributeId;
     QString valid;
     std::string attributed; //FIXME change to enum
@@ -85,7 +94,12 @@ struct DotGraphParsingHelper {
     GraphTheory::GraphDocumentPtr document;
     GraphTheory::NodePtr currentNode;
     GraphTheory::EdgePtr currentEdge;
-    QMap<QString, GraphTheory::NodePtr> nodeMap; // for mapping node element ids
+    QHash<QString, GraphTheory::NodePtr> nodeMap; // for mapping node element ids
+
+    GraphTheory::FileFormatInterface *format; // receives progress, may be null
+    std::string::const_iterator inputBegin;
+    qint64 inputSize;
+    qint64 reportedPosition;
 };
 }
 
@@ -22,6 +22,7 @@
 
 #include "typenames.h"
 #include "graphdocument.h"
+#include <QAtomicInt>
 #include <QStringList>
 #include <QObject>
 #include <QUrl>
@@ -42,6 +43,7 @@ public:
     QString lastErrorString;
     GraphDocumentPtr graphDocument;
     QUrl file;
+    QAtomicInt canceled;
 };
 
 
@@ -101,6 +103,17 @@ void FileFormatInterface::setGraphDocument(GraphDocumentPtr document)
 void FileFormatInterface::setFile(const QUrl &file)
 {
     d->file = file;
+    d->canceled.store(0);
+}
+
+void FileFormatInterface::cancel()
+{
+    d->canceled.store(1);
+}
+
+bool FileFormatInterface::isCanceled() const
+{
+    return d->canceled.load() != 0;
 }
 
 const QUrl& FileFormatInterface::file() const
@@ -59,7 +59,8 @@ public:
         NoGraphFound,
         EncodingProblem,
         CouldNotRecognizeFileFormat,
-        NotSupportedOperation
+        NotSupportedOperation,
+        Canceled
     };
 
     /**
@@ -147,6 +148,24 @@ public:
      */
     virtual GraphDocumentPtr graphDocument() const;
 
+    /**
+     * Request to stop a running readFile() call. This method can be called from any thread.
+     * Plugins that support cancellation check isCanceled() regularly and return with error
+     * \see Canceled. The request is reset by \see setFile().
+     */
+    void cancel();
+
+    /**
+     * \return true if cancellation was requested since the last call of \see setFile()
+     */
+    bool isCanceled() const;
+
+Q_SIGNALS:
+    /**
+     * Plugins may emit this signal during readFile() to report that \p value of \p maximum units,
+     * e.g. bytes of the file, are processed.
+     */
+    void progressChanged(qint64 value, qint64 maximum);
 
 protected:
     /**
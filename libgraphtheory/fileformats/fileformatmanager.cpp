@@ -31,6 +31,7 @@
 #include <QJsonArray>
 #include <QJsonObject>
 #include <QMessageBox>
+#include <QRegularExpression>
 
 using namespace GraphTheory;
 
@@ -135,8 +136,11 @@ FileFormatInterface * FileFormatManager::backendByExtension(const QString &ext)
         qCWarning(GRAPHTHEORY_FILEFORMAT) << "File does not contain extension, falling back to default file format";
         return defaultBackend();
     }
+    // match complete suffix, such that e.g. "graph" does not match "*.graph2"
+    const QRegularExpression pattern(QStringLiteral("\\*\\.%1\\b").arg(QRegularExpression::escape(suffix)),
+                                     QRegularExpression::CaseInsensitiveOption);
     foreach(FileFormatInterface * p,  d->backends) {
-        if (p->extensions().join(";").contains(suffix, Qt::CaseInsensitive)) {
+        if (p->extensions().join(";").contains(pattern)) {
             return p;
         }
     }
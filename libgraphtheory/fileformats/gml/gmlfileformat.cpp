@@ -35,8 +35,6 @@
 
 using namespace GraphTheory;
 
-extern GmlParser::GmlGrammarHelper* phelper;
-
 K_PLUGIN_FACTORY_WITH_JSON( FilePluginFactory,
                             "gmlfileformat.json",
                             registerPlugin<GmlFileFormat>();)
@@ -59,6 +57,7 @@ const QStringList GmlFileFormat::extensions() const
 void GmlFileFormat::readFile()
 {
     GraphDocumentPtr document = GraphDocument::create();
+    BatchGuard batch(document);
     setGraphDocument(document);
 
     QList < QPair<QString, QString> > edges;
@@ -69,13 +68,25 @@ void GmlFileFormat::readFile()
         return;
     }
     QString content = fileHandle.readAll();
-    if (!GmlParser::parse(content, document)) { //TODO change interface and pass graph structure
+    const bool parsed = GmlParser::parse(content, document, this); //TODO change interface and pass graph structure
+    if (isCanceled()) {
+        document->destroy();
+        setError(Canceled, i18n("Import of file \"%1\" was canceled.", file().toLocalFile()));
+        return;
+    }
+    if (!parsed) {
         setError(EncodingProblem, i18n("Could not parse file \"%1\".", file().toLocalFile()));
         document->destroy();
         return;
     }
     Topology layouter;
+    layouter.setCancelCondition([this]() { return isCanceled(); });
     layouter.directedGraphDefaultTopology(document);
+    if (isCanceled()) {
+        document->destroy();
+        setError(Canceled, i18n("Import of file \"%1\" was canceled.", file().toLocalFile()));
+        return;
+    }
     setGraphDocument(document);
     setError(None);
 }
@@ -37,23 +37,19 @@ void throw_exception(std::exception const &e)
 namespace GmlParser
 {
 
-GmlGrammarHelper *phelper = nullptr;
-std::string lastKey = std::string();
-QObject * lastInserted = nullptr;
-
-void beginList()
+void beginList(GmlGrammarHelper *helper)
 {
-    phelper->startList(QString::fromStdString(lastKey));
+    helper->startList(QString::fromStdString(helper->lastKey));
 }
 
-void endList()
+void endList(GmlGrammarHelper *helper)
 {
-    phelper->endList();
+    helper->endList();
 }
 
-void gotKey(const std::string& key)
+void gotKey(GmlGrammarHelper *helper, const std::string& key)
 {
-    lastKey = key.c_str();
+    helper->lastKey = key.c_str();
 //   QString k = key.c_str();
 //   if (k.compare("dataType", Qt::CaseInsensitive) == 0){
 //     qCDebug(GRAPHTHEORY_FILEFORMAT) << "create a graph";
@@ -72,20 +68,20 @@ void gotKey(const std::string& key)
 
 }
 
-void gotValue(const std::string& Value)
+void gotValue(GmlGrammarHelper *helper, const std::string& Value)
 {
     if (Value.empty()) {
         return; //end of the list.
     } else {
-        phelper->setAttribute(QString::fromStdString(lastKey), QString::fromStdString(Value));
+        helper->setAttribute(QString::fromStdString(helper->lastKey), QString::fromStdString(Value));
 //     if (lastInserted){
-    if (!lastInserted) {
+    if (!helper->lastInserted) {
         qCCritical(GRAPHTHEORY_FILEFORMAT) << "Cannot specify data node value: internal error";
         return;
     }
-    if (lastKey == "id" && lastInserted){
-        lastInserted->setProperty("name", Value.c_str());
-        phelper->nodeMap.insert(QString::fromStdString(Value), phelper->currentNode);
+    if (helper->lastKey == "id" && helper->lastInserted){
+        helper->lastInserted->setProperty("name", Value.c_str());
+        helper->nodeMap.insert(QString::fromStdString(Value), helper->currentNode);
     }
 //       lastInserted->setProperty(lastKey.c_str(), Value.c_str());
 //     }else{
@@ -95,6 +91,11 @@ void gotValue(const std::string& Value)
 }
 
 
+bool checkProgress(GmlGrammarHelper *helper, std::string::const_iterator position)
+{
+    return helper->reportProgress(position - helper->inputBegin);
+}
+
 void t()
 {
     std::cout << "Found whitespace.\n";
@@ -104,16 +105,17 @@ void t1(const std::string &key)
     std::cout << "Found " << key << ".\n";
 }
 
-bool parse(const QString& content, GraphDocumentPtr document)
+bool parse(const QString& content, GraphDocumentPtr document, FileFormatInterface *format)
 {
     QString tmpContent = content;
     unsigned result;
-    phelper = new GmlGrammarHelper;
-    phelper->document = document;
+    // all parser state lives in the helper of this parse, such that files can be parsed concurrently
+    GmlGrammarHelper helper;
+    helper.document = document;
     typedef std::string::const_iterator iterator_type;
     typedef GmlParser::roman<iterator_type> roman;
 
-    roman roman_parser; // Our grammar
+    roman roman_parser(&helper); // Our grammar
 
     int index;
     while ((index = tmpContent.indexOf('#')) != -1) {
@@ -122,6 +124,9 @@ bool parse(const QString& content, GraphDocumentPtr document)
     std::string str = tmpContent.toStdString();
     iterator_type iter = str.begin();
     iterator_type end = str.end();
+    helper.format = format;
+    helper.inputBegin = iter;
+    helper.inputSize = str.size();
 
     bool r = parse(iter, end, roman_parser, result);
 
@@ -138,7 +143,6 @@ bool parse(const QString& content, GraphDocumentPtr document)
         std::cout << "-------------------------\n";
     }
 
-    delete phelper;
     return r;
 }
 }
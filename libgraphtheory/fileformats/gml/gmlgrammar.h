@@ -28,6 +28,8 @@
 #include <boost/config/warning_disable.hpp>
 #include <boost/spirit/include/qi.hpp>
 #include <boost/spirit/include/phoenix_operator.hpp>
+#include <boost/spirit/include/phoenix_bind.hpp>
+#include <boost/spirit/repository/include/qi_iter_pos.hpp>
 
 #include <iostream>
 #include <string>
@@ -35,42 +37,64 @@
 class Document;
 class QString;
 
+namespace GraphTheory
+{
+class FileFormatInterface;
+}
+
 namespace GmlParser
 {
 namespace qi = boost::spirit::qi;
 namespace ascii = boost::spirit::ascii;
 
 
-void gotKey(const std::string &key);
+struct GmlGrammarHelper;
+
+// semantic actions, each operates on the state of the parse given by helper
+void gotKey(GmlGrammarHelper *helper, const std::string &key);
 
-void gotValue(const std::string &Value);
+void gotValue(GmlGrammarHelper *helper, const std::string &Value);
 
-void beginList();
+void beginList(GmlGrammarHelper *helper);
 
-void endList();
+void endList(GmlGrammarHelper *helper);
 
 void t();
 void t1();
 
-bool parse(const QString &content, GraphTheory::GraphDocumentPtr document);
+/**
+ * Report the parser \p position at the begin of a key value pair to the \p helper of the parse.
+ * \return false if the import was canceled
+ */
+bool checkProgress(GmlGrammarHelper *helper, std::string::const_iterator position);
+
+/**
+ * Parse the GML \p content into \p document. If \p format is given, the parser reports its
+ * progress to \p format and stops as soon as its import is canceled.
+ */
+bool parse(const QString &content, GraphTheory::GraphDocumentPtr document, GraphTheory::FileFormatInterface *format = nullptr);
 
 template <typename Iterator>
 struct roman : boost::spirit::qi::grammar<Iterator, unsigned()> {
-    roman() : roman::base_type(start) {
+    explicit roman(GmlGrammarHelper *helper) : roman::base_type(start) {
     using qi::eps;
     using qi::double_;
     using qi::lexeme;
     using qi::_val;
     using ascii::char_;
     using qi::_1;
+    using qi::_pass;
+    using boost::spirit::repository::qi::iter_pos;
 
     start = List;
     List = -KeyValue >> *(+WhiteSpace >> KeyValue) >> *WhiteSpace;
-    KeyValue = *(WhiteSpace) >> Key[&gotKey] >> +WhiteSpace >> Value[&gotValue] ;
+    // a canceled import fails the key value pair and thereby the whole parse
+    KeyValue = *(WhiteSpace) >> iter_pos[_pass = boost::phoenix::bind(&checkProgress, helper, _1)]
+            >> Key[boost::phoenix::bind(&gotKey, helper, _1)] >> +WhiteSpace >> Value[boost::phoenix::bind(&gotValue, helper, _1)] ;
     Key = (char_("a-zA-Z")[_val += _1] >> *char_("a-zA-Z0-9_")[_val += _1]);
     Value = -Sign[_val += _1] >> +char_("0-9")[_val += _1] >> -((char_('.')[_val += _1] >> +char_("0-9")[_val += _1]))
             | String[_val = _1]
-            | char_('[')[beginList] >> *WhiteSpace >> List >> *WhiteSpace >> char_(']')[endList] ;
+            | char_('[')[boost::phoenix::bind(&beginList, helper)] >> *WhiteSpace >> List >> *WhiteSpace >> char_(']')[boost::phoenix::bind(&endList, helper)] ;
     String = lexeme[char_('"') >> *((char_ - '"') | char_('/'))[_val += _1] >> char_('"')];
     Sign = (char_('+') | char_('-'))[_val += _1];
     WhiteSpace = ascii::space;
@@ -26,8 +26,6 @@
 #include "logging_p.h"
 #include <QFile>
 
-extern GmlParser::GmlGrammarHelper *phelper;
-
 using namespace GraphTheory;
 
 namespace GmlParser
@@ -36,13 +34,32 @@ namespace GmlParser
 GmlGrammarHelper::GmlGrammarHelper():
     edgeSource(),
     edgeTarget(),
-    currentState(begin)
+    currentState(begin),
+    lastInserted(nullptr),
+    format(nullptr),
+    inputSize(0),
+    reportedPosition(0)
 {
     document.reset();
     currentNode.reset();
     currentEdge.reset();
 }
 
+bool GmlGrammarHelper::reportProgress(qint64 position)
+{
+    if (!format) {
+        return true;
+    }
+    if (format->isCanceled()) {
+        return false;
+    }
+    if (position - reportedPosition >= inputSize / 100) {
+        reportedPosition = position;
+        emit format->progressChanged(position, inputSize);
+    }
+    return true;
+}
+
 void GmlGrammarHelper::startList(const QString& key)
 {
     qCDebug(GRAPHTHEORY_FILEFORMAT) << "starting a list with key:" << key;
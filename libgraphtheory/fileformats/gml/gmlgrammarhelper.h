@@ -24,11 +24,12 @@
 
 #include "typenames.h"
 #include "node.h"
+#include "fileformats/fileformatinterface.h"
 #include <map>
 #include <list>
 #include <string>
 #include <QStringList>
-#include <QMap>
+#include <QHash>
 
 namespace GmlParser
 {
@@ -44,6 +45,13 @@ struct GmlGrammarHelper {
     void startList(const QString& key);
 
     void setAttribute(const QString& key, const QString& value);
+
+    /**
+     * Reports that the parser reached byte \p position of the input to \see format, at most
+     * once per percent of the input.
+     * \return false if the import of \see format was canceled, otherwise true
+     */
+    bool reportProgress(qint64 position);
     const QString processKey(const QString& key);
     QString edgeSource;
     QString edgeTarget;
@@ -55,7 +63,14 @@ struct GmlGrammarHelper {
     GraphTheory::EdgePtr currentEdge;
     QStringList attributeStack;
     QHash<QString, QString> edgeAttributes;
-    QMap<QString, GraphTheory::NodePtr> nodeMap; // for mapping data element ids
+    QHash<QString, GraphTheory::NodePtr> nodeMap; // for mapping data element ids
+    std::string lastKey; // key of the value that is parsed next
+    QObject *lastInserted;
+
+    GraphTheory::FileFormatInterface *format; // receives progress, may be null
+    std::string::const_iterator inputBegin;
+    qint64 inputSize;
+    qint64 reportedPosition;
 };
 }
 
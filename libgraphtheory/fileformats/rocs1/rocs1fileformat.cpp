@@ -67,6 +67,7 @@ const QStringList Rocs1FileFormat::extensions() const
 void Rocs1FileFormat::readFile()
 {
     GraphDocumentPtr document = GraphDocument::create();
+    BatchGuard batch(document);
 
     QFile fileHandle(file().toLocalFile());
     document->setDocumentUrl(file());
@@ -198,8 +199,7 @@ void Rocs1FileFormat::readFile()
             }
             if (tmpNode) {
                 tmpNode->setColor(color);
-                tmpNode->setX(posX);
-                tmpNode->setY(posY);
+                tmpNode->setPosition(QPointF(posX, posY));
 
                 // add to data element map
                 QString identifier = str.section(' ', 1);
@@ -27,6 +27,10 @@
 #include "edgetypestyle.h"
 #include "nodetypestyle.h"
 #include <QtTest>
+#include <QSignalSpy>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
 
 using namespace GraphTheory;
 
@@ -155,4 +159,161 @@ void TestRocs2FileFormat::parseVersion1Format()
     QVERIFY2(importer.hasError() == false, importer.errorString().toStdString().c_str());
 }
 
+// test that files with edges before nodes, as written by QJsonDocument, are read correctly
+void TestRocs2FileFormat::edgesBeforeNodesTest()
+{
+    QFile fileHandle("edgesbeforenodes.graph2");
+    QVERIFY(fileHandle.open(QFile::WriteOnly));
+    fileHandle.write(
+        "{\"EdgeTypes\": [{\"Direction\": \"Bidirectional\", \"Id\": 2, \"Name\": \"e\", \"Properties\": [\"w\"]}],"
+        " \"Edges\": [{\"From\": 1, \"Properties\": [{\"Name\": \"w\", \"Value\": \"a\\\"b\\u00e4\"}], \"To\": 3, \"Type\": 2}],"
+        " \"FormatVersion\": 1, \"Unknown\": {\"a\": [1, 2, {\"b\": null}]},"
+        " \"NodeTypes\": [{\"Id\": 4, \"Name\": \"n\", \"Properties\": []}],"
+        " \"Nodes\": [{\"Id\": 1, \"Type\": 4, \"X\": 1.5, \"Y\": -2e1}, {\"Id\": 3, \"Type\": 4, \"X\": 0, \"Y\": 0}]}");
+    fileHandle.close();
+
+    Rocs2FileFormat importer(this, QList<QVariant>());
+    QSignalSpy progressSpy(&importer, SIGNAL(progressChanged(qint64,qint64)));
+    importer.setFile(QUrl::fromLocalFile("edgesbeforenodes.graph2"));
+    importer.readFile();
+    QVERIFY(importer.hasError() == false);
+    QVERIFY(progressSpy.count() > 0);
+    GraphDocumentPtr document = importer.graphDocument();
+
+    QCOMPARE(document->nodes().count(), 2);
+    QCOMPARE(document->node(1)->x(), qreal(1.5));
+    QCOMPARE(document->node(1)->y(), qreal(-20));
+    QCOMPARE(document->edges().count(), 1);
+    EdgePtr edge = document->edges().first();
+    QVERIFY(edge->from() == document->node(1));
+    QVERIFY(edge->to() == document->node(3));
+    QCOMPARE(edge->type()->id(), 2);
+    QCOMPARE(edge->type()->direction(), EdgeType::Bidirectional);
+    QCOMPARE(edge->dynamicProperty("w").toString(), QString::fromUtf8("a\"b\xc3\xa4"));
+}
+
+// test that dynamic property values keep their value types on re-import
+void TestRocs2FileFormat::typedValuesTest()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    NodeTypePtr nodeType = document->nodeTypes().first();
+    nodeType->setId(1);
+    nodeType->addDynamicProperty("real");
+    nodeType->addDynamicProperty("integer");
+    nodeType->addDynamicProperty("boolean");
+    nodeType->addDynamicProperty("string");
+    EdgeTypePtr edgeType = document->edgeTypes().first();
+    edgeType->setId(1);
+    edgeType->addDynamicProperty("weight");
+
+    NodePtr from = Node::create(document);
+    from->setId(1);
+    from->setDynamicProperty("real", qreal(0.1));
+    from->setDynamicProperty("integer", 42);
+    from->setDynamicProperty("boolean", true);
+    from->setDynamicProperty("string", "3");
+    NodePtr to = Node::create(document);
+    to->setId(2);
+    to->setDynamicProperty("real", qreal(2));
+    Edge::create(from, to)->setDynamicProperty("weight", qreal(1.25));
+
+    Rocs2FileFormat serializer(this, QList<QVariant>());
+    serializer.setFile(QUrl::fromLocalFile("typedvalues.graph2"));
+    serializer.writeFile(document);
+    QVERIFY(serializer.hasError() == false);
+
+    Rocs2FileFormat importer(this, QList<QVariant>());
+    importer.setFile(QUrl::fromLocalFile("typedvalues.graph2"));
+    importer.readFile();
+    QVERIFY(importer.hasError() == false);
+    GraphDocumentPtr importDocument = importer.graphDocument();
+
+    NodePtr node = importDocument->node(1);
+    QVERIFY(node);
+    QCOMPARE(node->dynamicProperty("real").userType(), int(QMetaType::Double));
+    QCOMPARE(node->dynamicProperty("real").toDouble(), qreal(0.1));
+    QCOMPARE(node->dynamicProperty("integer").userType(), int(QMetaType::Int));
+    QCOMPARE(node->dynamicProperty("integer").toInt(), 42);
+    QCOMPARE(node->dynamicProperty("boolean").userType(), int(QMetaType::Bool));
+    QCOMPARE(node->dynamicProperty("boolean").toBool(), true);
+    QCOMPARE(node->dynamicProperty("string").userType(), int(QMetaType::QString));
+    QCOMPARE(node->dynamicProperty("string").toString(), QString("3"));
+    QCOMPARE(importDocument->node(2)->dynamicProperty("real").userType(), int(QMetaType::Double));
+    QVERIFY(!importDocument->node(2)->dynamicProperty("integer").isValid());
+
+    QCOMPARE(importDocument->edges().count(), 1);
+    QCOMPARE(importDocument->edges().first()->dynamicProperty("weight").userType(), int(QMetaType::Double));
+    QCOMPARE(importDocument->edges().first()->dynamicProperty("weight").toDouble(), qreal(1.25));
+
+    document->destroy();
+    importDocument->destroy();
+}
+
+// test that malformed files are rejected instead of being loaded partially
+void TestRocs2FileFormat::malformedFileTest()
+{
+    QFile fileHandle("malformed.graph2");
+    QVERIFY(fileHandle.open(QFile::WriteOnly));
+    fileHandle.write(
+        "{\"FormatVersion\": 2,"
+        " \"NodeTypes\": [{\"Id\": 1, \"Name\": \"n\", \"Properties\": []}],"
+        " \"Nodes\": [{\"Id\": 1, \"Type\": 1, \"X\": 0, \"Y\": 0}, {\"Id\": 2, \"Type\": 1, \"X\": ");
+    fileHandle.close();
+
+    Rocs2FileFormat importer(this, QList<QVariant>());
+    importer.setFile(QUrl::fromLocalFile("malformed.graph2"));
+    importer.readFile();
+    QVERIFY(importer.hasError());
+    QCOMPARE(importer.error(), FileFormatInterface::EncodingProblem);
+    QVERIFY(!importer.graphDocument());
+}
+
+// test that typed values are readable without schema and that newer versions are rejected
+void TestRocs2FileFormat::formatVersionTest()
+{
+    // values of typed properties are strings, as expected by readers of version 1
+    GraphDocumentPtr document = GraphDocument::create();
+    document->nodeTypes().first()->addDynamicProperty("real");
+    Node::create(document)->setDynamicProperty("real", qreal(0.1));
+    Rocs2FileFormat serializer(this, QList<QVariant>());
+    serializer.setFile(QUrl::fromLocalFile("formatversion.graph2"));
+    serializer.writeFile(document);
+    QVERIFY(serializer.hasError() == false);
+    document->destroy();
+
+    QFile fileHandle("formatversion.graph2");
+    QVERIFY(fileHandle.open(QFile::ReadOnly));
+    const QJsonObject json = QJsonDocument::fromJson(fileHandle.readAll()).object();
+    fileHandle.close();
+    const QJsonObject property = json["Nodes"].toArray().first().toObject()["Properties"].toArray().first().toObject();
+    QVERIFY(property["Value"].isString());
+    QCOMPARE(property["Value"].toString().toDouble(), qreal(0.1));
+
+    // files of the typed writer of version 2 with JSON numbers remain readable
+    QVERIFY(fileHandle.open(QFile::WriteOnly));
+    fileHandle.write(
+        "{\"FormatVersion\": 2,"
+        " \"NodeTypes\": [{\"Id\": 1, \"Name\": \"n\", \"Properties\": [\"a\", \"b\"], \"PropertyTypes\": {\"a\": \"Real\"}}],"
+        " \"Nodes\": [{\"Id\": 1, \"Type\": 1, \"X\": 0, \"Y\": 0, \"Properties\": [{\"Name\": \"a\", \"Value\": 1.5}, {\"Name\": \"b\", \"Value\": 7}]}]}");
+    fileHandle.close();
+    Rocs2FileFormat importer(this, QList<QVariant>());
+    importer.setFile(QUrl::fromLocalFile("formatversion.graph2"));
+    importer.readFile();
+    QVERIFY(importer.hasError() == false);
+    GraphDocumentPtr importDocument = importer.graphDocument();
+    QCOMPARE(importDocument->node(1)->dynamicProperty("a").toDouble(), qreal(1.5));
+    QCOMPARE(importDocument->node(1)->dynamicProperty("b").toString(), QString("7"));
+    importDocument->destroy();
+
+    // newer versions are rejected instead of being misread
+    QVERIFY(fileHandle.open(QFile::WriteOnly));
+    fileHandle.write("{\"FormatVersion\": 3, \"Nodes\": []}");
+    fileHandle.close();
+    Rocs2FileFormat newerImporter(this, QList<QVariant>());
+    newerImporter.setFile(QUrl::fromLocalFile("formatversion.graph2"));
+    newerImporter.readFile();
+    QCOMPARE(newerImporter.error(), FileFormatInterface::NotSupportedOperation);
+    QVERIFY(!newerImporter.graphDocument());
+}
+
 QTEST_MAIN(TestRocs2FileFormat);
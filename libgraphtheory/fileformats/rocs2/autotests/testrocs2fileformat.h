@@ -33,6 +33,10 @@ private slots:
     void documentTypesTest();
     void nodeAndEdgeTest();
     void parseVersion1Format();
+    void edgesBeforeNodesTest();
+    void typedValuesTest();
+    void malformedFileTest();
+    void formatVersionTest();
 };
 
 #endif
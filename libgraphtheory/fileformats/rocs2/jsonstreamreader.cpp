@@ -0,0 +1,407 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "jsonstreamreader.h"
+#include <KLocalizedString>
+#include <QIODevice>
+#include <QVariantList>
+#include <QVariantMap>
+
+using namespace GraphTheory;
+
+namespace
+{
+const qint64 chunkSize = 64 * 1024;
+}
+
+JsonStreamReader::JsonStreamReader(QIODevice *device)
+    : m_device(device)
+    , m_position(0)
+    , m_consumed(0)
+    , m_tokenType(NoToken)
+    , m_number(0)
+    , m_boolean(false)
+    , m_expectName(false)
+    , m_afterValue(false)
+    , m_afterOpen(false)
+{
+}
+
+JsonStreamReader::TokenType JsonStreamReader::readNext()
+{
+    if (m_tokenType == Error || m_tokenType == EndDocument) {
+        return m_tokenType;
+    }
+
+    char c;
+    const bool hasInput = skipWhitespace(c);
+    if (m_afterValue) {
+        if (m_stack.isEmpty()) {
+            if (hasInput) {
+                return setError(i18n("Unexpected content after end of JSON document."));
+            }
+            return m_tokenType = EndDocument;
+        }
+        if (!hasInput) {
+            return setError(i18n("Unexpected end of JSON document."));
+        }
+        const char container = m_stack.last();
+        if ((c == '}' && container == '{') || (c == ']' && container == '[')) {
+            ++m_position;
+            m_stack.removeLast();
+            return m_tokenType = (c == '}') ? EndObject : EndArray;
+        }
+        if (c != ',') {
+            return setError(i18n("Expected separator in JSON document at byte %1.", bytesRead()));
+        }
+        ++m_position;
+        m_afterValue = false;
+        m_expectName = (container == '{');
+        if (!skipWhitespace(c)) {
+            return setError(i18n("Unexpected end of JSON document."));
+        }
+    } else if (!hasInput) {
+        if (m_stack.isEmpty() && m_tokenType == NoToken) {
+            return m_tokenType = EndDocument;
+        }
+        return setError(i18n("Unexpected end of JSON document."));
+    }
+
+    // containers may be closed directly after they were opened
+    if (m_afterOpen) {
+        m_afterOpen = false;
+        const char container = m_stack.last();
+        if ((c == '}' && container == '{') || (c == ']' && container == '[')) {
+            ++m_position;
+            m_stack.removeLast();
+            m_expectName = false;
+            m_afterValue = true;
+            return m_tokenType = (c == '}') ? EndObject : EndArray;
+        }
+    }
+
+    if (m_expectName) {
+        if (c != '"') {
+            return setError(i18n("Expected member name in JSON document at byte %1.", bytesRead()));
+        }
+        ++m_position;
+        if (readString(Name) == Error) {
+            return Error;
+        }
+        if (!skipWhitespace(c) || c != ':') {
+            return setError(i18n("Expected ':' in JSON document at byte %1.", bytesRead()));
+        }
+        ++m_position;
+        m_expectName = false;
+        return m_tokenType;
+    }
+
+    switch (c) {
+    case '{':
+        ++m_position;
+        m_stack.append('{');
+        m_expectName = true;
+        m_afterOpen = true;
+        return m_tokenType = StartObject;
+    case '[':
+        ++m_position;
+        m_stack.append('[');
+        m_afterOpen = true;
+        return m_tokenType = StartArray;
+    case '"':
+        ++m_position;
+        m_afterValue = true;
+        return readString(String);
+    case 't':
+    case 'f':
+    case 'n':
+        m_afterValue = true;
+        return readLiteral();
+    default:
+        if (c == '-' || (c >= '0' && c <= '9')) {
+            m_afterValue = true;
+            return readNumber();
+        }
+        return setError(i18n("Unexpected character in JSON document at byte %1.", bytesRead()));
+    }
+}
+
+JsonStreamReader::TokenType JsonStreamReader::tokenType() const
+{
+    return m_tokenType;
+}
+
+QString JsonStreamReader::text() const
+{
+    return m_text;
+}
+
+double JsonStreamReader::number() const
+{
+    return m_number;
+}
+
+bool JsonStreamReader::boolean() const
+{
+    return m_boolean;
+}
+
+QVariant JsonStreamReader::value() const
+{
+    switch (m_tokenType) {
+    case String:
+        return m_text;
+    case Number:
+        return m_number;
+    case Bool:
+        return m_boolean;
+    default:
+        return QVariant();
+    }
+}
+
+QVariant JsonStreamReader::readValue()
+{
+    if (m_tokenType == StartObject) {
+        QVariantMap map;
+        while (readNext() == Name) {
+            const QString name = m_text;
+            readNext();
+            map.insert(name, readValue());
+        }
+        return m_tokenType == EndObject ? QVariant(map) : QVariant();
+    }
+    if (m_tokenType == StartArray) {
+        QVariantList list;
+        forever {
+            const TokenType type = readNext();
+            if (type == EndArray) {
+                return list;
+            }
+            if (type == Error || type == EndDocument) {
+                return QVariant();
+            }
+            list.append(readValue());
+        }
+    }
+    return value();
+}
+
+void JsonStreamReader::skipValue()
+{
+    if (m_tokenType != StartObject && m_tokenType != StartArray) {
+        return;
+    }
+    int depth = 1;
+    while (depth > 0) {
+        switch (readNext()) {
+        case StartObject:
+        case StartArray:
+            ++depth;
+            break;
+        case EndObject:
+        case EndArray:
+            --depth;
+            break;
+        case Error:
+        case EndDocument:
+            return;
+        default:
+            break;
+        }
+    }
+}
+
+bool JsonStreamReader::hasError() const
+{
+    return m_tokenType == Error;
+}
+
+QString JsonStreamReader::errorString() const
+{
+    return m_errorString;
+}
+
+qint64 JsonStreamReader::bytesRead() const
+{
+    return m_consumed + m_position;
+}
+
+bool JsonStreamReader::fillBuffer()
+{
+    if (m_position < m_buffer.size()) {
+        return true;
+    }
+    m_consumed += m_buffer.size();
+    m_buffer = m_device->read(chunkSize);
+    m_position = 0;
+    return !m_buffer.isEmpty();
+}
+
+bool JsonStreamReader::peek(char &c)
+{
+    if (!fillBuffer()) {
+        return false;
+    }
+    c = m_buffer.at(m_position);
+    return true;
+}
+
+bool JsonStreamReader::skipWhitespace(char &c)
+{
+    while (peek(c)) {
+        if (c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+            return true;
+        }
+        ++m_position;
+    }
+    return false;
+}
+
+bool JsonStreamReader::readHex(ushort &code)
+{
+    code = 0;
+    for (int i = 0; i < 4; ++i) {
+        char c;
+        if (!peek(c)) {
+            return false;
+        }
+        ++m_position;
+        code <<= 4;
+        if (c >= '0' && c <= '9') {
+            code += c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            code += c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            code += c - 'A' + 10;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+JsonStreamReader::TokenType JsonStreamReader::readString(TokenType type)
+{
+    // collect UTF-8 encoded bytes, escape sequences are appended in UTF-8 encoding
+    QByteArray bytes;
+    forever {
+        if (!fillBuffer()) {
+            return setError(i18n("Unterminated string in JSON document."));
+        }
+        const char *data = m_buffer.constData();
+        const int size = m_buffer.size();
+        const int start = m_position;
+        while (m_position < size && data[m_position] != '"' && data[m_position] != '\\') {
+            ++m_position;
+        }
+        bytes.append(data + start, m_position - start);
+        if (m_position == size) {
+            continue;
+        }
+        if (data[m_position] == '"') {
+            ++m_position;
+            break;
+        }
+
+        // escape sequence
+        ++m_position;
+        char c;
+        if (!peek(c)) {
+            return setError(i18n("Unterminated string in JSON document."));
+        }
+        ++m_position;
+        switch (c) {
+        case 'b': bytes.append('\b'); break;
+        case 'f': bytes.append('\f'); break;
+        case 'n': bytes.append('\n'); break;
+        case 'r': bytes.append('\r'); break;
+        case 't': bytes.append('\t'); break;
+        case 'u': {
+            ushort code;
+            if (!readHex(code)) {
+                return setError(i18n("Invalid unicode escape sequence in JSON document at byte %1.", bytesRead()));
+            }
+            QString character(QChar(code));
+            if (QChar::isHighSurrogate(code)) {
+                // characters outside the BMP are escaped as surrogate pair
+                ushort low = 0;
+                for (const char expected : {'\\', 'u'}) {
+                    if (!peek(c) || c != expected) {
+                        return setError(i18n("Invalid unicode escape sequence in JSON document at byte %1.", bytesRead()));
+                    }
+                    ++m_position;
+                }
+                if (!readHex(low) || !QChar::isLowSurrogate(low)) {
+                    return setError(i18n("Invalid unicode escape sequence in JSON document at byte %1.", bytesRead()));
+                }
+                character.append(QChar(low));
+            }
+            bytes.append(character.toUtf8());
+            break;
+        }
+        default:
+            // covers '"', '\\' and '/'
+            bytes.append(c);
+        }
+    }
+    m_text = QString::fromUtf8(bytes);
+    return m_tokenType = type;
+}
+
+JsonStreamReader::TokenType JsonStreamReader::readNumber()
+{
+    QByteArray bytes;
+    char c;
+    while (peek(c) && ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')) {
+        bytes.append(c);
+        ++m_position;
+    }
+    bool ok;
+    m_number = bytes.toDouble(&ok);
+    if (!ok) {
+        return setError(i18n("Invalid number in JSON document at byte %1.", bytesRead()));
+    }
+    return m_tokenType = Number;
+}
+
+JsonStreamReader::TokenType JsonStreamReader::readLiteral()
+{
+    QByteArray bytes;
+    char c;
+    while (peek(c) && c >= 'a' && c <= 'z') {
+        bytes.append(c);
+        ++m_position;
+    }
+    if (bytes == "true" || bytes == "false") {
+        m_boolean = (bytes == "true");
+        return m_tokenType = Bool;
+    }
+    if (bytes == "null") {
+        return m_tokenType = Null;
+    }
+    return setError(i18n("Invalid literal in JSON document at byte %1.", bytesRead()));
+}
+
+JsonStreamReader::TokenType JsonStreamReader::setError(const QString &message)
+{
+    m_errorString = message;
+    return m_tokenType = Error;
+}
@@ -0,0 +1,139 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef JSONSTREAMREADER_H
+#define JSONSTREAMREADER_H
+
+#include <QByteArray>
+#include <QString>
+#include <QVariant>
+#include <QVector>
+
+class QIODevice;
+
+namespace GraphTheory
+{
+
+/**
+ * \class JsonStreamReader
+ * Pull parser for JSON documents, similar to QXmlStreamReader. The device is read in chunks of
+ * fixed size, such that documents can be processed without holding them in memory.
+ *
+ * Usage: call readNext() until it returns EndDocument or Error. Object member names are reported
+ * as Name tokens, followed by the tokens of the member value.
+ */
+class JsonStreamReader
+{
+public:
+    enum TokenType {
+        NoToken,
+        StartObject,
+        EndObject,
+        StartArray,
+        EndArray,
+        Name,
+        String,
+        Number,
+        Bool,
+        Null,
+        EndDocument,
+        Error
+    };
+
+    explicit JsonStreamReader(QIODevice *device);
+
+    /**
+     * Read next token.
+     * @return type of the read token
+     */
+    TokenType readNext();
+
+    /**
+     * @return type of the current token
+     */
+    TokenType tokenType() const;
+
+    /**
+     * @return text of current Name or String token
+     */
+    QString text() const;
+
+    /**
+     * @return value of current Number token
+     */
+    double number() const;
+
+    /**
+     * @return value of current Bool token
+     */
+    bool boolean() const;
+
+    /**
+     * @return value of current String, Number or Bool token, invalid QVariant otherwise
+     */
+    QVariant value() const;
+
+    /**
+     * Read the complete value that starts with the current token, including all nested values
+     * of objects and arrays, and convert it to QVariantMap, QVariantList or scalar QVariant.
+     */
+    QVariant readValue();
+
+    /**
+     * Skip the complete value that starts with the current token, such that the next call of
+     * readNext() returns the token after this value.
+     */
+    void skipValue();
+
+    bool hasError() const;
+    QString errorString() const;
+
+    /**
+     * @return number of bytes consumed from the device
+     */
+    qint64 bytesRead() const;
+
+private:
+    bool fillBuffer();
+    bool peek(char &c);
+    bool skipWhitespace(char &c);
+    bool readHex(ushort &code);
+    TokenType readString(TokenType type);
+    TokenType readNumber();
+    TokenType readLiteral();
+    TokenType setError(const QString &message);
+
+    QIODevice *m_device;
+    QByteArray m_buffer;
+    int m_position;
+    qint64 m_consumed; // bytes of already discarded buffers
+    TokenType m_tokenType;
+    QString m_text;
+    double m_number;
+    bool m_boolean;
+    QString m_errorString;
+    QVector<char> m_stack; // open containers, '{' or '['
+    bool m_expectName; // inside an object and a member name is expected
+    bool m_afterValue; // a complete value was read, separator or end of container expected
+    bool m_afterOpen; // container was just opened, it may be closed immediately
+};
+}
+
+#endif
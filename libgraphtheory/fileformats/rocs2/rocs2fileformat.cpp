@@ -26,17 +26,40 @@
 #include "edge.h"
 #include "edgetypestyle.h"
 #include "nodetypestyle.h"
+#include "propertytable.h"
 #include "logging_p.h"
+#include "jsonstreamreader.h"
 #include <KLocalizedString>
 #include <KPluginFactory>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QFile>
+#include <QHash>
 #include <QUrl>
 
 using namespace GraphTheory;
 
+namespace
+{
+// size of the output buffer after which serialized elements are written to the file
+const int bufferSize = 1024 * 1024;
+
+// latest version of the format; version 2 adds the value types of dynamic properties, values
+// are still written as strings such that readers of version 1 files can load them
+const int formatVersion = 2;
+
+// shortest decimal representation of @p value that is read back as the same value
+QString realToString(qreal value)
+{
+    const QString text = QString::number(value, 'g', 15);
+    if (text.toDouble() == value) {
+        return text;
+    }
+    return QString::number(value, 'g', 17);
+}
+}
+
 K_PLUGIN_FACTORY_WITH_JSON( FilePluginFactory,
                             "rocs2fileformat.json",
                             registerPlugin<Rocs2FileFormat>();)
@@ -63,10 +86,10 @@ void Rocs2FileFormat::readFile()
         setError(CouldNotOpenFile, i18n("Could not open file \"%1\" in read mode: %2", file().toLocalFile(), fileHandle.errorString()));
         return;
     }
-    const QByteArray fileContent = fileHandle.readAll();
 
     // gracefully handle empty documents: return a new one with default types
-    if (fileContent.isEmpty()) {
+    const qint64 fileSize = fileHandle.size();
+    if (fileSize == 0) {
         setGraphDocument(GraphDocument::create());
         setError(None);
         return;
@@ -74,135 +97,284 @@ void Rocs2FileFormat::readFile()
 
     // cleanup default
     GraphDocumentPtr document = GraphDocument::create();
+    BatchGuard batch(document);
     document->remove(document->nodeTypes().first());
     document->remove(document->edgeTypes().first());
 
-    QJsonDocument jsonDoc = QJsonDocument::fromJson(fileContent);
-    QJsonObject jsonObj = jsonDoc.object();
-
-    // check format
-    int formatVersion = jsonObj["FormatVersion"].toInt();
-    if (formatVersion > 1) {
-        qCCritical(GRAPHTHEORY_FILEFORMAT) << "File format has version" << formatVersion << "which is higher than the latest supported version.";
-    }
-
-    // import node types
-    QJsonArray nodeTypesJson = jsonObj["NodeTypes"].toArray();
-    for (int index = 0; index < nodeTypesJson.count(); ++index) {
-        QJsonObject typeJson = nodeTypesJson.at(index).toObject();
-        NodeTypePtr type = NodeType::create(document);
-        type->setId(typeJson["Id"].toInt());
-        type->setName(typeJson["Name"].toString());
-        type->style()->setColor(QColor(typeJson["Color"].toString()));
-        type->style()->setVisible(typeJson["Visible"].toBool());
-        type->style()->setPropertyNamesVisible(typeJson["PropertyNamesVisible"].toBool());
-
-        QJsonArray propertiesJson = typeJson["Properties"].toArray();
-        for (int pIndex = 0; pIndex < propertiesJson.count(); ++pIndex) {
-            type->addDynamicProperty(propertiesJson.at(pIndex).toString());
+    // the file is parsed as stream, elements are created as soon as they are read
+    JsonStreamReader reader(&fileHandle);
+    QHash<int, NodeTypePtr> nodeTypes;
+    QHash<int, EdgeTypePtr> edgeTypes;
+    QHash<int, PropertySchema> nodeSchemas;
+    QHash<int, PropertySchema> edgeSchemas;
+    QVector<EdgeRecord> pendingEdges; // edges that are read before the nodes
+    bool nodesRead = false;
+    qint64 nextProgress = 0;
+    const qint64 progressStep = qMax<qint64>(fileSize / 100, 1);
+    auto reportProgress = [&] () {
+        if (reader.bytesRead() >= nextProgress) {
+            nextProgress = reader.bytesRead() + progressStep;
+            emit progressChanged(reader.bytesRead(), fileSize);
+        }
+    };
+
+    if (reader.readNext() == JsonStreamReader::StartObject) {
+        while (reader.readNext() == JsonStreamReader::Name) {
+            const QString section = reader.text();
+            reader.readNext();
+
+            if (section == QLatin1String("FormatVersion")) {
+                const int version = reader.value().toInt();
+                if (version > formatVersion) {
+                    qCCritical(GRAPHTHEORY_FILEFORMAT) << "File format has version" << version << "which is higher than the latest supported version.";
+                    document->destroy();
+                    setError(NotSupportedOperation, i18n("File \"%1\" has format version %2, but only versions up to %3 are supported.",
+                        file().toLocalFile(), version, formatVersion));
+                    return;
+                }
+            } else if (section == QLatin1String("NodeTypes") && reader.tokenType() == JsonStreamReader::StartArray) {
+                while (reader.readNext() == JsonStreamReader::StartObject) {
+                    const QVariantMap typeJson = reader.readValue().toMap();
+                    NodeTypePtr type = NodeType::create(document);
+                    type->setId(typeJson["Id"].toInt());
+                    type->setName(typeJson["Name"].toString());
+                    type->style()->setColor(QColor(typeJson["Color"].toString()));
+                    type->style()->setVisible(typeJson["Visible"].toBool());
+                    type->style()->setPropertyNamesVisible(typeJson["PropertyNamesVisible"].toBool());
+                    foreach (const QVariant &property, typeJson["Properties"].toList()) {
+                        type->addDynamicProperty(property.toString());
+                    }
+                    nodeTypes.insert(type->id(), type);
+                    nodeSchemas.insert(type->id(), readSchema(typeJson));
+                }
+            } else if (section == QLatin1String("EdgeTypes") && reader.tokenType() == JsonStreamReader::StartArray) {
+                while (reader.readNext() == JsonStreamReader::StartObject) {
+                    const QVariantMap typeJson = reader.readValue().toMap();
+                    EdgeTypePtr type = EdgeType::create(document);
+                    type->setId(typeJson["Id"].toInt());
+                    type->setName(typeJson["Name"].toString());
+                    type->style()->setColor(QColor(typeJson["Color"].toString()));
+                    type->style()->setVisible(typeJson["Visible"].toBool());
+                    type->style()->setPropertyNamesVisible(typeJson["PropertyNamesVisible"].toBool());
+                    type->setDirection(direction(typeJson["Direction"].toString()));
+                    foreach (const QVariant &property, typeJson["Properties"].toList()) {
+                        type->addDynamicProperty(property.toString());
+                    }
+                    edgeTypes.insert(type->id(), type);
+                    edgeSchemas.insert(type->id(), readSchema(typeJson));
+                }
+            } else if (section == QLatin1String("Nodes") && reader.tokenType() == JsonStreamReader::StartArray) {
+                while (reader.readNext() == JsonStreamReader::StartObject) {
+                    NodeRecord record;
+                    readNode(reader, record);
+                    createNode(document, record, nodeTypes, nodeSchemas);
+                    reportProgress();
+                    if (isCanceled()) {
+                        break;
+                    }
+                }
+                nodesRead = true;
+            } else if (section == QLatin1String("Edges") && reader.tokenType() == JsonStreamReader::StartArray) {
+                while (reader.readNext() == JsonStreamReader::StartObject) {
+                    EdgeRecord record;
+                    readEdge(reader, record);
+                    if (nodesRead) {
+                        createEdge(document, record, edgeTypes, edgeSchemas);
+                    } else {
+                        pendingEdges.append(record);
+                    }
+                    reportProgress();
+                    if (isCanceled()) {
+                        break;
+                    }
+                }
+            } else {
+                reader.skipValue();
+            }
+            if (isCanceled()) {
+                document->destroy();
+                setError(Canceled, i18n("Import of file \"%1\" was canceled.", file().toLocalFile()));
+                return;
+            }
         }
     }
+    if (reader.hasError()) {
+        qCCritical(GRAPHTHEORY_FILEFORMAT) << "Error while parsing file:" << reader.errorString();
+        document->destroy();
+        setError(EncodingProblem, i18n("Could not parse file \"%1\": %2", file().toLocalFile(), reader.errorString()));
+        return;
+    }
 
-    // import edge types
-    QJsonArray edgeTypesJson = jsonObj["EdgeTypes"].toArray();
-    for (int index = 0; index < edgeTypesJson.count(); ++index) {
-        QJsonObject typeJson = edgeTypesJson.at(index).toObject();
-        EdgeTypePtr type = EdgeType::create(document);
-        type->setId(typeJson["Id"].toInt());
-        type->setName(typeJson["Name"].toString());
-        type->style()->setColor(QColor(typeJson["Color"].toString()));
-        type->style()->setVisible(typeJson["Visible"].toBool());
-        type->style()->setPropertyNamesVisible(typeJson["PropertyNamesVisible"].toBool());
-        type->setDirection(direction(typeJson["Direction"].toString()));
-
-        QJsonArray propertiesJson = typeJson["Properties"].toArray();
-        for (int pIndex = 0; pIndex < propertiesJson.count(); ++pIndex) {
-            type->addDynamicProperty(propertiesJson.at(pIndex).toString());
-        }
+    // ensure that default types exist, even for incomplete files
+    if (document->nodeTypes().isEmpty()) {
+        NodeType::create(document);
     }
+    if (document->edgeTypes().isEmpty()) {
+        EdgeType::create(document);
+    }
+    foreach (const EdgeRecord &record, pendingEdges) {
+        createEdge(document, record, edgeTypes, edgeSchemas);
+    }
+    emit progressChanged(fileSize, fileSize);
 
-    // import nodes
-    QJsonArray nodesJson = jsonObj["Nodes"].toArray();
-    for (int index = 0; index < nodesJson.count(); ++index) {
-        QJsonObject nodeJson = nodesJson.at(index).toObject();
-        NodePtr node = Node::create(document);
+    setGraphDocument(document);
+    setError(None);
+}
 
-        // set type
-        NodeTypePtr typeToSet;
-        //TODO this is not very efficient for big files: use table instead to cache IDs
-        foreach (NodeTypePtr type, document->nodeTypes()) {
-            if (type->id() == nodeJson["Type"].toInt()) {
-                typeToSet = type;
-                break;
-            }
-        }
-        if (!typeToSet) {
-            qCCritical(GRAPHTHEORY_FILEFORMAT) << "No type found with this ID, defaulting to first found type";
-            typeToSet = document->nodeTypes().first();
-        }
-        node->setType(typeToSet);
-
-        // further properties
-        node->setId(nodeJson["Id"].toInt());
-        node->setX(nodeJson["X"].toDouble());
-        node->setY(nodeJson["Y"].toDouble());
-        node->setColor(QColor(nodeJson["Color"].toString()));
-
-        QJsonArray propertiesJson = nodeJson["Properties"].toArray();
-        for (int pIndex = 0; pIndex < propertiesJson.count(); ++pIndex) {
-            QJsonObject propertyJson = propertiesJson.at(pIndex).toObject();
-            node->setDynamicProperty(propertyJson["Name"].toString(), propertyJson["Value"].toString());
+void Rocs2FileFormat::readNode(JsonStreamReader &reader, NodeRecord &record) const
+{
+    while (reader.readNext() == JsonStreamReader::Name) {
+        const QString name = reader.text();
+        reader.readNext();
+        if (name == QLatin1String("Id")) {
+            record.id = reader.value().toInt();
+        } else if (name == QLatin1String("Type")) {
+            record.type = reader.value().toInt();
+        } else if (name == QLatin1String("X")) {
+            record.x = reader.value().toDouble();
+        } else if (name == QLatin1String("Y")) {
+            record.y = reader.value().toDouble();
+        } else if (name == QLatin1String("Color")) {
+            record.color = reader.value().toString();
+        } else if (name == QLatin1String("Properties")) {
+            readProperties(reader, record.properties);
+        } else {
+            reader.skipValue();
         }
     }
+}
 
-    // import edges
-    QJsonArray edgesJson = jsonObj["Edges"].toArray();
-    for (int index = 0; index < edgesJson.count(); ++index) {
-        QJsonObject edgeJson = edgesJson.at(index).toObject();
-
-        // find nodes to connect to
-        NodePtr fromNode, toNode;
-        //TODO this is not very efficient for big files: use table instead to cache IDs
-        foreach (NodePtr node, document->nodes()) {
-            if (node->id() == edgeJson["From"].toInt()) {
-                fromNode = node;
-            }
-            if (node->id() == edgeJson["To"].toInt()) {
-                toNode = node;
-            }
-        }
-        if (!fromNode || !toNode) {
-            qCCritical(GRAPHTHEORY_FILEFORMAT) << "No type found with this ID, aborting edge from"
-                << edgeJson["From"].toInt() << "to" << edgeJson["To"].toInt();
-            continue;
+void Rocs2FileFormat::readEdge(JsonStreamReader &reader, EdgeRecord &record) const
+{
+    while (reader.readNext() == JsonStreamReader::Name) {
+        const QString name = reader.text();
+        reader.readNext();
+        if (name == QLatin1String("From")) {
+            record.from = reader.value().toInt();
+        } else if (name == QLatin1String("To")) {
+            record.to = reader.value().toInt();
+        } else if (name == QLatin1String("Type")) {
+            record.type = reader.value().toInt();
+        } else if (name == QLatin1String("Properties")) {
+            readProperties(reader, record.properties);
+        } else {
+            reader.skipValue();
         }
-        EdgePtr edge = Edge::create(fromNode, toNode);
-
-        // set type
-        EdgeTypePtr typeToSet;
-        //TODO this is not very efficient for big files: use table instead to cache IDs
-        foreach (EdgeTypePtr type, document->edgeTypes()) {
-            if (type->id() == edgeJson["Type"].toInt()) {
-                typeToSet = type;
-                break;
+    }
+}
+
+void Rocs2FileFormat::readProperties(JsonStreamReader &reader, QVector<QPair<QString, QVariant>> &properties) const
+{
+    if (reader.tokenType() != JsonStreamReader::StartArray) {
+        reader.skipValue();
+        return;
+    }
+    while (reader.readNext() == JsonStreamReader::StartObject) {
+        QPair<QString, QVariant> property;
+        while (reader.readNext() == JsonStreamReader::Name) {
+            const QString name = reader.text();
+            reader.readNext();
+            if (name == QLatin1String("Name")) {
+                property.first = reader.value().toString();
+            } else if (name == QLatin1String("Value")) {
+                // keep the JSON value type, conversion to the declared type happens at creation
+                property.second = reader.value();
+            } else {
+                reader.skipValue();
             }
         }
-        if (!typeToSet) {
-            qCCritical(GRAPHTHEORY_FILEFORMAT) << "No type found with this ID, defaulting to first found type";
-            typeToSet = document->edgeTypes().first();
-        }
-        edge->setType(typeToSet);
+        properties.append(property);
+    }
+}
 
-        // set dynamic properties
-        QJsonArray propertiesJson = edgeJson["Properties"].toArray();
-        for (int pIndex = 0; pIndex < propertiesJson.count(); ++pIndex) {
-            QJsonObject propertyJson = propertiesJson.at(pIndex).toObject();
-            edge->setDynamicProperty(propertyJson["Name"].toString(), propertyJson["Value"].toString());
+Rocs2FileFormat::PropertySchema Rocs2FileFormat::readSchema(const QVariantMap &typeJson) const
+{
+    PropertySchema schema;
+    const QVariantMap typesJson = typeJson["PropertyTypes"].toMap();
+    for (auto iter = typesJson.constBegin(); iter != typesJson.constEnd(); ++iter) {
+        const QString valueType = iter.value().toString();
+        if (valueType == QLatin1String("Boolean")) {
+            schema.insert(iter.key(), QMetaType::Bool);
+        } else if (valueType == QLatin1String("Integer")) {
+            schema.insert(iter.key(), QMetaType::Int);
+        } else if (valueType == QLatin1String("Real")) {
+            schema.insert(iter.key(), QMetaType::Double);
+        } else if (valueType == QLatin1String("String")) {
+            schema.insert(iter.key(), QMetaType::QString);
+        } else {
+            qCWarning(GRAPHTHEORY_FILEFORMAT) << "Unknown value type" << valueType << "of property" << iter.key();
         }
     }
+    return schema;
+}
 
-    setGraphDocument(document);
-    setError(None);
+QVariant Rocs2FileFormat::typedValue(const QVariant &value, const PropertySchema &schema, const QString &property) const
+{
+    // files without schema, e.g. of format version 1, keep their values as strings
+    const int valueType = schema.value(property, QMetaType::QString);
+    if (value.userType() == valueType) {
+        return value;
+    }
+    QVariant converted = value;
+    if (converted.convert(valueType)) {
+        return converted;
+    }
+    return value;
+}
+
+void Rocs2FileFormat::createNode(GraphDocumentPtr document, const NodeRecord &record, const QHash<int, NodeTypePtr> &types, const QHash<int, PropertySchema> &schemas) const
+{
+    if (document->nodeTypes().isEmpty()) {
+        NodeType::create(document);
+    }
+    NodePtr node = Node::create(document);
+
+    // set type
+    NodeTypePtr typeToSet = types.value(record.type);
+    if (!typeToSet) {
+        qCCritical(GRAPHTHEORY_FILEFORMAT) << "No type found with this ID, defaulting to first found type";
+        typeToSet = document->nodeTypes().first();
+    }
+    node->setType(typeToSet);
+
+    // further properties
+    node->setId(record.id);
+    node->setPosition(QPointF(record.x, record.y));
+    node->setColor(QColor(record.color));
+    const PropertySchema schema = schemas.value(typeToSet->id());
+    for (const auto &property : record.properties) {
+        node->setDynamicProperty(property.first, typedValue(property.second, schema, property.first));
+    }
+}
+
+void Rocs2FileFormat::createEdge(GraphDocumentPtr document, const EdgeRecord &record, const QHash<int, EdgeTypePtr> &types, const QHash<int, PropertySchema> &schemas) const
+{
+    // find nodes to connect to
+    NodePtr fromNode = document->node(record.from);
+    NodePtr toNode = document->node(record.to);
+    if (!fromNode || !toNode) {
+        qCCritical(GRAPHTHEORY_FILEFORMAT) << "No node found with this ID, aborting edge from"
+            << record.from << "to" << record.to;
+        return;
+    }
+    if (document->edgeTypes().isEmpty()) {
+        EdgeType::create(document);
+    }
+    EdgePtr edge = Edge::create(fromNode, toNode);
+
+    // set type
+    EdgeTypePtr typeToSet = types.value(record.type);
+    if (!typeToSet) {
+        qCCritical(GRAPHTHEORY_FILEFORMAT) << "No type found with this ID, defaulting to first found type";
+        typeToSet = document->edgeTypes().first();
+    }
+    edge->setType(typeToSet);
+
+    // set dynamic properties
+    const PropertySchema schema = schemas.value(typeToSet->id());
+    for (const auto &property : record.properties) {
+        edge->setDynamicProperty(property.first, typedValue(property.second, schema, property.first));
+    }
 }
 
 void Rocs2FileFormat::writeFile(GraphDocumentPtr document)
@@ -213,11 +385,16 @@ void Rocs2FileFormat::writeFile(GraphDocumentPtr document)
         return;
     }
 
-    QJsonObject output; // this JSON object fill eventually be serialized
-    output.insert("FormatVersion", 1);
+    // the document is written element-wise, such that only one element is serialized in memory
+    // at a time; sections are ordered such that nodes precede the edges referring to them
+    QByteArray output;
+    output.append("{\n\"FormatVersion\": ");
+    output.append(QByteArray::number(formatVersion));
+    output.append(",\n");
 
     // serialize node types
-    QJsonArray nodeTypes;
+    output.append("\"NodeTypes\": [");
+    bool first = true;
     foreach (const auto &type, document->nodeTypes()) {
         QJsonObject typeJson;
         typeJson.insert("Id", type->id());
@@ -233,12 +410,14 @@ void Rocs2FileFormat::writeFile(GraphDocumentPtr document)
             propertiesJson.append(property);
         }
         typeJson.insert("Properties", propertiesJson);
-        nodeTypes.append(typeJson);
+        typeJson.insert("PropertyTypes", writeSchema(type->propertyTable(), type->dynamicProperties()));
+        appendElement(output, typeJson, first);
     }
-    output.insert("NodeTypes", nodeTypes);
+    output.append("\n],\n");
 
     // serialize edge types
-    QJsonArray edgeTypes;
+    output.append("\"EdgeTypes\": [");
+    first = true;
     foreach (EdgeTypePtr type, document->edgeTypes()) {
         QJsonObject typeJson;
         typeJson.insert("Id", type->id());
@@ -255,63 +434,121 @@ void Rocs2FileFormat::writeFile(GraphDocumentPtr document)
             propertiesJson.append(property);
         }
         typeJson.insert("Properties", propertiesJson);
-        edgeTypes.append(typeJson);
+        typeJson.insert("PropertyTypes", writeSchema(type->propertyTable(), type->dynamicProperties()));
+        appendElement(output, typeJson, first);
     }
-    output.insert("EdgeTypes", edgeTypes);
-
-    // serialize nodes
-    QJsonArray nodes;
-    foreach (const auto &node, document->nodes()) {
+    output.append("\n],\n");
+
+    // serialize nodes, by handles such that documents in compact storage stay compact
+    output.append("\"Nodes\": [");
+    first = true;
+    for (int i = 0; i < document->nodeCount(); ++i) {
+        const NodeHandle node = document->nodeHandle(i);
+        const NodeTypePtr type = node.type();
+        const QPointF position = node.position();
         QJsonObject nodeJson;
-        nodeJson.insert("Id", node->id());
-        nodeJson.insert("Type", node->type()->id());
-        nodeJson.insert("X", node->x());
-        nodeJson.insert("Y", node->y());
-        nodeJson.insert("Color", node->color().name());
-        QJsonArray propertiesJson;
-        foreach (const QString &property, node->dynamicProperties()) {
-            QJsonObject propertyJson;
-            propertyJson.insert("Name", property);
-            propertyJson.insert("Value", node->dynamicProperty(property).toString());
-            propertiesJson.append(propertyJson);
+        nodeJson.insert("Id", node.id());
+        nodeJson.insert("Type", type->id());
+        nodeJson.insert("X", position.x());
+        nodeJson.insert("Y", position.y());
+        nodeJson.insert("Color", node.color().name());
+        nodeJson.insert("Properties", writeProperties(type->propertyTable(), node.propertyRow(), type->dynamicProperties()));
+        appendElement(output, nodeJson, first);
+        if (output.size() > bufferSize && !flush(fileHandle, output)) {
+            return;
         }
-        nodeJson.insert("Properties", propertiesJson);
-        nodes.append(nodeJson);
     }
-    output.insert("Nodes", nodes);
+    output.append("\n],\n");
 
     // serialize edges
-    QJsonArray edges;
-    foreach (const auto &edge, document->edges()) {
+    output.append("\"Edges\": [");
+    first = true;
+    for (int i = 0; i < document->edgeCount(); ++i) {
+        const EdgeHandle edge = document->edgeHandle(i);
+        const EdgeTypePtr type = edge.type();
         QJsonObject edgeJson;
-        edgeJson.insert("Type", edge->type()->id());
-        edgeJson.insert("From", edge->from()->id());
-        edgeJson.insert("To", edge->to()->id());
-        QJsonArray propertiesJson;
-        foreach (const QString &property, edge->dynamicProperties()) {
-            QJsonObject propertyJson;
-            propertyJson.insert("Name", property);
-            propertyJson.insert("Value", edge->dynamicProperty(property).toString());
-            propertiesJson.append(propertyJson);
+        edgeJson.insert("Type", type->id());
+        edgeJson.insert("From", edge.from().id());
+        edgeJson.insert("To", edge.to().id());
+        edgeJson.insert("Properties", writeProperties(type->propertyTable(), edge.propertyRow(), type->dynamicProperties()));
+        appendElement(output, edgeJson, first);
+        if (output.size() > bufferSize && !flush(fileHandle, output)) {
+            return;
         }
-        edgeJson.insert("Properties", propertiesJson);
-        edges.append(edgeJson);
     }
-    output.insert("Edges", edges);
+    output.append("\n]\n}\n");
 
     // serialize to file
-    QJsonDocument outputDocument(output);
-    if (fileHandle.write(outputDocument.toJson()) == -1) {
-        setError(Unknown, i18n("Error on serializing file format to file."));
+    if (!flush(fileHandle, output)) {
         return;
     }
 
-    // debug serialization
-    // qCDebug(GRAPHTHEORY_FILEFORMAT) << outputDocument.toJson();
-
     setError(None);
 }
 
+QJsonObject Rocs2FileFormat::writeSchema(const PropertyTable *properties, const QStringList &names) const
+{
+    QJsonObject schemaJson;
+    foreach (const QString &name, names) {
+        switch (properties->valueType(properties->column(name))) {
+        case PropertyTable::Boolean:
+            schemaJson.insert(name, QStringLiteral("Boolean"));
+            break;
+        case PropertyTable::Integer:
+            schemaJson.insert(name, QStringLiteral("Integer"));
+            break;
+        case PropertyTable::Real:
+            schemaJson.insert(name, QStringLiteral("Real"));
+            break;
+        case PropertyTable::String:
+            schemaJson.insert(name, QStringLiteral("String"));
+            break;
+        default:
+            // unset or mixed values are written as strings, as without schema
+            break;
+        }
+    }
+    return schemaJson;
+}
+
+QJsonArray Rocs2FileFormat::writeProperties(const PropertyTable *properties, int row, const QStringList &names) const
+{
+    QJsonArray propertiesJson;
+    foreach (const QString &name, names) {
+        const int column = properties->column(name);
+        if (!properties->hasValue(column, row)) {
+            continue;
+        }
+        // values are written as strings like in version 1, the schema restores their types
+        QJsonObject propertyJson;
+        propertyJson.insert("Name", name);
+        if (properties->valueType(column) == PropertyTable::Real) {
+            propertyJson.insert("Value", realToString(properties->realValue(column, row)));
+        } else {
+            propertyJson.insert("Value", properties->value(column, row).toString());
+        }
+        propertiesJson.append(propertyJson);
+    }
+    return propertiesJson;
+}
+
+void Rocs2FileFormat::appendElement(QByteArray &output, const QJsonObject &element, bool &first) const
+{
+    output.append(first ? "\n" : ",\n");
+    output.append(QJsonDocument(element).toJson(QJsonDocument::Compact));
+    first = false;
+}
+
+bool Rocs2FileFormat::flush(QFile &fileHandle, QByteArray &output)
+{
+    if (fileHandle.write(output) == -1) {
+        setError(Unknown, i18n("Error on serializing file format to file."));
+        return false;
+    }
+    output.clear();
+    return true;
+}
+
 QString Rocs2FileFormat::direction(EdgeType::Direction direction) const
 {
     switch (direction) {
@@ -23,9 +23,19 @@
 
 #include "fileformats/fileformatinterface.h"
 #include <edgetype.h>
+#include <QHash>
+#include <QPair>
+#include <QVariant>
+#include <QVector>
+
+class QFile;
+class QJsonArray;
+class QJsonObject;
 
 namespace GraphTheory
 {
+class JsonStreamReader;
+class PropertyTable;
 
 
 /** \brief the Rocs new generation graph file format
@@ -55,8 +65,51 @@ public:
     void readFile() Q_DECL_OVERRIDE;
 
 private:
+    /**
+     * \internal
+     * Node data as read from file, until it is created in the document.
+     */
+    struct NodeRecord {
+        NodeRecord() : id(0), type(0), x(0), y(0) {}
+        int id;
+        int type;
+        qreal x;
+        qreal y;
+        QString color;
+        QVector<QPair<QString, QVariant>> properties;
+    };
+
+    /**
+     * \internal
+     * Edge data as read from file, until it is created in the document.
+     */
+    struct EdgeRecord {
+        EdgeRecord() : from(0), to(0), type(0) {}
+        int from;
+        int to;
+        int type;
+        QVector<QPair<QString, QVariant>> properties;
+    };
+
+    /**
+     * \internal
+     * Value types of the dynamic properties of a type, by property name.
+     */
+    typedef QHash<QString, int> PropertySchema;
+
     QString direction(EdgeType::Direction direction) const;
     EdgeType::Direction direction(QString direction) const;
+    void readNode(JsonStreamReader &reader, NodeRecord &record) const;
+    void readEdge(JsonStreamReader &reader, EdgeRecord &record) const;
+    void readProperties(JsonStreamReader &reader, QVector<QPair<QString, QVariant>> &properties) const;
+    PropertySchema readSchema(const QVariantMap &typeJson) const;
+    QJsonObject writeSchema(const PropertyTable *properties, const QStringList &names) const;
+    QJsonArray writeProperties(const PropertyTable *properties, int row, const QStringList &names) const;
+    QVariant typedValue(const QVariant &value, const PropertySchema &schema, const QString &property) const;
+    void createNode(GraphDocumentPtr document, const NodeRecord &record, const QHash<int, NodeTypePtr> &types, const QHash<int, PropertySchema> &schemas) const;
+    void createEdge(GraphDocumentPtr document, const EdgeRecord &record, const QHash<int, EdgeTypePtr> &types, const QHash<int, PropertySchema> &schemas) const;
+    void appendElement(QByteArray &output, const QJsonObject &element, bool &first) const;
+    bool flush(QFile &fileHandle, QByteArray &output);
 };
 }
 
@@ -0,0 +1,335 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "testrocs2bfileformat.h"
+#include "../rocs2bfileformat.h"
+#include "fileformats/fileformatinterface.h"
+#include "graphdocument.h"
+#include "node.h"
+#include "edge.h"
+#include "edgetypestyle.h"
+#include "nodetypestyle.h"
+#include "propertytable.h"
+#include <KPluginFactory>
+#include <KPluginLoader>
+#include <QtTest>
+
+using namespace GraphTheory;
+
+TestRocs2bFileFormat::TestRocs2bFileFormat()
+{
+}
+
+// test serialization and import of edge and node types
+void TestRocs2bFileFormat::documentTypesTest()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+
+    // setup node type
+    document->nodeTypes().first()->setId(1);
+    document->nodeTypes().first()->setName("testName");
+    document->nodeTypes().first()->style()->setColor(QColor("#ff0000"));
+    document->nodeTypes().first()->style()->setVisible(false);
+    document->nodeTypes().first()->style()->setPropertyNamesVisible(true);
+    document->nodeTypes().first()->addDynamicProperty("label");
+
+    // setup edge types
+    document->edgeTypes().first()->setId(1);
+    document->edgeTypes().first()->setName("testName");
+    document->edgeTypes().first()->style()->setColor(QColor("#ff0000"));
+    document->edgeTypes().first()->style()->setVisible(false);
+    document->edgeTypes().first()->style()->setPropertyNamesVisible(true);
+    document->edgeTypes().first()->addDynamicProperty("label");
+    document->edgeTypes().first()->setDirection(EdgeType::Bidirectional);
+    EdgeTypePtr secondType = EdgeType::create(document);
+    secondType->setId(2);
+    secondType->setDirection(EdgeType::Unidirectional);
+
+    Rocs2bFileFormat serializer(this, QList<QVariant>());
+    serializer.setFile(QUrl::fromLocalFile("test.graph2b"));
+    serializer.writeFile(document);
+    QVERIFY(serializer.hasError() == false);
+
+    Rocs2bFileFormat importer(this, QList<QVariant>());
+    importer.setFile(QUrl::fromLocalFile("test.graph2b"));
+    importer.readFile();
+    QVERIFY2(importer.hasError() == false, importer.errorString().toStdString().c_str());
+    QVERIFY(importer.isGraphDocument());
+    GraphDocumentPtr importDocument = importer.graphDocument();
+
+    // test node type
+    QCOMPARE(importDocument->nodeTypes().count(), 1);
+    QCOMPARE(importDocument->nodeTypes().first()->id(), 1);
+    QCOMPARE(importDocument->nodeTypes().first()->name(), QString("testName"));
+    QCOMPARE(importDocument->nodeTypes().first()->style()->isVisible(), false);
+    QCOMPARE(importDocument->nodeTypes().first()->style()->isPropertyNamesVisible(), true);
+    QCOMPARE(importDocument->nodeTypes().first()->style()->color().name(), QString("#ff0000"));
+    QCOMPARE(importDocument->nodeTypes().first()->dynamicProperties(), QStringList("label"));
+
+    // test edge types
+    QCOMPARE(importDocument->edgeTypes().count(), 2);
+    QCOMPARE(importDocument->edgeTypes().first()->id(), 1);
+    QCOMPARE(importDocument->edgeTypes().first()->name(), QString("testName"));
+    QCOMPARE(importDocument->edgeTypes().first()->style()->color().name(), QString("#ff0000"));
+    QCOMPARE(importDocument->edgeTypes().first()->style()->isVisible(), false);
+    QCOMPARE(importDocument->edgeTypes().first()->style()->isPropertyNamesVisible(), true);
+    QCOMPARE(importDocument->edgeTypes().first()->direction(), EdgeType::Bidirectional);
+    QCOMPARE(importDocument->edgeTypes().first()->dynamicProperties(), QStringList("label"));
+    QCOMPARE(importDocument->edgeTypes().last()->id(), 2);
+    QCOMPARE(importDocument->edgeTypes().last()->direction(), EdgeType::Unidirectional);
+
+    document->destroy();
+    importDocument->destroy();
+}
+
+// test if nodes, edges, and the graph structure itself is re-imported correctly
+void TestRocs2bFileFormat::nodeAndEdgeTest()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    document->nodeTypes().first()->addDynamicProperty("label");
+    document->nodeTypes().first()->setId(1);
+    document->edgeTypes().first()->addDynamicProperty("label");
+    document->edgeTypes().first()->setId(1);
+
+    NodePtr nodeA = Node::create(document);
+    nodeA->setDynamicProperty("label", QString::fromUtf8("first n\xc3\xb6""de"));
+    nodeA->setId(1);
+    nodeA->setX(20.5);
+    nodeA->setY(-20);
+    nodeA->setColor(QColor("#00ff00"));
+    NodePtr nodeB = Node::create(document);
+    nodeB->setDynamicProperty("label", "b");
+    nodeB->setId(2);
+    NodePtr nodeC = Node::create(document);
+    nodeC->setDynamicProperty("label", "b");
+    nodeC->setId(3);
+    Edge::create(nodeA, nodeB)->setDynamicProperty("label", "test value");
+    Edge::create(nodeC, nodeA);
+
+    Rocs2bFileFormat serializer(this, QList<QVariant>());
+    serializer.setFile(QUrl::fromLocalFile("test.graph2b"));
+    serializer.writeFile(document);
+    QVERIFY(serializer.hasError() == false);
+
+    Rocs2bFileFormat importer(this, QList<QVariant>());
+    importer.setFile(QUrl::fromLocalFile("test.graph2b"));
+    importer.readFile();
+    QVERIFY2(importer.hasError() == false, importer.errorString().toStdString().c_str());
+    QVERIFY(importer.isGraphDocument());
+    GraphDocumentPtr importDocument = importer.graphDocument();
+
+    // nodes are imported in the same order
+    QCOMPARE(importDocument->nodes().size(), 3);
+    NodePtr testNode = importDocument->nodes().first();
+    QCOMPARE(testNode->id(), 1);
+    QCOMPARE(testNode->x(), qreal(20.5));
+    QCOMPARE(testNode->y(), qreal(-20));
+    QCOMPARE(testNode->color().name(), QString("#00ff00"));
+    QCOMPARE(testNode->dynamicProperty("label").toString(), QString::fromUtf8("first n\xc3\xb6""de"));
+    QCOMPARE(importDocument->nodes().at(2)->dynamicProperty("label").toString(), QString("b"));
+
+    // test edges
+    QCOMPARE(importDocument->edges().count(), 2);
+    EdgePtr testEdge = importDocument->edges().first();
+    QCOMPARE(testEdge->dynamicProperty("label").toString(), QString("test value"));
+    QVERIFY(testEdge->from() == testNode);
+    QCOMPARE(testEdge->to()->id(), 2);
+    QCOMPARE(importDocument->edges().last()->from()->id(), 3);
+    QVERIFY(importDocument->edges().last()->to() == testNode);
+
+    document->destroy();
+    importDocument->destroy();
+}
+
+// test that truncated and foreign files are rejected
+void TestRocs2bFileFormat::invalidFileTest()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    Edge::create(Node::create(document), Node::create(document));
+    Rocs2bFileFormat serializer(this, QList<QVariant>());
+    serializer.setFile(QUrl::fromLocalFile("test.graph2b"));
+    serializer.writeFile(document);
+    QVERIFY(serializer.hasError() == false);
+    document->destroy();
+
+    QFile fileHandle("test.graph2b");
+    QVERIFY(fileHandle.open(QFile::ReadWrite));
+    QVERIFY(fileHandle.resize(fileHandle.size() - 10));
+    fileHandle.close();
+
+    Rocs2bFileFormat importer(this, QList<QVariant>());
+    importer.setFile(QUrl::fromLocalFile("test.graph2b"));
+    importer.readFile();
+    QVERIFY(importer.hasError());
+
+    QVERIFY(fileHandle.open(QFile::WriteOnly));
+    fileHandle.write("{\"FormatVersion\": 1}");
+    fileHandle.close();
+    importer.readFile();
+    QCOMPARE(importer.error(), FileFormatInterface::CouldNotRecognizeFileFormat);
+}
+
+GraphDocumentPtr TestRocs2bFileFormat::roundTrip(FileFormatInterface *format, GraphDocumentPtr document, const QString &fileName)
+{
+    format->setFile(QUrl::fromLocalFile(fileName));
+    format->writeFile(document);
+    if (format->hasError()) {
+        return GraphDocumentPtr();
+    }
+    format->readFile();
+    if (format->hasError()) {
+        return GraphDocumentPtr();
+    }
+    return format->graphDocument();
+}
+
+// test that value types are kept in both directions between the rocs2 and rocs2b formats
+void TestRocs2bFileFormat::typedValuesTest()
+{
+    KPluginLoader loader(QStringLiteral(ROCS2_PLUGIN_PATH));
+    KPluginFactory *factory = loader.factory();
+    QVERIFY2(factory, loader.errorString().toStdString().c_str());
+    FileFormatInterface *rocs2 = factory->create<FileFormatInterface>(this);
+    QVERIFY(rocs2);
+    Rocs2bFileFormat rocs2b(this, QList<QVariant>());
+
+    GraphDocumentPtr document = GraphDocument::create();
+    NodeTypePtr nodeType = document->nodeTypes().first();
+    nodeType->setId(1);
+    nodeType->addDynamicProperty("real");
+    nodeType->addDynamicProperty("integer");
+    nodeType->addDynamicProperty("boolean");
+    nodeType->addDynamicProperty("string");
+    EdgeTypePtr edgeType = document->edgeTypes().first();
+    edgeType->setId(1);
+    edgeType->addDynamicProperty("weight");
+    NodePtr from = Node::create(document);
+    from->setId(1);
+    from->setDynamicProperty("real", qreal(0.1));
+    from->setDynamicProperty("integer", -42);
+    from->setDynamicProperty("boolean", true);
+    from->setDynamicProperty("string", "3");
+    NodePtr to = Node::create(document);
+    to->setId(2);
+    Edge::create(from, to)->setDynamicProperty("weight", qreal(1.25));
+
+    // each import is written by the next format, i.e. converted in both directions
+    QList<FileFormatInterface *> formats;
+    formats << &rocs2b << rocs2 << &rocs2b << rocs2;
+    GraphDocumentPtr importDocument = document;
+    for (int i = 0; i < formats.count(); ++i) {
+        const QString fileName = formats.at(i) == rocs2 ? "typedvalues.graph2" : "typedvalues.graph2b";
+        GraphDocumentPtr previousDocument = importDocument;
+        importDocument = roundTrip(formats.at(i), previousDocument, fileName);
+        previousDocument->destroy();
+        QVERIFY2(importDocument, formats.at(i)->errorString().toStdString().c_str());
+
+        NodePtr node = importDocument->node(1);
+        QVERIFY(node);
+        QCOMPARE(node->dynamicProperty("real").userType(), int(QMetaType::Double));
+        QCOMPARE(node->dynamicProperty("real").toDouble(), qreal(0.1));
+        QCOMPARE(node->dynamicProperty("integer").userType(), int(QMetaType::Int));
+        QCOMPARE(node->dynamicProperty("integer").toInt(), -42);
+        QCOMPARE(node->dynamicProperty("boolean").userType(), int(QMetaType::Bool));
+        QCOMPARE(node->dynamicProperty("boolean").toBool(), true);
+        QCOMPARE(node->dynamicProperty("string").userType(), int(QMetaType::QString));
+        QCOMPARE(node->dynamicProperty("string").toString(), QString("3"));
+        QVERIFY(!importDocument->node(2)->dynamicProperty("integer").isValid());
+        QCOMPARE(importDocument->edges().count(), 1);
+        QCOMPARE(importDocument->edges().first()->dynamicProperty("weight").userType(), int(QMetaType::Double));
+        QCOMPARE(importDocument->edges().first()->dynamicProperty("weight").toDouble(), qreal(1.25));
+    }
+    importDocument->destroy();
+}
+
+// test that properties of the same name are assigned correctly for elements of different types
+void TestRocs2bFileFormat::propertiesOfSeveralTypesTest()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    NodeTypePtr typeA = document->nodeTypes().first();
+    typeA->addDynamicProperty("a");
+    typeA->addDynamicProperty("shared");
+    NodeTypePtr typeB = NodeType::create(document);
+    typeB->addDynamicProperty("shared");
+    NodePtr nodeA = Node::create(document);
+    nodeA->setId(1);
+    nodeA->setDynamicProperty("a", 1);
+    nodeA->setDynamicProperty("shared", "A");
+    NodePtr nodeB = Node::create(document);
+    nodeB->setId(2);
+    nodeB->setType(typeB);
+    nodeB->setDynamicProperty("shared", "B");
+
+    Rocs2bFileFormat format(this, QList<QVariant>());
+    GraphDocumentPtr importDocument = roundTrip(&format, document, "severaltypes.graph2b");
+    QVERIFY2(importDocument, format.errorString().toStdString().c_str());
+    QCOMPARE(importDocument->node(1)->dynamicProperty("a").toInt(), 1);
+    QCOMPARE(importDocument->node(1)->dynamicProperty("shared").toString(), QString("A"));
+    QCOMPARE(importDocument->node(2)->dynamicProperty("shared").toString(), QString("B"));
+    QVERIFY(!importDocument->node(2)->type()->dynamicProperties().contains("a"));
+
+    document->destroy();
+    importDocument->destroy();
+}
+
+// test that imported documents create objects only for accessed elements
+void TestRocs2bFileFormat::compactImportTest()
+{
+    GraphDocumentPtr document = GraphDocument::create();
+    const PropertyKey label = document->nodeTypes().first()->addDynamicProperty("label");
+    for (int i = 0; i < 5; ++i) {
+        Node::create(document)->setDynamicProperty("label", i);
+    }
+    for (int i = 0; i < 4; ++i) {
+        Edge::create(document->nodes().at(i), document->nodes().at(i + 1));
+    }
+
+    Rocs2bFileFormat format(this, QList<QVariant>());
+    const uint nodeObjects = Node::objects();
+    const uint edgeObjects = Edge::objects();
+    GraphDocumentPtr importDocument = roundTrip(&format, document, "test.graph2b");
+    QVERIFY(importDocument);
+    QCOMPARE(importDocument->storageMode(), GraphDocument::CompactStorage);
+    QCOMPARE(importDocument->nodeCount(), 5);
+    QCOMPARE(importDocument->edgeCount(), 4);
+    QCOMPARE(importDocument->nodeHandle(3).dynamicProperty(label), QVariant(3));
+    QCOMPARE(importDocument->edgeHandle(2).to().index(), 3);
+
+    // writing reads the compact storage
+    GraphDocumentPtr secondImport = roundTrip(&format, importDocument, "test.graph2b");
+    QVERIFY(secondImport);
+    QCOMPARE(secondImport->nodeHandle(4).dynamicProperty(label), QVariant(4));
+    QCOMPARE(Node::objects(), nodeObjects);
+    QCOMPARE(Edge::objects(), edgeObjects);
+
+    // only the accessed node and the edges incident to it get objects
+    const NodePtr node = importDocument->nodeHandle(2).node();
+    QCOMPARE(node->dynamicProperty("label"), QVariant(2));
+    QCOMPARE(node->edges().count(), 2);
+    QCOMPARE(Node::objects(), nodeObjects + 3);
+    QCOMPARE(Edge::objects(), edgeObjects + 2);
+    QCOMPARE(importDocument->storageMode(), GraphDocument::CompactStorage);
+
+    document->destroy();
+    importDocument->destroy();
+    secondImport->destroy();
+}
+
+QTEST_MAIN(TestRocs2bFileFormat);
@@ -0,0 +1,54 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TESTROCS2BFILEFORMAT_H
+#define TESTROCS2BFILEFORMAT_H
+
+#include "typenames.h"
+#include <QObject>
+
+namespace GraphTheory
+{
+class FileFormatInterface;
+}
+
+class TestRocs2bFileFormat : public QObject
+{
+    Q_OBJECT
+public:
+    TestRocs2bFileFormat();
+
+private slots:
+    void documentTypesTest();
+    void nodeAndEdgeTest();
+    void invalidFileTest();
+    void typedValuesTest();
+    void propertiesOfSeveralTypesTest();
+    void compactImportTest();
+
+private:
+    /**
+     * Write @p document with @p format to @p fileName and read it again.
+     * @return imported document or a null pointer on error
+     */
+    GraphTheory::GraphDocumentPtr roundTrip(GraphTheory::FileFormatInterface *format, GraphTheory::GraphDocumentPtr document, const QString &fileName);
+};
+
+#endif
@@ -0,0 +1,735 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "rocs2bfileformat.h"
+#include "fileformats/fileformatinterface.h"
+#include "graphdocument.h"
+#include "edgetypestyle.h"
+#include "nodetypestyle.h"
+#include "propertytable.h"
+#include "logging_p.h"
+#include <KLocalizedString>
+#include <KPluginFactory>
+#include <QBitArray>
+#include <QFile>
+#include <QHash>
+#include <QStringList>
+#include <QUrl>
+#include <QtEndian>
+#include <cstring>
+
+using namespace GraphTheory;
+
+K_PLUGIN_FACTORY_WITH_JSON( FilePluginFactory,
+                            "rocs2bfileformat.json",
+                            registerPlugin<Rocs2bFileFormat>();)
+
+namespace
+{
+const char magic[8] = { 'R', 'O', 'C', 'S', 'G', 'R', 'P', 'B' };
+const quint32 formatVersion = 2;
+
+// sizes of fixed-width records in bytes
+const qint64 headerSize = 64;
+const qint64 typeRecordSize = 32;
+const qint64 nodeRecordSize = 40;
+const qint64 edgeRecordSize = 20;
+const qint64 typePropertyRecordSize = 4;
+const qint64 propertyRecordSize = 16;
+const qint64 propertyRecordSizeVersion1 = 8;
+
+// value types of property records
+const quint32 noValue = 0;
+const quint32 stringValue = 1;
+const quint32 booleanValue = 2;
+const quint32 integerValue = 3;
+const quint32 realValue = 4;
+
+// flags of type records
+const quint32 visibleFlag = 0x1;
+const quint32 propertyNamesVisibleFlag = 0x2;
+
+// size of the output buffer after which data is written to the file
+const int bufferSize = 1024 * 1024;
+
+/**
+ * Header of a binary graph file, all numbers are counts of records.
+ */
+struct Header {
+    Header()
+        : version(formatVersion), nodeTypes(0), edgeTypes(0), nodes(0), edges(0)
+        , typeProperties(0), properties(0), strings(0), stringDataSize(0)
+    {
+    }
+    quint32 version;
+    quint32 nodeTypes;
+    quint32 edgeTypes;
+    quint32 nodes;
+    quint32 edges;
+    quint32 typeProperties;
+    quint32 properties;
+    quint32 strings;
+    quint64 stringDataSize;
+};
+
+/**
+ * Start offsets of the file sections, computed from the header.
+ */
+struct Layout {
+    explicit Layout(const Header &header)
+    {
+        nodeTypes = headerSize;
+        edgeTypes = nodeTypes + header.nodeTypes * typeRecordSize;
+        nodes = edgeTypes + header.edgeTypes * typeRecordSize;
+        edges = nodes + header.nodes * nodeRecordSize;
+        typeProperties = edges + header.edges * edgeRecordSize;
+        propertySize = header.version < 2 ? propertyRecordSizeVersion1 : propertyRecordSize;
+        properties = typeProperties + header.typeProperties * typePropertyRecordSize;
+        stringOffsets = properties + header.properties * propertySize;
+        stringData = stringOffsets + (qint64(header.strings) + 1) * 4;
+        end = stringData + qint64(header.stringDataSize);
+    }
+    qint64 nodeTypes;
+    qint64 edgeTypes;
+    qint64 nodes;
+    qint64 edges;
+    qint64 typeProperties;
+    qint64 properties;
+    qint64 propertySize;
+    qint64 stringOffsets;
+    qint64 stringData;
+    qint64 end;
+};
+
+quint32 readUInt32(const uchar *data)
+{
+    return qFromLittleEndian<quint32>(data);
+}
+
+qint32 readInt32(const uchar *data)
+{
+    return qFromLittleEndian<qint32>(data);
+}
+
+double readDouble(const uchar *data)
+{
+    const quint64 bits = qFromLittleEndian<quint64>(data);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/**
+ * Buffered writer of little endian encoded values.
+ */
+class BinaryWriter
+{
+public:
+    explicit BinaryWriter(QIODevice *device)
+        : m_device(device)
+        , m_ok(true)
+    {
+        m_buffer.reserve(bufferSize);
+    }
+
+    void writeUInt32(quint32 value)
+    {
+        uchar bytes[4];
+        qToLittleEndian(value, bytes);
+        append(bytes, 4);
+    }
+
+    void writeInt32(qint32 value)
+    {
+        uchar bytes[4];
+        qToLittleEndian(value, bytes);
+        append(bytes, 4);
+    }
+
+    void writeUInt64(quint64 value)
+    {
+        uchar bytes[8];
+        qToLittleEndian(value, bytes);
+        append(bytes, 8);
+    }
+
+    void writeDouble(double value)
+    {
+        quint64 bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        writeUInt64(bits);
+    }
+
+    void writeBytes(const char *data, int size)
+    {
+        append(reinterpret_cast<const uchar *>(data), size);
+    }
+
+    void writeHeader(const Header &header)
+    {
+        writeBytes(magic, sizeof(magic));
+        writeUInt32(header.version);
+        writeUInt32(header.nodeTypes);
+        writeUInt32(header.edgeTypes);
+        writeUInt32(header.nodes);
+        writeUInt32(header.edges);
+        writeUInt32(header.typeProperties);
+        writeUInt32(header.properties);
+        writeUInt32(header.strings);
+        writeUInt64(header.stringDataSize);
+        for (int i = 0; i < 2; ++i) { // reserved
+            writeUInt64(0);
+        }
+    }
+
+    bool flush()
+    {
+        if (!m_buffer.isEmpty() && m_device->write(m_buffer) != m_buffer.size()) {
+            m_ok = false;
+        }
+        m_buffer.clear();
+        return m_ok;
+    }
+
+    bool isOk() const
+    {
+        return m_ok;
+    }
+
+private:
+    void append(const uchar *bytes, int size)
+    {
+        m_buffer.append(reinterpret_cast<const char *>(bytes), size);
+        if (m_buffer.size() >= bufferSize) {
+            flush();
+        }
+    }
+
+    QIODevice *m_device;
+    QByteArray m_buffer;
+    bool m_ok;
+};
+
+/**
+ * Table of distinct strings, each string is stored once and referenced by its index.
+ */
+class StringTable
+{
+public:
+    quint32 index(const QString &string)
+    {
+        QHash<QString, quint32>::const_iterator iter = m_indices.constFind(string);
+        if (iter != m_indices.constEnd()) {
+            return iter.value();
+        }
+        const quint32 index = m_offsets.size();
+        m_indices.insert(string, index);
+        m_offsets.append(m_data.size());
+        m_data.append(string.toUtf8());
+        return index;
+    }
+
+    quint32 count() const
+    {
+        return m_offsets.size();
+    }
+
+    void write(BinaryWriter &writer) const
+    {
+        for (quint32 offset : m_offsets) {
+            writer.writeUInt32(offset);
+        }
+        writer.writeUInt32(m_data.size());
+        writer.writeBytes(m_data.constData(), m_data.size());
+    }
+
+    quint64 dataSize() const
+    {
+        return m_data.size();
+    }
+
+private:
+    QHash<QString, quint32> m_indices;
+    QVector<quint32> m_offsets;
+    QByteArray m_data;
+};
+
+/**
+ * Write property record of @p name with its value type and @p value.
+ */
+void writeProperty(BinaryWriter &writer, StringTable &strings, const QString &name, const QVariant &value)
+{
+    writer.writeUInt32(strings.index(name));
+    switch (value.userType()) {
+    case QMetaType::UnknownType:
+        writer.writeUInt32(noValue);
+        writer.writeUInt64(0);
+        break;
+    case QMetaType::Bool:
+        writer.writeUInt32(booleanValue);
+        writer.writeUInt64(value.toBool() ? 1 : 0);
+        break;
+    case QMetaType::Int:
+        writer.writeUInt32(integerValue);
+        writer.writeUInt64(quint64(qint64(value.toInt())));
+        break;
+    case QMetaType::Double:
+        writer.writeUInt32(realValue);
+        writer.writeDouble(value.toDouble());
+        break;
+    default:
+        writer.writeUInt32(stringValue);
+        writer.writeUInt32(strings.index(value.toString()));
+        writer.writeUInt32(0);
+        break;
+    }
+}
+}
+
+Rocs2bFileFormat::Rocs2bFileFormat(QObject* parent, const QList< QVariant >&)
+    : FileFormatInterface("rocs_rocs2bfileformat", parent)
+{
+}
+
+Rocs2bFileFormat::~Rocs2bFileFormat()
+{
+}
+
+const QStringList Rocs2bFileFormat::extensions() const
+{
+    return QStringList()
+           << i18n("Rocs Binary Graph Format (%1)", QString("*.graph2b"));
+}
+
+void Rocs2bFileFormat::readFile()
+{
+    QFile fileHandle(file().toLocalFile());
+    if (!fileHandle.open(QFile::ReadOnly)) {
+        setError(CouldNotOpenFile, i18n("Could not open file \"%1\" in read mode: %2", file().toLocalFile(), fileHandle.errorString()));
+        return;
+    }
+
+    // gracefully handle empty documents: return a new one with default types
+    const qint64 size = fileHandle.size();
+    if (size == 0) {
+        setGraphDocument(GraphDocument::create());
+        setError(None);
+        return;
+    }
+
+    // access file content without copying it, if the file system supports mapping
+    uchar *data = fileHandle.map(0, size);
+    if (data) {
+        readData(data, size);
+        fileHandle.unmap(data);
+    } else {
+        const QByteArray content = fileHandle.readAll();
+        readData(reinterpret_cast<const uchar *>(content.constData()), content.size());
+    }
+}
+
+void Rocs2bFileFormat::readData(const uchar *data, qint64 size)
+{
+    // check header
+    if (size < headerSize || std::memcmp(data, magic, sizeof(magic)) != 0) {
+        setError(CouldNotRecognizeFileFormat, i18n("File \"%1\" is not a binary Rocs graph file.", file().toLocalFile()));
+        return;
+    }
+    Header header;
+    header.version = readUInt32(data + 8);
+    header.nodeTypes = readUInt32(data + 12);
+    header.edgeTypes = readUInt32(data + 16);
+    header.nodes = readUInt32(data + 20);
+    header.edges = readUInt32(data + 24);
+    header.typeProperties = readUInt32(data + 28);
+    header.properties = readUInt32(data + 32);
+    header.strings = readUInt32(data + 36);
+    header.stringDataSize = qFromLittleEndian<quint64>(data + 40);
+    if (header.version > formatVersion) {
+        setError(NotSupportedOperation, i18n("File has format version %1, which is higher than the latest supported version.", header.version));
+        return;
+    }
+    const Layout layout(header);
+    if (header.stringDataSize > quint64(size) || layout.end > size) {
+        setError(EncodingProblem, i18n("File \"%1\" is truncated.", file().toLocalFile()));
+        return;
+    }
+
+    // strings are decoded on first use
+    const uchar *stringOffsets = data + layout.stringOffsets;
+    const char *stringData = reinterpret_cast<const char *>(data + layout.stringData);
+    QVector<QString> strings(header.strings);
+    QBitArray decoded(header.strings);
+    bool valid = true;
+    auto string = [&] (quint32 index) -> QString {
+        if (index >= header.strings) {
+            valid = false;
+            return QString();
+        }
+        if (!decoded.testBit(index)) {
+            const quint32 begin = readUInt32(stringOffsets + 4 * index);
+            const quint32 end = readUInt32(stringOffsets + 4 * (index + 1));
+            if (begin > end || end > header.stringDataSize) {
+                valid = false;
+                return QString();
+            }
+            strings[index] = QString::fromUtf8(stringData + begin, end - begin);
+            decoded.setBit(index);
+        }
+        return strings.at(index);
+    };
+    auto value = [&] (const uchar *property) -> QVariant {
+        if (header.version < 2) {
+            return string(readUInt32(property + 4));
+        }
+        switch (readUInt32(property + 4)) {
+        case noValue:
+            return QVariant();
+        case stringValue:
+            return string(readUInt32(property + 8));
+        case booleanValue:
+            return QVariant(qFromLittleEndian<quint64>(property + 8) != 0);
+        case integerValue:
+            return QVariant(int(qFromLittleEndian<qint64>(property + 8)));
+        case realValue:
+            return QVariant(readDouble(property + 8));
+        default:
+            valid = false;
+            return QVariant();
+        }
+    };
+    auto checkRange = [&] (quint32 first, quint32 count, quint32 total) {
+        if (quint64(first) + count > total) {
+            valid = false;
+            return false;
+        }
+        return true;
+    };
+
+    // nodes and edges get objects only when they are accessed, e.g., when the document is shown
+    GraphDocumentPtr document = GraphDocument::create(GraphDocument::CompactStorage);
+    BatchGuard batch(document);
+    document->remove(document->nodeTypes().first());
+    document->remove(document->edgeTypes().first());
+
+    // import node types
+    const uchar *typeProperties = data + layout.typeProperties;
+    QVector<NodeTypePtr> nodeTypes(header.nodeTypes);
+    for (quint32 index = 0; index < header.nodeTypes; ++index) {
+        const uchar *record = data + layout.nodeTypes + index * typeRecordSize;
+        NodeTypePtr type = NodeType::create(document);
+        type->setId(readInt32(record));
+        type->setName(string(readUInt32(record + 4)));
+        type->style()->setColor(QColor::fromRgba(readUInt32(record + 8)));
+        const quint32 flags = readUInt32(record + 12);
+        type->style()->setVisible(flags & visibleFlag);
+        type->style()->setPropertyNamesVisible(flags & propertyNamesVisibleFlag);
+        const quint32 first = readUInt32(record + 20);
+        const quint32 count = readUInt32(record + 24);
+        if (checkRange(first, count, header.typeProperties)) {
+            for (quint32 p = first; p < first + count; ++p) {
+                type->addDynamicProperty(string(readUInt32(typeProperties + p * typePropertyRecordSize)));
+            }
+        }
+        nodeTypes[index] = type;
+    }
+
+    // import edge types
+    QVector<EdgeTypePtr> edgeTypes(header.edgeTypes);
+    for (quint32 index = 0; index < header.edgeTypes; ++index) {
+        const uchar *record = data + layout.edgeTypes + index * typeRecordSize;
+        EdgeTypePtr type = EdgeType::create(document);
+        type->setId(readInt32(record));
+        type->setName(string(readUInt32(record + 4)));
+        type->style()->setColor(QColor::fromRgba(readUInt32(record + 8)));
+        const quint32 flags = readUInt32(record + 12);
+        type->style()->setVisible(flags & visibleFlag);
+        type->style()->setPropertyNamesVisible(flags & propertyNamesVisibleFlag);
+        type->setDirection(readUInt32(record + 16) == 1 ? EdgeType::Bidirectional : EdgeType::Unidirectional);
+        const quint32 first = readUInt32(record + 20);
+        const quint32 count = readUInt32(record + 24);
+        if (checkRange(first, count, header.typeProperties)) {
+            for (quint32 p = first; p < first + count; ++p) {
+                type->addDynamicProperty(string(readUInt32(typeProperties + p * typePropertyRecordSize)));
+            }
+        }
+        edgeTypes[index] = type;
+    }
+
+    // ensure that default types exist, even for documents without types
+    if (document->nodeTypes().isEmpty()) {
+        NodeType::create(document);
+    }
+    if (document->edgeTypes().isEmpty()) {
+        EdgeType::create(document);
+    }
+
+    const uchar *properties = data + layout.properties;
+    // property names are resolved to keys once per type and string; the last entry is used by
+    // elements with an invalid type index, which get the first type of the document
+    QVector<QHash<quint32, PropertyKey>> nodeKeys(header.nodeTypes + 1);
+    QVector<QHash<quint32, PropertyKey>> edgeKeys(header.edgeTypes + 1);
+    auto key = [&] (QHash<quint32, PropertyKey> &keys, PropertyTable *table, quint32 name) {
+        auto iter = keys.constFind(name);
+        if (iter == keys.constEnd()) {
+            const QString property = string(name);
+            if (property.isEmpty()) {
+                return PropertyKey();
+            }
+            iter = keys.insert(name, table->key(table->addColumn(property)));
+        }
+        return iter.value();
+    };
+    const qint64 elements = qint64(header.nodes) + header.edges;
+    const qint64 progressStep = qMax<qint64>(elements / 100, 1);
+
+    // import nodes, their positions in the document are their indices in the file
+    for (quint32 index = 0; index < header.nodes && valid; ++index) {
+        const uchar *record = data + layout.nodes + index * nodeRecordSize;
+        const quint32 type = readUInt32(record + 20);
+        const NodeTypePtr nodeType = type < header.nodeTypes ? nodeTypes.at(type) : document->nodeTypes().first();
+        NodeHandle node = document->createNode(QPointF(readDouble(record), readDouble(record + 8)), nodeType);
+        node.setId(readInt32(record + 16));
+        node.setColor(QColor::fromRgba(readUInt32(record + 24)));
+        const quint32 first = readUInt32(record + 28);
+        const quint32 count = readUInt32(record + 32);
+        if (checkRange(first, count, header.properties)) {
+            for (quint32 p = first; p < first + count; ++p) {
+                const uchar *property = properties + p * layout.propertySize;
+                const QVariant propertyValue = value(property);
+                if (propertyValue.isValid()) {
+                    node.setDynamicProperty(key(nodeKeys[qMin(type, header.nodeTypes)], nodeType->propertyTable(), readUInt32(property)), propertyValue);
+                }
+            }
+        }
+        if (index % progressStep == 0) {
+            emit progressChanged(index, elements);
+            if (isCanceled()) {
+                break;
+            }
+        }
+    }
+
+    // import edges
+    for (quint32 index = 0; index < header.edges && valid && !isCanceled(); ++index) {
+        const uchar *record = data + layout.edges + index * edgeRecordSize;
+        const quint32 from = readUInt32(record);
+        const quint32 to = readUInt32(record + 4);
+        if (from >= header.nodes || to >= header.nodes) {
+            valid = false;
+            break;
+        }
+        const quint32 type = readUInt32(record + 8);
+        const EdgeTypePtr edgeType = type < header.edgeTypes ? edgeTypes.at(type) : document->edgeTypes().first();
+        EdgeHandle edge = document->createEdge(document->nodeHandle(from), document->nodeHandle(to), edgeType);
+        const quint32 first = readUInt32(record + 12);
+        const quint32 count = readUInt32(record + 16);
+        if (checkRange(first, count, header.properties)) {
+            for (quint32 p = first; p < first + count; ++p) {
+                const uchar *property = properties + p * layout.propertySize;
+                const QVariant propertyValue = value(property);
+                if (propertyValue.isValid()) {
+                    edge.setDynamicProperty(key(edgeKeys[qMin(type, header.edgeTypes)], edgeType->propertyTable(), readUInt32(property)), propertyValue);
+                }
+            }
+        }
+        if ((header.nodes + index) % progressStep == 0) {
+            emit progressChanged(header.nodes + index, elements);
+            if (isCanceled()) {
+                break;
+            }
+        }
+    }
+
+    if (isCanceled()) {
+        document->destroy();
+        setError(Canceled, i18n("Import of file \"%1\" was canceled.", file().toLocalFile()));
+        return;
+    }
+    if (!valid) {
+        document->destroy();
+        setError(EncodingProblem, i18n("File \"%1\" contains invalid references.", file().toLocalFile()));
+        return;
+    }
+    emit progressChanged(elements, elements);
+
+    setGraphDocument(document);
+    setError(None);
+}
+
+void Rocs2bFileFormat::writeFile(GraphDocumentPtr document)
+{
+    QFile fileHandle(file().toLocalFile());
+    if (!fileHandle.open(QFile::WriteOnly)) {
+        setError(FileIsReadOnly, i18n("Could not open file \"%1\" in write mode: %2", file().fileName(), fileHandle.errorString()));
+        return;
+    }
+
+    // nodes and edges are read through handles, such that documents in compact storage are
+    // written without creating objects
+    const QList<NodeTypePtr> nodeTypes = document->nodeTypes();
+    const QList<EdgeTypePtr> edgeTypes = document->edgeTypes();
+    const int nodeCount = document->nodeCount();
+    const int edgeCount = document->edgeCount();
+    QHash<NodeType*, quint32> nodeTypeIndices;
+    QVector<QStringList> nodeTypeProperties(nodeTypes.length());
+    QVector<QVector<PropertyKey>> nodeTypeKeys(nodeTypes.length());
+    for (int index = 0; index < nodeTypes.length(); ++index) {
+        const NodeTypePtr &type = nodeTypes.at(index);
+        nodeTypeIndices.insert(type.data(), index);
+        nodeTypeProperties[index] = type->dynamicProperties();
+        foreach (const QString &property, nodeTypeProperties.at(index)) {
+            nodeTypeKeys[index].append(type->propertyTable()->key(type->propertyTable()->column(property)));
+        }
+    }
+    QHash<EdgeType*, quint32> edgeTypeIndices;
+    QVector<QStringList> edgeTypeProperties(edgeTypes.length());
+    QVector<QVector<PropertyKey>> edgeTypeKeys(edgeTypes.length());
+    for (int index = 0; index < edgeTypes.length(); ++index) {
+        const EdgeTypePtr &type = edgeTypes.at(index);
+        edgeTypeIndices.insert(type.data(), index);
+        edgeTypeProperties[index] = type->dynamicProperties();
+        foreach (const QString &property, edgeTypeProperties.at(index)) {
+            edgeTypeKeys[index].append(type->propertyTable()->key(type->propertyTable()->column(property)));
+        }
+    }
+    QVector<quint32> nodeTypeOfNode(nodeCount);
+    for (int index = 0; index < nodeCount; ++index) {
+        nodeTypeOfNode[index] = nodeTypeIndices.value(document->nodeHandle(index).type().data());
+    }
+    QVector<quint32> edgeTypeOfEdge(edgeCount);
+    for (int index = 0; index < edgeCount; ++index) {
+        edgeTypeOfEdge[index] = edgeTypeIndices.value(document->edgeHandle(index).type().data());
+    }
+
+    // header is written again after the string table is complete
+    Header header;
+    header.nodeTypes = nodeTypes.length();
+    header.edgeTypes = edgeTypes.length();
+    header.nodes = nodeCount;
+    header.edges = edgeCount;
+    BinaryWriter writer(&fileHandle);
+    StringTable strings;
+    writer.writeHeader(header);
+
+    // types, property ranges are assigned in order of the records
+    foreach (const NodeTypePtr &type, nodeTypes) {
+        if (type->id() == -1) {
+            qCCritical(GRAPHTHEORY_FILEFORMAT) << "Serializing unset ID, this will break import";
+        }
+        const quint32 flags = (type->style()->isVisible() ? visibleFlag : 0)
+            | (type->style()->isPropertyNamesVisible() ? propertyNamesVisibleFlag : 0);
+        writer.writeInt32(type->id());
+        writer.writeUInt32(strings.index(type->name()));
+        writer.writeUInt32(type->style()->color().rgba());
+        writer.writeUInt32(flags);
+        writer.writeUInt32(0);
+        writer.writeUInt32(header.typeProperties);
+        writer.writeUInt32(type->dynamicProperties().count());
+        writer.writeUInt32(0);
+        header.typeProperties += type->dynamicProperties().count();
+    }
+    foreach (const EdgeTypePtr &type, edgeTypes) {
+        if (type->id() == -1) {
+            qCCritical(GRAPHTHEORY_FILEFORMAT) << "Serializing unset ID, this will break import";
+        }
+        const quint32 flags = (type->style()->isVisible() ? visibleFlag : 0)
+            | (type->style()->isPropertyNamesVisible() ? propertyNamesVisibleFlag : 0);
+        writer.writeInt32(type->id());
+        writer.writeUInt32(strings.index(type->name()));
+        writer.writeUInt32(type->style()->color().rgba());
+        writer.writeUInt32(flags);
+        writer.writeUInt32(type->direction() == EdgeType::Bidirectional ? 1 : 0);
+        writer.writeUInt32(header.typeProperties);
+        writer.writeUInt32(type->dynamicProperties().count());
+        writer.writeUInt32(0);
+        header.typeProperties += type->dynamicProperties().count();
+    }
+
+    // nodes and edges
+    for (int index = 0; index < nodeCount; ++index) {
+        const NodeHandle node = document->nodeHandle(index);
+        const int propertyCount = nodeTypeProperties.at(nodeTypeOfNode.at(index)).count();
+        const QPointF position = node.position();
+        writer.writeDouble(position.x());
+        writer.writeDouble(position.y());
+        writer.writeInt32(node.id());
+        writer.writeUInt32(nodeTypeOfNode.at(index));
+        writer.writeUInt32(node.color().rgba());
+        writer.writeUInt32(header.properties);
+        writer.writeUInt32(propertyCount);
+        writer.writeUInt32(0);
+        header.properties += propertyCount;
+    }
+    for (int index = 0; index < edgeCount; ++index) {
+        const EdgeHandle edge = document->edgeHandle(index);
+        const int propertyCount = edgeTypeProperties.at(edgeTypeOfEdge.at(index)).count();
+        writer.writeUInt32(edge.from().index());
+        writer.writeUInt32(edge.to().index());
+        writer.writeUInt32(edgeTypeOfEdge.at(index));
+        writer.writeUInt32(header.properties);
+        writer.writeUInt32(propertyCount);
+        header.properties += propertyCount;
+    }
+
+    // type properties and properties, in the same order as their ranges were assigned
+    foreach (const NodeTypePtr &type, nodeTypes) {
+        foreach (const QString &property, type->dynamicProperties()) {
+            writer.writeUInt32(strings.index(property));
+        }
+    }
+    foreach (const EdgeTypePtr &type, edgeTypes) {
+        foreach (const QString &property, type->dynamicProperties()) {
+            writer.writeUInt32(strings.index(property));
+        }
+    }
+    for (int index = 0; index < nodeCount; ++index) {
+        const NodeHandle node = document->nodeHandle(index);
+        const quint32 type = nodeTypeOfNode.at(index);
+        for (int p = 0; p < nodeTypeProperties.at(type).count(); ++p) {
+            writeProperty(writer, strings, nodeTypeProperties.at(type).at(p), node.dynamicProperty(nodeTypeKeys.at(type).at(p)));
+        }
+    }
+    for (int index = 0; index < edgeCount; ++index) {
+        const EdgeHandle edge = document->edgeHandle(index);
+        const quint32 type = edgeTypeOfEdge.at(index);
+        for (int p = 0; p < edgeTypeProperties.at(type).count(); ++p) {
+            writeProperty(writer, strings, edgeTypeProperties.at(type).at(p), edge.dynamicProperty(edgeTypeKeys.at(type).at(p)));
+        }
+    }
+
+    strings.write(writer);
+    header.strings = strings.count();
+    header.stringDataSize = strings.dataSize();
+    writer.flush();
+    if (!fileHandle.seek(0)) {
+        setError(Unknown, i18n("Error on serializing file format to file."));
+        return;
+    }
+    writer.writeHeader(header);
+    if (!writer.flush()) {
+        setError(Unknown, i18n("Error on serializing file format to file."));
+        return;
+    }
+
+    setError(None);
+}
+
+#include "rocs2bfileformat.moc"
@@ -0,0 +1,84 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ROCS2BFILEFORMAT_H
+#define ROCS2BFILEFORMAT_H
+
+#include "fileformats/fileformatinterface.h"
+
+namespace GraphTheory
+{
+
+/** \brief binary variant of the Rocs graph file format
+ *
+ * The file consists of a fixed size header followed by sections of fixed-width records for
+ * node types, edge types, nodes, edges, type property names and dynamic property values.
+ * All strings are stored once in a string table at the end of the file and are referenced by
+ * their index. Integers are stored in little endian byte order.
+ *
+ * Layout of version 2:
+ * - header (64 bytes): magic "ROCSGRPB", version, numbers of node types, edge types, nodes,
+ *   edges, type properties, properties, strings, and size of string data
+ * - node types and edge types (32 bytes each): id, name, color, flags, direction, first type
+ *   property, number of type properties
+ * - nodes (40 bytes each): x, y, id, type index, color, first property, number of properties
+ * - edges (20 bytes each): from node index, to node index, type index, first property,
+ *   number of properties
+ * - type properties (4 bytes each): name
+ * - properties (16 bytes each): name, value type, and value as 64 bit integer or double for
+ *   boolean, integer and real values or as string index for string values
+ * - string offsets (4 bytes each, number of strings + 1) and UTF-8 encoded string data
+ *
+ * Version 1 files store all property values as strings in records of 8 bytes (name, value).
+ *
+ * Files are read through a memory mapping of the file. Property values keep their boolean,
+ * integer, real or string type, such that the content is lossless convertible to and from
+ * the JSON based format of Rocs2FileFormat. Values of other types are stored as strings.
+ */
+class Rocs2bFileFormat : public FileFormatInterface
+{
+    Q_OBJECT
+public:
+    explicit Rocs2bFileFormat(QObject *parent, const QList< QVariant >&);
+    ~Rocs2bFileFormat();
+
+    /**
+     * File extensions that are common for this file type.
+     */
+    const QStringList extensions() const Q_DECL_OVERRIDE;
+
+    /**
+     * Writes given graph document to formerly specified file \see setFile().
+     * \param graph is graphDocument to be serialized
+     */
+    void writeFile(GraphDocumentPtr graph) Q_DECL_OVERRIDE;
+
+    /**
+     * Open given file and imports it into internal format.
+     * \param file is url of a local file
+     */
+    void readFile() Q_DECL_OVERRIDE;
+
+private:
+    void readData(const uchar *data, qint64 size);
+};
+}
+
+#endif
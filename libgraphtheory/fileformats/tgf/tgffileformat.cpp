@@ -57,11 +57,9 @@ const QStringList TgfFileFormat::extensions() const
 void TgfFileFormat::readFile()
 {
     GraphDocumentPtr document = GraphDocument::create();
-    document->nodeTypes().first()->addDynamicProperty("label");
-    document->edgeTypes().first()->addDynamicProperty("label");
-
-    // map node identifier from file to created data elements
-    QMap<int, NodePtr> nodeMap;
+    BatchGuard batch(document);
+    const PropertyKey nodeLabel = document->nodeTypes().first()->addDynamicProperty("label");
+    const PropertyKey edgeLabel = document->edgeTypes().first()->addDynamicProperty("label");
 
     QFile fileHandle(file().toLocalFile());
     if (!fileHandle.open(QFile::ReadOnly)) {
@@ -70,7 +68,18 @@ void TgfFileFormat::readFile()
     }
 
     ReadMode mode = Nodes;
+    const qint64 size = fileHandle.size();
+    qint64 reportedPosition = 0;
     while (!fileHandle.atEnd()) {
+        if (isCanceled()) {
+            document->destroy();
+            setError(Canceled, i18n("Import of file \"%1\" was canceled.", file().toLocalFile()));
+            return;
+        }
+        if (fileHandle.pos() - reportedPosition >= size / 100) {
+            reportedPosition = fileHandle.pos();
+            emit progressChanged(reportedPosition, size);
+        }
         QString line = QString(fileHandle.readLine()).trimmed();
 
         if (line.startsWith('#')) { // recognize separator before edge list
@@ -81,15 +90,14 @@ void TgfFileFormat::readFile()
         if (mode == Nodes) { // read node
             int identifier = line.section(' ', 0, 0).toInt();
             QString label = line.section(' ', 1);  // get label, this is everything after first space
-            NodePtr node = Node::create(document);
-            node->setDynamicProperty("label", label.simplified());
-            node->setId(identifier);
-
-            if (nodeMap.contains(identifier)) {
+            // nodes are looked up by the identifier index of the document
+            if (document->node(identifier)) {
                 setError(EncodingProblem, i18n("Could not parse file. Identifier \"%1\" is used more than once.", identifier));
                 return;
             }
-            nodeMap[identifier] = node;
+            NodePtr node = Node::create(document);
+            node->setDynamicProperty(nodeLabel, label.simplified());
+            node->setId(identifier);
             continue;
         }
 
@@ -97,17 +105,25 @@ void TgfFileFormat::readFile()
             int from = line.section(' ', 0, 0).toInt();
             int to = line.section(' ', 1, 1).toInt();
             QString value = line.section(' ', 2);
-            if (!nodeMap.contains(from) || !nodeMap.contains(to)) {
+            const NodePtr fromNode = document->node(from);
+            const NodePtr toNode = document->node(to);
+            if (!fromNode || !toNode) {
                 setError(EncodingProblem, i18n("Could not parse file. Edge from \"%1\" to \"%2\" uses undefined nodes.", from, to));
                 return;
             }
-            EdgePtr edge = Edge::create(nodeMap[from], nodeMap[to]);
-            edge->setDynamicProperty("label", value.simplified());
+            EdgePtr edge = Edge::create(fromNode, toNode);
+            edge->setDynamicProperty(edgeLabel, value.simplified());
         }
     }
 
     Topology layouter;
+    layouter.setCancelCondition([this]() { return isCanceled(); });
     layouter.directedGraphDefaultTopology(document);
+    if (isCanceled()) {
+        document->destroy();
+        setError(Canceled, i18n("Import of file \"%1\" was canceled.", file().toLocalFile()));
+        return;
+    }
     setGraphDocument(document);
     setError(None);
 }
@@ -23,11 +23,22 @@
 #include "edgetype.h"
 #include "nodetype.h"
 #include "edge.h"
+#include "graphsnapshot.h"
+#include "spatialgrid.h"
+#include "elementpool_p.h"
+#include "propertytable.h"
+#include "algorithms/distancematrix.h"
 #include "fileformats/fileformatmanager.h"
 #include "logging_p.h"
 #include <KLocalizedString>
+#include <QHash>
+#include <QMetaType>
+#include <QMultiHash>
+#include <QPair>
 #include <QSurfaceFormat>
 #include <QString>
+#include <QThread>
+#include <algorithm>
 
 using namespace GraphTheory;
 
@@ -38,11 +49,18 @@ class GraphTheory::GraphDocumentPrivate {
 public:
     GraphDocumentPrivate()
         : m_valid(false)
+        , m_compact(false)
+        , m_poolNodeIdsValid(false)
         , m_view(0)
         , m_documentUrl(QUrl())
         , m_name(QString())
         , m_lastGeneratedId(0)
         , m_modified(false)
+        , m_revision(0)
+        , m_batchDepth(0)
+        , m_pendingNodes(-1)
+        , m_pendingEdges(-1)
+        , m_distanceMatrixLimit(DistanceMatrix::MaximumSize)
     {
     }
 
@@ -50,18 +68,159 @@ public:
     {
     }
 
+    bool contains(NodePtr node) const
+    {
+        const int index = node->documentIndex();
+        return index >= 0 && index < m_nodes.length() && m_nodes.at(index) == node;
+    }
+
+    bool contains(EdgePtr edge) const
+    {
+        const int index = edge->documentIndex();
+        return index >= 0 && index < m_edges.length() && m_edges.at(index) == edge;
+    }
+
+    /**
+     * Forget the insertions and moves collected by the current batch without announcing them.
+     * The batch depth is kept, such that the owners of open batches can still close them.
+     */
+    void discardBatch()
+    {
+        m_pendingNodes = -1;
+        m_pendingEdges = -1;
+        m_movedNodes.clear();
+        m_nodeMoved.clear();
+    }
+
+    static QRectF nodeBounds(const Node *node)
+    {
+        return QRectF(node->x(), node->y(), 0, 0);
+    }
+
+    /** hand over an object created by another thread to the thread of the document */
+    void adopt(QObject *object) const
+    {
+        if (object->thread() != q->thread()) {
+            object->moveToThread(q->thread());
+        }
+    }
+
+    /** create the object of the pool node at @p index, without registering it */
+    NodePtr createNodeObject(int index) const
+    {
+        const NodePtr node = Node::createObject(q, m_nodePool.ids.at(index),
+            QPointF(m_nodePool.xs.at(index), m_nodePool.ys.at(index)),
+            QColor::fromRgba(m_nodePool.colors.at(index)),
+            m_nodePool.types.at(index)->self(), m_nodePool.propertyRows.at(index));
+        node->setDocumentIndex(index);
+        adopt(node.data());
+        return node;
+    }
+
+    /** create the object of the pool edge at @p index between @p from and @p to, without registering it */
+    EdgePtr createEdgeObject(int index, const NodePtr &from, const NodePtr &to) const
+    {
+        const EdgePtr edge = Edge::createObject(from, to, m_edgePool.types.at(index)->self(),
+            m_edgePool.propertyRows.at(index));
+        edge->setDocumentIndex(index);
+        adopt(edge.data());
+        return edge;
+    }
+
+    /** @return current position of the pool node at @p index, also if it already has an object */
+    QPointF poolPosition(int index) const
+    {
+        const NodePtr node = m_nodeObjects.value(index);
+        return node ? node->position() : QPointF(m_nodePool.xs.at(index), m_nodePool.ys.at(index));
+    }
+
+    /** build the incident edges of all pool nodes, if edges were added since the last build */
+    void updatePoolAdjacency()
+    {
+        if (m_poolAdjacencyOffsets.size() == m_nodePool.count() + 1) {
+            return;
+        }
+        const int nodes = m_nodePool.count();
+        QVector<int> offsets(nodes + 1, 0);
+        for (int i = 0; i < m_edgePool.count(); ++i) {
+            ++offsets[m_edgePool.from.at(i) + 1];
+            if (m_edgePool.to.at(i) != m_edgePool.from.at(i)) {
+                ++offsets[m_edgePool.to.at(i) + 1];
+            }
+        }
+        for (int i = 0; i < nodes; ++i) {
+            offsets[i + 1] += offsets.at(i);
+        }
+        QVector<int> fill = offsets;
+        m_poolAdjacency.resize(offsets.at(nodes));
+        for (int i = 0; i < m_edgePool.count(); ++i) {
+            m_poolAdjacency[fill[m_edgePool.from.at(i)]++] = i;
+            if (m_edgePool.to.at(i) != m_edgePool.from.at(i)) {
+                m_poolAdjacency[fill[m_edgePool.to.at(i)]++] = i;
+            }
+        }
+        m_poolAdjacencyOffsets = offsets;
+    }
+
+    /** build the identifier index of the pool nodes, if it is not maintained yet */
+    void updatePoolNodeIds()
+    {
+        if (m_poolNodeIdsValid) {
+            return;
+        }
+        m_poolNodeIds.clear();
+        m_poolNodeIds.reserve(m_nodePool.count());
+        for (int i = 0; i < m_nodePool.count(); ++i) {
+            const NodePtr node = m_nodeObjects.value(i);
+            m_poolNodeIds.insert(node ? node->id() : m_nodePool.ids.at(i), i);
+        }
+        m_poolNodeIdsValid = true;
+    }
+
+    void clearPools()
+    {
+        m_nodePool.clear();
+        m_edgePool.clear();
+        m_nodeObjects.clear();
+        m_edgeObjects.clear();
+        m_poolAdjacencyOffsets.clear();
+        m_poolAdjacency.clear();
+        m_poolNodeIds.clear();
+        m_poolNodeIdsValid = false;
+    }
+
     GraphDocumentPtr q;
     bool m_valid;
+    bool m_compact; // true while nodes and edges are held by the pools instead of objects
     View *m_view;
     QList<EdgeTypePtr> m_edgeTypes;
     QList<NodeTypePtr> m_nodeTypes;
     NodeList m_nodes;
     EdgeList m_edges;
+    NodePool m_nodePool;
+    EdgePool m_edgePool;
+    // in compact storage, objects of single elements by position; their data supersedes the pools
+    QHash<int, NodePtr> m_nodeObjects;
+    QHash<int, EdgePtr> m_edgeObjects;
+    QVector<int> m_poolAdjacencyOffsets; // per pool node first entry in m_poolAdjacency, outdated if size mismatches
+    QVector<int> m_poolAdjacency; // positions of the incident edges of all pool nodes
+    QMultiHash<int, int> m_poolNodeIds; // positions of pool nodes by their identifiers
+    bool m_poolNodeIdsValid;
+    QMultiHash<int, NodePtr> m_nodeIds; // index of nodes by their identifiers
+    SpatialGrid m_nodeGrid; // index of node positions, items are the positions in m_nodes
+    NodeList m_movedNodes; // nodes moved during current batch
+    QVector<bool> m_nodeMoved; // by position in m_nodes, true if contained in m_movedNodes
 
     QUrl m_documentUrl;
     QString m_name;
     uint m_lastGeneratedId;
     bool m_modified;
+    quint64 m_revision;
+    int m_batchDepth;
+    int m_pendingNodes; // index of first node inserted during current batch, -1 if none
+    int m_pendingEdges; // index of first edge inserted during current batch, -1 if none
+    QHash<QPair<QString, int>, DistanceMatrix> m_distanceMatrices; // by length property and edge type id
+    int m_distanceMatrixLimit;
 };
 
 GraphDocumentPtr GraphDocument::self() const
@@ -72,6 +231,18 @@ GraphDocumentPtr GraphDocument::self() const
 void GraphDocument::destroy()
 {
     d->m_valid = false;
+    if (d->m_compact) {
+        // only objects of single elements exist, which are destroyed like all other objects
+        d->m_compact = false;
+        d->m_nodes = d->m_nodeObjects.values().toVector();
+        d->m_edges = d->m_edgeObjects.values().toVector();
+        foreach (const NodePtr &node, d->m_nodes) {
+            node->setDocumentIndex(-1);
+        }
+        foreach (const EdgePtr &edge, d->m_edges) {
+            edge->setDocumentIndex(-1);
+        }
+    }
     foreach (EdgePtr edge, d->m_edges) {
         edge->destroy();
     }
@@ -80,6 +251,11 @@ void GraphDocument::destroy()
         node->destroy();
     }
     d->m_nodes.clear();
+    d->clearPools();
+    d->m_nodeIds.clear();
+    d->m_nodeGrid.clear();
+    d->m_distanceMatrices.clear();
+    d->discardBatch();
     foreach (NodeTypePtr type, d->m_nodeTypes) {
         type->destroy();
     }
@@ -93,10 +269,36 @@ void GraphDocument::destroy()
     d->q.reset();
 }
 
+void GraphDocument::transferToThread(QThread *thread)
+{
+    moveToThread(thread);
+    foreach (NodeTypePtr type, d->m_nodeTypes) {
+        type->moveToThread(thread);
+        type->style()->moveToThread(thread);
+    }
+    foreach (EdgeTypePtr type, d->m_edgeTypes) {
+        type->moveToThread(thread);
+        type->style()->moveToThread(thread);
+    }
+    foreach (NodePtr node, d->m_nodes) {
+        node->moveToThread(thread);
+    }
+    foreach (EdgePtr edge, d->m_edges) {
+        edge->moveToThread(thread);
+    }
+    foreach (NodePtr node, d->m_nodeObjects) {
+        node->moveToThread(thread);
+    }
+    foreach (EdgePtr edge, d->m_edgeObjects) {
+        edge->moveToThread(thread);
+    }
+}
+
 GraphDocument::GraphDocument()
     : QObject()
     , d(new GraphDocumentPrivate)
 {
+    qRegisterMetaType<GraphTheory::NodeList>("GraphTheory::NodeList");
     ++GraphDocument::objectCounter;
 }
 
@@ -122,10 +324,11 @@ View * GraphDocument::createView(QWidget *parent)
     return d->m_view;
 }
 
-GraphDocumentPtr GraphDocument::create()
+GraphDocumentPtr GraphDocument::create(StorageMode mode)
 {
     GraphDocumentPtr pi(new GraphDocument);
     pi->setQpointer(pi);
+    pi->d->m_compact = mode == CompactStorage;
 
     // create default type
     EdgeType::create(pi)->setName(i18n("default"));
@@ -135,8 +338,14 @@ GraphDocumentPtr GraphDocument::create()
     return pi;
 }
 
+GraphDocument::StorageMode GraphDocument::storageMode() const
+{
+    return d->m_compact ? CompactStorage : ObjectStorage;
+}
+
 NodeList GraphDocument::nodes(NodeTypePtr type) const
 {
+    createObjects();
     if (!type) {
         return d->m_nodes;
     }
@@ -150,8 +359,189 @@ NodeList GraphDocument::nodes(NodeTypePtr type) const
     return nodes;
 }
 
+int GraphDocument::nodeCount() const
+{
+    return d->m_compact ? d->m_nodePool.count() : d->m_nodes.length();
+}
+
+int GraphDocument::edgeCount() const
+{
+    return d->m_compact ? d->m_edgePool.count() : d->m_edges.length();
+}
+
+NodeHandle GraphDocument::nodeHandle(int index) const
+{
+    Q_ASSERT(index >= 0 && index < nodeCount());
+    return NodeHandle(const_cast<GraphDocument*>(this), index);
+}
+
+EdgeHandle GraphDocument::edgeHandle(int index) const
+{
+    Q_ASSERT(index >= 0 && index < edgeCount());
+    return EdgeHandle(const_cast<GraphDocument*>(this), index);
+}
+
+NodeHandle GraphDocument::createNode(const QPointF &position, NodeTypePtr type)
+{
+    if (!type) {
+        type = d->m_nodeTypes.first();
+    }
+    Q_ASSERT(d->m_nodeTypes.contains(type));
+    if (!d->m_compact) {
+        NodePtr node = Node::create(d->q);
+        node->setType(type);
+        node->setPosition(position);
+        return NodeHandle(this, node->documentIndex());
+    }
+    d->m_nodePool.ids.append(generateId());
+    d->m_nodePool.xs.append(position.x());
+    d->m_nodePool.ys.append(position.y());
+    d->m_nodePool.colors.append(QColor(Qt::white).rgba());
+    d->m_nodePool.types.append(type.data());
+    d->m_nodePool.propertyRows.append(type->propertyTable()->allocateRow());
+    if (d->m_poolNodeIdsValid) {
+        d->m_poolNodeIds.insert(d->m_nodePool.ids.last(), d->m_nodePool.count() - 1);
+    }
+    ++d->m_revision;
+    setModified(true);
+    return NodeHandle(this, d->m_nodePool.count() - 1);
+}
+
+EdgeHandle GraphDocument::createEdge(const NodeHandle &from, const NodeHandle &to, EdgeTypePtr type)
+{
+    Q_ASSERT(from.m_document == this && to.m_document == this);
+    if (!type) {
+        type = d->m_edgeTypes.first();
+    }
+    Q_ASSERT(d->m_edgeTypes.contains(type));
+    if (!d->m_compact) {
+        const EdgePtr edge = Edge::create(d->m_nodes.at(from.index()), d->m_nodes.at(to.index()), type);
+        return EdgeHandle(this, edge->documentIndex());
+    }
+    d->m_edgePool.from.append(from.index());
+    d->m_edgePool.to.append(to.index());
+    d->m_edgePool.types.append(type.data());
+    d->m_edgePool.propertyRows.append(type->propertyTable()->allocateRow());
+    d->m_poolAdjacencyOffsets.clear();
+    ++d->m_revision;
+    setModified(true);
+    return EdgeHandle(this, d->m_edgePool.count() - 1);
+}
+
+int GraphDocument::createNodes(const QVector<QPointF> &positions, NodeTypePtr type)
+{
+    const int first = nodeCount();
+    if (!type) {
+        type = d->m_nodeTypes.first();
+    }
+    if (!d->m_compact) {
+        Node::create(d->q, positions, type);
+        return first;
+    }
+    d->m_nodePool.reserve(first + positions.size());
+    PropertyTable *properties = type->propertyTable();
+    const QRgb color = QColor(Qt::white).rgba();
+    foreach (const QPointF &position, positions) {
+        d->m_nodePool.ids.append(generateId());
+        d->m_nodePool.xs.append(position.x());
+        d->m_nodePool.ys.append(position.y());
+        d->m_nodePool.colors.append(color);
+        d->m_nodePool.types.append(type.data());
+        d->m_nodePool.propertyRows.append(properties->allocateRow());
+        if (d->m_poolNodeIdsValid) {
+            d->m_poolNodeIds.insert(d->m_nodePool.ids.last(), d->m_nodePool.count() - 1);
+        }
+    }
+    ++d->m_revision;
+    setModified(true);
+    return first;
+}
+
+int GraphDocument::createEdges(const QVector<QPair<int, int>> &pairs, EdgeTypePtr type)
+{
+    const int first = edgeCount();
+    if (!type) {
+        type = d->m_edgeTypes.first();
+    }
+    if (!d->m_compact) {
+        Edge::create(d->m_nodes, pairs, type);
+        return first;
+    }
+    d->m_edgePool.reserve(first + pairs.size());
+    PropertyTable *properties = type->propertyTable();
+    foreach (const auto &pair, pairs) {
+        Q_ASSERT(pair.first >= 0 && pair.first < d->m_nodePool.count());
+        Q_ASSERT(pair.second >= 0 && pair.second < d->m_nodePool.count());
+        d->m_edgePool.from.append(pair.first);
+        d->m_edgePool.to.append(pair.second);
+        d->m_edgePool.types.append(type.data());
+        d->m_edgePool.propertyRows.append(properties->allocateRow());
+    }
+    d->m_poolAdjacencyOffsets.clear();
+    ++d->m_revision;
+    setModified(true);
+    return first;
+}
+
+NodePtr GraphDocument::node(int id) const
+{
+    if (d->m_compact) {
+        d->updatePoolNodeIds();
+        const int index = d->m_poolNodeIds.value(id, -1);
+        return index == -1 ? NodePtr() : nodeObject(index);
+    }
+    return d->m_nodeIds.value(id);
+}
+
+NodeList GraphDocument::nodesAt(const QRectF &area) const
+{
+    if (d->m_compact) {
+        // the spatial index is not maintained for pools, only objects of the found nodes are created
+        NodeList nodes;
+        for (int i = 0; i < d->m_nodePool.count(); ++i) {
+            if (area.contains(d->poolPosition(i))) {
+                nodes.append(nodeObject(i));
+            }
+        }
+        return nodes;
+    }
+    QVector<int> indices = d->m_nodeGrid.items(area);
+    std::sort(indices.begin(), indices.end());
+    NodeList nodes;
+    nodes.reserve(indices.count());
+    foreach (int index, indices) {
+        nodes.append(d->m_nodes.at(index));
+    }
+    return nodes;
+}
+
+NodePtr GraphDocument::nodeAt(const QPointF &point, qreal radius) const
+{
+    const QRectF area(point.x() - radius, point.y() - radius, 2 * radius, 2 * radius);
+    if (d->m_compact) {
+        for (int i = d->m_nodePool.count() - 1; i >= 0; --i) {
+            const QPointF offset = d->poolPosition(i) - point;
+            if (offset.x() * offset.x() + offset.y() * offset.y() <= radius * radius) {
+                return nodeObject(i);
+            }
+        }
+        return NodePtr();
+    }
+    int topmost = -1;
+    foreach (int index, d->m_nodeGrid.items(area)) {
+        const NodePtr &node = d->m_nodes.at(index);
+        const qreal dx = node->x() - point.x();
+        const qreal dy = node->y() - point.y();
+        if (index > topmost && dx * dx + dy * dy <= radius * radius) {
+            topmost = index;
+        }
+    }
+    return topmost == -1 ? NodePtr() : d->m_nodes.at(topmost);
+}
+
 EdgeList GraphDocument::edges(EdgeTypePtr type) const
 {
+    createObjects();
     if (!type) {
         return d->m_edges;
     }
@@ -170,16 +560,35 @@ void GraphDocument::insert(NodePtr node)
     Q_ASSERT(node);
     Q_ASSERT(node->document() == d->q);
 
-    if (!node || d->m_nodes.contains(node)) {
+    // new objects are appended after the nodes of the compact storage
+    createObjects();
+    if (!node || d->contains(node)) {
         return;
     }
     if (0 <= node->id() && (uint)node->id() < d->m_lastGeneratedId) {
         d->m_lastGeneratedId = node->id();
     }
 
+    if (d->m_batchDepth > 0) {
+        if (d->m_pendingNodes < 0) {
+            d->m_pendingNodes = d->m_nodes.length();
+        }
+        node->setDocumentIndex(d->m_nodes.length());
+        d->m_nodeGrid.insert(d->m_nodes.length(), d->nodeBounds(node.data()));
+        d->m_nodes.append(node);
+        d->m_nodeIds.insert(node->id(), node);
+        ++d->m_revision;
+        setModified(true);
+        return;
+    }
+
     emit nodeAboutToBeAdded(node, d->m_nodes.length());
+    node->setDocumentIndex(d->m_nodes.length());
+    d->m_nodeGrid.insert(d->m_nodes.length(), d->nodeBounds(node.data()));
     d->m_nodes.append(node);
+    d->m_nodeIds.insert(node->id(), node);
     emit nodeAdded();
+    ++d->m_revision;
     setModified(true);
 }
 
@@ -189,13 +598,27 @@ void GraphDocument::insert(EdgePtr edge)
     Q_ASSERT(edge->from()->document() == d->q);
     Q_ASSERT(edge->to()->document() == d->q);
 
-    if (!edge || d->m_edges.contains(edge)) {
+    createObjects();
+    if (!edge || d->contains(edge)) {
+        return;
+    }
+
+    if (d->m_batchDepth > 0) {
+        if (d->m_pendingEdges < 0) {
+            d->m_pendingEdges = d->m_edges.length();
+        }
+        edge->setDocumentIndex(d->m_edges.length());
+        d->m_edges.append(edge);
+        ++d->m_revision;
+        setModified(true);
         return;
     }
 
     emit edgeAboutToBeAdded(edge, d->m_edges.length());
+    edge->setDocumentIndex(d->m_edges.length());
     d->m_edges.append(edge);
     emit edgeAdded();
+    ++d->m_revision;
     setModified(true);
 }
 
@@ -211,6 +634,7 @@ void GraphDocument::insert(NodeTypePtr type)
     emit nodeTypeAboutToBeAdded(type, d->m_nodeTypes.length());
     d->m_nodeTypes.append(type);
     emit nodeTypeAdded();
+    ++d->m_revision;
     setModified(true);
 }
 
@@ -225,7 +649,20 @@ void GraphDocument::insert(EdgeTypePtr type)
     }
     emit edgeTypeAboutToBeAdded(type, d->m_edgeTypes.length());
     d->m_edgeTypes.append(type);
+    connect(type.data(), &EdgeType::directionChanged, this, [=] () {
+        updateRevision();
+    });
+    connect(type.data(), &EdgeType::dynamicPropertyValuesChanged, this, [=] () {
+        updateRevision();
+    });
+    connect(type.data(), &EdgeType::dynamicPropertyRenamed, this, [=] () {
+        updateRevision();
+    });
+    connect(type.data(), &EdgeType::dynamicPropertyRemoved, this, [=] () {
+        updateRevision();
+    });
     emit edgeTypeAdded();
+    ++d->m_revision;
     setModified(true);
 }
 
@@ -234,12 +671,31 @@ void GraphDocument::remove(NodePtr node)
     if (node->isValid()) {
         node->destroy();
     }
-    int index = d->m_nodes.indexOf(node);
-    if (index >= 0) {
-        emit nodesAboutToBeRemoved(index,index);
-        d->m_nodes.removeAt(index);
+    if (d->contains(node)) {
+        // row numbers of removals are only meaningful if all insertions are published
+        flushBatch();
+
+        // fill the gap with the last node instead of shifting all following nodes
+        const int index = node->documentIndex();
+        const int last = d->m_nodes.length() - 1;
+        emit nodesAboutToBeRemoved(index, index);
+        if (index != last) {
+            d->m_nodes[index] = d->m_nodes.at(last);
+            d->m_nodes.at(index)->setDocumentIndex(index);
+            d->m_nodeGrid.insert(index, d->nodeBounds(d->m_nodes.at(index).data()));
+        }
+        d->m_nodeGrid.remove(last);
+        d->m_nodes.removeLast();
+        node->setDocumentIndex(-1);
+        d->m_nodeIds.remove(node->id(), node);
         emit nodesRemoved();
+        // for models, the former last node now moves from the end of the list to the freed slot
+        if (index < last - 1) {
+            emit nodeAboutToBeMoved(last - 1, index);
+            emit nodeMoved();
+        }
     }
+    ++d->m_revision;
     setModified(true);
 }
 
@@ -248,17 +704,34 @@ void GraphDocument::remove(EdgePtr edge)
     if (edge->isValid()) {
         edge->destroy();
     }
-    int index = d->m_edges.indexOf(edge);
-    if (index >= 0) {
-        emit edgesAboutToBeRemoved(index,index);
-        d->m_edges.removeAt(index);
+    if (d->contains(edge)) {
+        // row numbers of removals are only meaningful if all insertions are published
+        flushBatch();
+
+        // fill the gap with the last edge instead of shifting all following edges
+        const int index = edge->documentIndex();
+        const int last = d->m_edges.length() - 1;
+        emit edgesAboutToBeRemoved(index, index);
+        if (index != last) {
+            d->m_edges[index] = d->m_edges.at(last);
+            d->m_edges.at(index)->setDocumentIndex(index);
+        }
+        d->m_edges.removeLast();
+        edge->setDocumentIndex(-1);
         emit edgesRemoved();
+        // for models, the former last edge now moves from the end of the list to the freed slot
+        if (index < last - 1) {
+            emit edgeAboutToBeMoved(last - 1, index);
+            emit edgeMoved();
+        }
     }
+    ++d->m_revision;
     setModified(true);
 }
 
 void GraphDocument::remove(NodeTypePtr type)
 {
+    createObjects();
     foreach (NodePtr node, d->m_nodes) {
         if (node->type() == type) {
             node->destroy();
@@ -271,21 +744,25 @@ void GraphDocument::remove(NodeTypePtr type)
     emit nodeTypesAboutToBeRemoved(index, index);
     d->m_nodeTypes.removeOne(type);
     emit nodeTypesRemoved();
+    ++d->m_revision;
     setModified(true);
 }
 
 void GraphDocument::remove(EdgeTypePtr type)
 {
+    createObjects();
     foreach (EdgePtr edge, edges(type)) {
         edge->destroy();
     }
     if (type->isValid()) {
         type->destroy();
     }
+    type->disconnect(this);
     int index = d->m_edgeTypes.indexOf(type);
     emit edgeTypesAboutToBeRemoved(index, index);
     d->m_edgeTypes.removeOne(type);
     emit edgeTypesRemoved();
+    ++d->m_revision;
     setModified(true);
 }
 
@@ -299,6 +776,181 @@ QList< NodeTypePtr > GraphDocument::nodeTypes() const
     return d->m_nodeTypes;
 }
 
+void GraphDocument::beginBatch()
+{
+    ++d->m_batchDepth;
+}
+
+void GraphDocument::endBatch()
+{
+    Q_ASSERT(d->m_batchDepth > 0);
+    if (d->m_batchDepth <= 0) {
+        return;
+    }
+    if (--d->m_batchDepth == 0) {
+        flushBatch();
+    }
+}
+
+void GraphDocument::flushBatch()
+{
+    if (d->m_pendingNodes >= 0) {
+        const int first = d->m_pendingNodes;
+        d->m_pendingNodes = -1;
+        emit nodesAboutToBeAdded(first, d->m_nodes.length() - 1);
+        emit nodesAdded();
+    }
+    if (d->m_pendingEdges >= 0) {
+        const int first = d->m_pendingEdges;
+        d->m_pendingEdges = -1;
+        emit edgesAboutToBeAdded(first, d->m_edges.length() - 1);
+        emit edgesAdded();
+    }
+    if (!d->m_movedNodes.isEmpty()) {
+        NodeList moved;
+        moved.swap(d->m_movedNodes);
+        foreach (const NodePtr &node, moved) {
+            d->m_nodeMoved[node->documentIndex()] = false;
+            emit node->positionChanged(node->position());
+        }
+        emit nodePositionsChanged(moved);
+    }
+}
+
+quint64 GraphDocument::revision() const
+{
+    return d->m_revision;
+}
+
+DistanceMatrix GraphDocument::distanceMatrix(const QString &lengthProperty, EdgeTypePtr type)
+{
+    const QPair<QString, int> key(lengthProperty, type ? type->id() : -1);
+    if (hasDistanceMatrix(lengthProperty, type)) {
+        return d->m_distanceMatrices.value(key);
+    }
+
+    // cached matrices of older revisions are outdated
+    QHash<QPair<QString, int>, DistanceMatrix>::iterator iter = d->m_distanceMatrices.begin();
+    while (iter != d->m_distanceMatrices.end()) {
+        if (iter.value().revision() != d->m_revision) {
+            iter = d->m_distanceMatrices.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+
+    const GraphSnapshot snapshot(d->q, lengthProperty);
+    const DistanceMatrix matrix(snapshot, type ? snapshot.edgeTypeIndex(type) : -1, d->m_distanceMatrixLimit);
+    d->m_distanceMatrices.insert(key, matrix);
+    return matrix;
+}
+
+int GraphDocument::distanceMatrixLimit() const
+{
+    return d->m_distanceMatrixLimit;
+}
+
+void GraphDocument::setDistanceMatrixLimit(int nodes)
+{
+    d->m_distanceMatrixLimit = qBound(0, nodes, int(DistanceMatrix::MaximumSize));
+    d->m_distanceMatrices.clear();
+}
+
+bool GraphDocument::hasDistanceMatrix(const QString &lengthProperty, EdgeTypePtr type) const
+{
+    const QPair<QString, int> key(lengthProperty, type ? type->id() : -1);
+    QHash<QPair<QString, int>, DistanceMatrix>::const_iterator iter = d->m_distanceMatrices.constFind(key);
+    return iter != d->m_distanceMatrices.constEnd() && iter.value().revision() == d->m_revision;
+}
+
+void GraphDocument::updateRevision()
+{
+    ++d->m_revision;
+}
+
+void GraphDocument::createObjects() const
+{
+    if (!d->m_compact) {
+        return;
+    }
+    // objects that already exist for single elements are taken over
+    const int nodeCount = d->m_nodePool.count();
+    d->m_nodes.reserve(nodeCount);
+    for (int i = 0; i < nodeCount; ++i) {
+        NodePtr node = d->m_nodeObjects.take(i);
+        if (!node) {
+            node = d->createNodeObject(i);
+        }
+        d->m_nodeGrid.insert(i, d->nodeBounds(node.data()));
+        d->m_nodes.append(node);
+        d->m_nodeIds.insert(node->id(), node);
+    }
+    const int edgeCount = d->m_edgePool.count();
+    d->m_edges.reserve(edgeCount);
+    for (int i = 0; i < edgeCount; ++i) {
+        EdgePtr edge = d->m_edgeObjects.take(i);
+        if (!edge) {
+            edge = d->createEdgeObject(i, d->m_nodes.at(d->m_edgePool.from.at(i)),
+                                       d->m_nodes.at(d->m_edgePool.to.at(i)));
+        }
+        d->m_edges.append(edge);
+    }
+    d->m_compact = false;
+    d->clearPools();
+}
+
+void GraphDocument::createEdgeObjects(const Node *node) const
+{
+    if (!d->m_compact) {
+        return;
+    }
+    const int index = node->documentIndex();
+    if (index < 0 || d->m_nodeObjects.value(index).data() != node) {
+        return;
+    }
+    d->updatePoolAdjacency();
+    for (int i = d->m_poolAdjacencyOffsets.at(index); i < d->m_poolAdjacencyOffsets.at(index + 1); ++i) {
+        edgeObject(d->m_poolAdjacency.at(i));
+    }
+}
+
+NodePool * GraphDocument::nodePool(int index) const
+{
+    return d->m_compact && !d->m_nodeObjects.contains(index) ? &d->m_nodePool : nullptr;
+}
+
+EdgePool * GraphDocument::edgePool(int index) const
+{
+    return d->m_compact && !d->m_edgeObjects.contains(index) ? &d->m_edgePool : nullptr;
+}
+
+NodePtr GraphDocument::nodeObject(int index) const
+{
+    if (!d->m_compact) {
+        return d->m_nodes.at(index);
+    }
+    NodePtr &node = d->m_nodeObjects[index];
+    if (!node) {
+        node = d->createNodeObject(index);
+    }
+    return node;
+}
+
+EdgePtr GraphDocument::edgeObject(int index) const
+{
+    if (!d->m_compact) {
+        return d->m_edges.at(index);
+    }
+    EdgePtr edge = d->m_edgeObjects.value(index);
+    if (!edge) {
+        // the objects of the end points are created first, edges attach to them
+        edge = d->createEdgeObject(index, nodeObject(d->m_edgePool.from.at(index)),
+                                   nodeObject(d->m_edgePool.to.at(index)));
+        d->m_edgeObjects.insert(index, edge);
+    }
+    return edge;
+}
+
 uint GraphDocument::generateId()
 {
     return ++d->m_lastGeneratedId;
@@ -309,6 +961,53 @@ void GraphDocument::setQpointer(GraphDocumentPtr q)
     d->q = q;
 }
 
+void GraphDocument::updateNodeId(NodePtr node, int oldId)
+{
+    if (d->m_compact) {
+        updatePoolNodeId(node->documentIndex(), oldId, node->id());
+        return;
+    }
+    // only nodes registered at the document are indexed
+    if (d->m_nodeIds.remove(oldId, node) == 0) {
+        return;
+    }
+    d->m_nodeIds.insert(node->id(), node);
+}
+
+void GraphDocument::updatePoolNodeId(int index, int oldId, int id)
+{
+    if (d->m_poolNodeIdsValid && d->m_poolNodeIds.remove(oldId, index) > 0) {
+        d->m_poolNodeIds.insert(id, index);
+    }
+}
+
+bool GraphDocument::updateNodePosition(const Node *node)
+{
+    // only nodes registered at the document are indexed
+    const int index = node->documentIndex();
+    if (index < 0 || index >= d->m_nodes.length() || d->m_nodes.at(index).data() != node) {
+        return true;
+    }
+    d->m_nodeGrid.insert(index, d->nodeBounds(node));
+
+    if (d->m_batchDepth == 0) {
+        emit nodePositionsChanged(NodeList() << d->m_nodes.at(index));
+        return true;
+    }
+    // nodes inserted during the batch are announced with their final position
+    if (d->m_pendingNodes >= 0 && index >= d->m_pendingNodes) {
+        return false;
+    }
+    if (d->m_nodeMoved.length() <= index) {
+        d->m_nodeMoved.resize(d->m_nodes.length());
+    }
+    if (!d->m_nodeMoved.at(index)) {
+        d->m_nodeMoved[index] = true;
+        d->m_movedNodes.append(d->m_nodes.at(index));
+    }
+    return false;
+}
+
 //BEGIN file stuff
 QString GraphDocument::documentName() const
 {
@@ -24,17 +24,27 @@
 #include "graphtheory_export.h"
 #include "typenames.h"
 #include "node.h"
+#include "nodehandle.h"
+#include "edgehandle.h"
 #include "edgetype.h"
 #include "nodetype.h"
 
 #include <QObject>
 #include <QSharedPointer>
 #include <QList>
+#include <QPair>
+#include <QRectF>
+#include <QVector>
+
+class QThread;
 
 namespace GraphTheory
 {
 
 class GraphDocumentPrivate;
+class DistanceMatrix;
+struct NodePool;
+struct EdgePool;
 class View;
 
 /**
@@ -45,12 +55,31 @@ class GRAPHTHEORY_EXPORT GraphDocument : public QObject
     Q_OBJECT
 
 public:
+    /**
+     * Storage of the nodes and edges of a document.
+     */
+    enum StorageMode {
+        ObjectStorage,  //!< every node and edge is a Node or Edge object
+        CompactStorage  //!< nodes and edges are stored in arrays until their objects are needed
+    };
+
     /**
      * Creates a new GraphDocument.
      *
+     * A document in CompactStorage keeps the data of its nodes and edges in arrays and is
+     * accessed by NodeHandle and EdgeHandle, which needs a small fraction of the memory of
+     * Node and Edge objects. Accesses to single elements, i.e., node(), nodesAt(), nodeAt(),
+     * NodeHandle::node() and EdgeHandle::edge(), only create the objects of these elements;
+     * Node::edges() additionally creates the objects of the incident edges. Accesses to all
+     * elements or changes of the set of elements, e.g., nodes(), edges(), insertion and removal
+     * of objects, create the objects of all nodes and edges and switch the document to
+     * ObjectStorage. This mode is meant for importers and algorithms that build or process
+     * large graphs without showing them.
+     *
+     * @param mode  the initial storage mode
      * @return a GraphDocument object
      */
-    static GraphDocumentPtr create();
+    static GraphDocumentPtr create(StorageMode mode = ObjectStorage);
 
     /** Destroys the document */
     virtual ~GraphDocument();
@@ -65,8 +94,20 @@ public:
      */
     void destroy();
 
+    /**
+     * Move the document and all of its elements, types and type styles to @p thread.
+     * This must be called from the thread that currently owns the document, e.g.
+     * by a file format plugin that created the document in a worker thread.
+     */
+    void transferToThread(QThread *thread);
+
     View * createView(QWidget *parent);
 
+    /**
+     * @return the current storage mode, see create()
+     */
+    StorageMode storageMode() const;
+
     /**
      * @return list of nodes contained at the document
      */
@@ -77,6 +118,93 @@ public:
      */
     EdgeList edges(EdgeTypePtr type = EdgeTypePtr()) const;
 
+    /**
+     * @return number of nodes, without creating node objects
+     */
+    int nodeCount() const;
+
+    /**
+     * @return number of edges, without creating edge objects
+     */
+    int edgeCount() const;
+
+    /**
+     * @return handle of the node at position @p index of nodes()
+     */
+    NodeHandle nodeHandle(int index) const;
+
+    /**
+     * @return handle of the edge at position @p index of edges()
+     */
+    EdgeHandle edgeHandle(int index) const;
+
+    /**
+     * Create a node at @p position. In CompactStorage, no Node object is created; otherwise
+     * this is equivalent to Node::create().
+     *
+     * @param position  the position of the node
+     * @param type  the NodeType of the node, the default node type if not set
+     * @return handle of the new node
+     */
+    NodeHandle createNode(const QPointF &position, NodeTypePtr type = NodeTypePtr());
+
+    /**
+     * Create an edge from @p from to @p to. In CompactStorage, no Edge object is created;
+     * otherwise this is equivalent to Edge::create().
+     *
+     * @param type  the EdgeType of the edge, the default edge type if not set
+     * @return handle of the new edge
+     */
+    EdgeHandle createEdge(const NodeHandle &from, const NodeHandle &to, EdgeTypePtr type = EdgeTypePtr());
+
+    /**
+     * Create one node at each of the given positions in one batch, like the bulk version of
+     * Node::create(). In CompactStorage, no Node objects are created.
+     *
+     * @param positions  the positions of the nodes
+     * @param type  the NodeType of the nodes, the default node type if not set
+     * @return position of the first created node in nodes(), the others follow in order
+     */
+    int createNodes(const QVector<QPointF> &positions, NodeTypePtr type = NodeTypePtr());
+
+    /**
+     * Create one edge for each pair of node positions in nodes() in one batch, like the bulk
+     * version of Edge::create(). In CompactStorage, no Edge objects are created.
+     *
+     * @param pairs  the positions of from and to node of each edge
+     * @param type  the EdgeType of the edges, the default edge type if not set
+     * @return position of the first created edge in edges(), the others follow in order
+     */
+    int createEdges(const QVector<QPair<int, int>> &pairs, EdgeTypePtr type = EdgeTypePtr());
+
+    /**
+     * Look up the node with identifier @p id. The lookup uses an index that is kept in sync
+     * with insert(), remove() and Node::setId(), hence it needs constant time on average.
+     * If several nodes share the same identifier, the most recently registered one is returned.
+     *
+     * @param id  the identifier of the node
+     * @return the node with identifier @p id or an invalid pointer if no such node exists
+     */
+    NodePtr node(int id) const;
+
+    /**
+     * Look up all nodes whose position lies inside @p area. The lookup uses a spatial index
+     * that is kept in sync with insert(), remove() and node movements, hence its cost depends
+     * on the number of nodes close to @p area and not on the size of the document.
+     *
+     * @param area  the area in global coordinates
+     * @return nodes inside @p area, ordered by their position in nodes()
+     */
+    NodeList nodesAt(const QRectF &area) const;
+
+    /**
+     * Look up the node closest to the viewer, i.e., the last one in nodes(), whose position has
+     * at most distance @p radius to @p point.
+     *
+     * @return the node or an invalid pointer if no such node exists
+     */
+    NodePtr nodeAt(const QPointF &point, qreal radius) const;
+
     /**
      * Add @p node to this document. The node must be correctly setup before, i.e.,
      * its type and document values have to be set. When inserting a node already in the list,
@@ -111,7 +239,9 @@ public:
 
     /**
      * Remove @p node from this document. If the node is valid, Node::destroy() will be called,
-     * otherwise it will only be removed.
+     * otherwise it will only be removed. Removal takes constant time: the last node of the node
+     * list is moved to the position of the removed node, which is announced by nodeAboutToBeMoved()
+     * after nodesRemoved() was emitted.
      *
      * @param node  the node to be removed from the document
      */
@@ -119,7 +249,9 @@ public:
 
     /**
      * Remove @p edge from this document. If the edge is valid, Edge::destroy() will be called,
-     * otherwise it will only be removed.
+     * otherwise it will only be removed. Removal takes constant time: the last edge of the edge
+     * list is moved to the position of the removed edge, which is announced by edgeAboutToBeMoved()
+     * after edgesRemoved() was emitted.
      *
      * @param edge  the edge to be removed from the document
      */
@@ -157,6 +289,65 @@ public:
      */
     QList<NodeTypePtr> nodeTypes() const;
 
+    /**
+     * Start a batch of node and edge insertions. While a batch is open, insert() does not emit
+     * nodeAboutToBeAdded()/nodeAdded() and edgeAboutToBeAdded()/edgeAdded() for each element.
+     * Instead, all nodes and edges inserted during the batch are announced at endBatch() by one
+     * nodesAboutToBeAdded()/nodesAdded() and one edgesAboutToBeAdded()/edgesAdded() pair.
+     * Batches can be nested; only closing the outermost batch emits the signals. Removing a node
+     * or an edge during a batch first announces all pending insertions.
+     *
+     * Position changes of nodes that were announced before the batch are coalesced as well:
+     * each moved node emits Node::positionChanged() once at endBatch(), followed by a single
+     * nodePositionsChanged() for all of them.
+     *
+     * @see BatchGuard
+     */
+    void beginBatch();
+
+    /**
+     * Close a batch that was opened with beginBatch().
+     */
+    void endBatch();
+
+    /**
+     * The revision is increased whenever nodes, edges or edge types are added or removed and
+     * whenever an edge changes its type or a dynamic property value. The direction change of an
+     * edge type also increases the revision. Derived data like GraphSnapshot use the revision to
+     * detect that they became outdated.
+     *
+     * @return current revision of the document structure
+     */
+    quint64 revision() const;
+
+    /**
+     * Distances between all pairs of nodes, using the dynamic edge property @p lengthProperty as
+     * edge length and considering only edges of @p type, or all edges if @p type is null. Rows and
+     * columns are the positions of the nodes in nodes(). The matrix is cached and recomputed only
+     * after the revision changed.
+     *
+     * @return distance matrix for the current revision
+     */
+    DistanceMatrix distanceMatrix(const QString &lengthProperty, EdgeTypePtr type = EdgeTypePtr());
+
+    /**
+     * @return @c true if distanceMatrix() for @p lengthProperty and @p type is cached for the
+     *         current revision
+     */
+    bool hasDistanceMatrix(const QString &lengthProperty, EdgeTypePtr type = EdgeTypePtr()) const;
+
+    /**
+     * @return largest number of nodes for which distanceMatrix() computes a matrix, larger
+     *         documents get a null matrix; default is DistanceMatrix::MaximumSize
+     */
+    int distanceMatrixLimit() const;
+
+    /**
+     * Set the largest number of nodes for distance matrices to @p nodes, which is bounded by
+     * DistanceMatrix::MaximumSize. Cached matrices are discarded.
+     */
+    void setDistanceMatrixLimit(int nodes);
+
     /**
      * Generate a unique unique identifier. This identifier is uniquely generated within this
      * document. But it is not checked, if it is already used for any node.
@@ -177,12 +368,28 @@ public:
 Q_SIGNALS:
     void nodeAboutToBeAdded(NodePtr,int);
     void nodeAdded();
+    /** nodes from @p first to @p last are already contained in nodes() when emitted **/
+    void nodesAboutToBeAdded(int first, int last);
+    void nodesAdded();
     void nodesAboutToBeRemoved(int,int);
     void nodesRemoved();
+    void nodeAboutToBeMoved(int from, int to);
+    void nodeMoved();
     void edgeAboutToBeAdded(EdgePtr,int);
     void edgeAdded();
+    /** edges from @p first to @p last are already contained in edges() when emitted **/
+    void edgesAboutToBeAdded(int first, int last);
+    void edgesAdded();
     void edgesAboutToBeRemoved(int,int);
     void edgesRemoved();
+    void edgeAboutToBeMoved(int from, int to);
+    void edgeMoved();
+    /**
+     * Emitted after the positions of @p nodes changed, either for a single node or once for
+     * all nodes moved during a batch. Views should prefer this signal to Node::positionChanged()
+     * to update their geometry once per change set.
+     */
+    void nodePositionsChanged(const GraphTheory::NodeList &nodes);
     void nodeTypeAboutToBeAdded(NodeTypePtr,int);
     void nodeTypeAdded();
     void nodeTypesAboutToBeRemoved(int,int);
@@ -270,8 +477,94 @@ private:
     Q_DISABLE_COPY(GraphDocument)
     const QScopedPointer<GraphDocumentPrivate> d;
     void setQpointer(GraphDocumentPtr q);
+    /**
+     * Update the node identifier index after the identifier of @p node changed from @p oldId.
+     * Called by Node::setId().
+     */
+    void updateNodeId(NodePtr node, int oldId);
+    /**
+     * Update the identifier index of a document in CompactStorage after the identifier of the
+     * node at position @p index changed from @p oldId to @p id.
+     */
+    void updatePoolNodeId(int index, int oldId, int id);
+    /**
+     * Update the spatial node index after the position of @p node changed.
+     * Called by Node::setPosition().
+     *
+     * @return @c true if the change shall be announced immediately, @c false if it is
+     *         announced at the end of the current batch
+     */
+    bool updateNodePosition(const Node *node);
+    /**
+     * Emit the coalesced insertion signals for all nodes and edges inserted during the current batch.
+     */
+    void flushBatch();
+    /**
+     * Increase the structural revision, called by Edge on type and property changes.
+     */
+    void updateRevision();
+    /**
+     * Create the objects of all nodes and edges of a document in CompactStorage and switch to
+     * ObjectStorage. The objects are inserted without any signal, since the set of nodes and
+     * edges does not change. Objects already created for single elements are taken over.
+     */
+    void createObjects() const;
+    /**
+     * Create the objects of all edges incident to @p node in CompactStorage, such that the
+     * adjacency list of @p node is complete. Called by Node before accessing its edges.
+     */
+    void createEdgeObjects(const Node *node) const;
+    /**
+     * @return arrays of the nodes in CompactStorage if the node at position @p index has no
+     *         object yet, otherwise null
+     */
+    NodePool * nodePool(int index) const;
+    /**
+     * @return arrays of the edges in CompactStorage if the edge at position @p index has no
+     *         object yet, otherwise null
+     */
+    EdgePool * edgePool(int index) const;
+    /**
+     * @return object of the node at position @p index, which is created in CompactStorage
+     *         if it does not exist yet
+     */
+    NodePtr nodeObject(int index) const;
+    /**
+     * @return object of the edge at position @p index, which is created together with the
+     *         objects of its end points in CompactStorage if it does not exist yet
+     */
+    EdgePtr edgeObject(int index) const;
+    friend class Node;
+    friend class Edge;
+    friend class NodeHandle;
+    friend class EdgeHandle;
     static uint objectCounter;
 };
+
+/**
+ * \class BatchGuard
+ * Opens a batch at a GraphDocument for the lifetime of the guard object.
+ *
+ * @see GraphDocument::beginBatch()
+ */
+class BatchGuard
+{
+public:
+    explicit BatchGuard(GraphDocumentPtr document)
+        : m_document(document)
+    {
+        m_document->beginBatch();
+    }
+
+    ~BatchGuard()
+    {
+        m_document->endBatch();
+    }
+
+private:
+    Q_DISABLE_COPY(BatchGuard)
+    const GraphDocumentPtr m_document;
+};
 }
 
 #endif
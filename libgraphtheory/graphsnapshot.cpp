@@ -0,0 +1,266 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "graphsnapshot.h"
+#include "graphdocument.h"
+#include "node.h"
+#include "edge.h"
+#include "edgetype.h"
+#include "propertytable.h"
+#include "logging_p.h"
+
+#include <QHash>
+
+using namespace GraphTheory;
+
+namespace
+{
+/**
+ * Create CSR adjacency of arcs with indices in range [@p begin, @p end) by counting sort,
+ * i.e., in time linear to the number of nodes and arcs.
+ */
+GraphSnapshot::Adjacency createAdjacency(int nodeCount,
+                                         const QVector<int> &keys,
+                                         const QVector<int> &values,
+                                         const QVector<int> &arcEdges,
+                                         const QVector<qreal> &edgeWeights,
+                                         int begin, int end)
+{
+    GraphSnapshot::Adjacency adjacency;
+    adjacency.offsets.fill(0, nodeCount + 1);
+    for (int i = begin; i < end; ++i) {
+        ++adjacency.offsets[keys.at(i) + 1];
+    }
+    for (int v = 0; v < nodeCount; ++v) {
+        adjacency.offsets[v + 1] += adjacency.offsets[v];
+    }
+
+    const int size = end - begin;
+    adjacency.nodes.resize(size);
+    adjacency.edges.resize(size);
+    adjacency.weights.resize(size);
+    QVector<int> position = adjacency.offsets;
+    for (int i = begin; i < end; ++i) {
+        const int slot = position[keys.at(i)]++;
+        adjacency.nodes[slot] = values.at(i);
+        adjacency.edges[slot] = arcEdges.at(i);
+        adjacency.weights[slot] = edgeWeights.at(arcEdges.at(i));
+    }
+    return adjacency;
+}
+}
+
+GraphSnapshot::GraphSnapshot()
+    : m_revision(0)
+    , m_nodeCount(0)
+    , m_edgeCount(0)
+    , m_out(1)
+    , m_in(1)
+{
+    m_out[0].offsets.fill(0, 1);
+    m_in[0].offsets.fill(0, 1);
+}
+
+GraphSnapshot::GraphSnapshot(GraphDocumentPtr document, const QString &weightProperty)
+    : m_document(document)
+    , m_weightProperty(weightProperty)
+    , m_revision(document->revision())
+    , m_nodeCount(document->nodeCount())
+    , m_edgeCount(document->edgeCount())
+{
+    const int nodeCount = m_nodeCount;
+    const int edgeCount = m_edgeCount;
+    const QList<EdgeTypePtr> types = document->edgeTypes();
+    const int typeCount = types.length();
+
+    QHash<const EdgeType*, int> typeIndices;
+    QVector<bool> bidirectional(typeCount);
+    QVector<int> weightColumns(typeCount, -1);
+    m_edgeTypes.reserve(typeCount);
+    for (int t = 0; t < typeCount; ++t) {
+        m_edgeTypes.append(types.at(t).data());
+        typeIndices.insert(types.at(t).data(), t);
+        bidirectional[t] = types.at(t)->direction() == EdgeType::Bidirectional;
+        if (!m_weightProperty.isEmpty()) {
+            weightColumns[t] = types.at(t)->propertyTable()->column(m_weightProperty);
+        }
+    }
+
+    // edge arrays; node indices are positions in the node list of the document
+    m_edgeFrom.resize(edgeCount);
+    m_edgeTo.resize(edgeCount);
+    m_edgeType.resize(edgeCount);
+    m_edgeWeight.resize(edgeCount);
+    QVector<int> typeOffsets(typeCount + 1, 0);
+    int unknownTypes = 0;
+    for (int e = 0; e < edgeCount; ++e) {
+        const EdgeHandle edge = document->edgeHandle(e);
+        const int t = typeIndices.value(edge.type().data(), -1);
+        m_edgeFrom[e] = edge.from().index();
+        m_edgeTo[e] = edge.to().index();
+        m_edgeType[e] = t;
+        if (t < 0) {
+            // edge of a type that is not registered at the document, it is not traversable
+            m_edgeWeight[e] = 1;
+            ++unknownTypes;
+            continue;
+        }
+        m_edgeWeight[e] = m_weightProperty.isEmpty() ? 1 : types.at(t)->propertyTable()->realValue(weightColumns.at(t), edge.propertyRow());
+        // bidirectional edges are traversable in both directions
+        typeOffsets[t + 1] += (bidirectional.at(t) && m_edgeFrom.at(e) != m_edgeTo.at(e)) ? 2 : 1;
+    }
+    if (unknownTypes > 0) {
+        qCWarning(GRAPHTHEORY_GENERAL) << "Skipping" << unknownTypes << "edges of unknown edge types in graph snapshot";
+    }
+    for (int t = 0; t < typeCount; ++t) {
+        typeOffsets[t + 1] += typeOffsets[t];
+    }
+
+    // list of arcs, grouped by edge type
+    const int arcCount = typeOffsets.at(typeCount);
+    QVector<int> arcSource(arcCount);
+    QVector<int> arcTarget(arcCount);
+    QVector<int> arcEdge(arcCount);
+    QVector<int> position = typeOffsets;
+    for (int e = 0; e < edgeCount; ++e) {
+        const int t = m_edgeType.at(e);
+        if (t < 0) {
+            continue;
+        }
+        int slot = position[t]++;
+        arcSource[slot] = m_edgeFrom.at(e);
+        arcTarget[slot] = m_edgeTo.at(e);
+        arcEdge[slot] = e;
+        if (bidirectional.at(t) && m_edgeFrom.at(e) != m_edgeTo.at(e)) {
+            slot = position[t]++;
+            arcSource[slot] = m_edgeTo.at(e);
+            arcTarget[slot] = m_edgeFrom.at(e);
+            arcEdge[slot] = e;
+        }
+    }
+
+    // incoming adjacency is the reverse of the outgoing adjacency
+    m_out.resize(typeCount + 1);
+    m_in.resize(typeCount + 1);
+    for (int t = 0; t < typeCount; ++t) {
+        m_out[t] = createAdjacency(nodeCount, arcSource, arcTarget, arcEdge, m_edgeWeight,
+                                   typeOffsets.at(t), typeOffsets.at(t + 1));
+        m_in[t] = createAdjacency(nodeCount, arcTarget, arcSource, arcEdge, m_edgeWeight,
+                                  typeOffsets.at(t), typeOffsets.at(t + 1));
+    }
+    if (typeCount == 1) {
+        m_out[typeCount] = m_out.at(0);
+        m_in[typeCount] = m_in.at(0);
+    } else {
+        m_out[typeCount] = createAdjacency(nodeCount, arcSource, arcTarget, arcEdge, m_edgeWeight, 0, arcCount);
+        m_in[typeCount] = createAdjacency(nodeCount, arcTarget, arcSource, arcEdge, m_edgeWeight, 0, arcCount);
+    }
+}
+
+bool GraphSnapshot::isValid() const
+{
+    const GraphDocumentPtr document = m_document.toStrongRef();
+    return document && document->revision() == m_revision;
+}
+
+GraphDocumentPtr GraphSnapshot::document() const
+{
+    return m_document.toStrongRef();
+}
+
+QString GraphSnapshot::weightProperty() const
+{
+    return m_weightProperty;
+}
+
+quint64 GraphSnapshot::revision() const
+{
+    return m_revision;
+}
+
+int GraphSnapshot::nodeCount() const
+{
+    return m_nodeCount;
+}
+
+int GraphSnapshot::edgeCount() const
+{
+    return m_edgeCount;
+}
+
+int GraphSnapshot::edgeTypeCount() const
+{
+    return m_edgeTypes.length();
+}
+
+NodePtr GraphSnapshot::node(int index) const
+{
+    const GraphDocumentPtr document = m_document.toStrongRef();
+    if (!document) {
+        return NodePtr();
+    }
+    return document->nodeHandle(index).node();
+}
+
+EdgePtr GraphSnapshot::edge(int index) const
+{
+    const GraphDocumentPtr document = m_document.toStrongRef();
+    if (!document) {
+        return EdgePtr();
+    }
+    return document->edgeHandle(index).edge();
+}
+
+int GraphSnapshot::edgeTypeIndex(EdgeTypePtr type) const
+{
+    return m_edgeTypes.indexOf(type.data());
+}
+
+const QVector<int> & GraphSnapshot::edgeFrom() const
+{
+    return m_edgeFrom;
+}
+
+const QVector<int> & GraphSnapshot::edgeTo() const
+{
+    return m_edgeTo;
+}
+
+const QVector<int> & GraphSnapshot::edgeTypes() const
+{
+    return m_edgeType;
+}
+
+const QVector<qreal> & GraphSnapshot::edgeWeights() const
+{
+    return m_edgeWeight;
+}
+
+const GraphSnapshot::Adjacency & GraphSnapshot::outAdjacency(int type) const
+{
+    Q_ASSERT(type < m_out.length() - 1);
+    return m_out.at(type < 0 ? m_out.length() - 1 : type);
+}
+
+const GraphSnapshot::Adjacency & GraphSnapshot::inAdjacency(int type) const
+{
+    Q_ASSERT(type < m_in.length() - 1);
+    return m_in.at(type < 0 ? m_in.length() - 1 : type);
+}
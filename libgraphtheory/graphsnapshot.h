@@ -0,0 +1,177 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GRAPHSNAPSHOT_H
+#define GRAPHSNAPSHOT_H
+
+#include "graphtheory_export.h"
+#include "typenames.h"
+
+#include <QString>
+#include <QVector>
+#include <QWeakPointer>
+
+namespace GraphTheory
+{
+
+/**
+ * \class GraphSnapshot
+ * Read-only compact representation of the structure of a GraphDocument.
+ *
+ * Nodes and edges are addressed by contiguous integer indices, which are the positions in
+ * GraphDocument::nodes() and GraphDocument::edges() at the time the snapshot was created. For
+ * every edge type, incoming and outgoing edges are stored in compressed sparse row (CSR) form:
+ * the entries of node @c v lie in the range [offsets[v], offsets[v+1]) of the arrays nodes, edges
+ * and weights. Bidirectional edges are contained as incoming and outgoing edges of both end
+ * points, exactly as returned by Node::inEdges() and Node::outEdges().
+ *
+ * The snapshot is created in one pass over the document and does not follow later changes of
+ * the document. Use isValid() to check if it still reflects the document. The snapshot does not
+ * keep the document alive, such that documents can cache snapshot based data. The document is read
+ * by NodeHandle and EdgeHandle, hence creating a snapshot of a document in
+ * GraphDocument::CompactStorage does not create any node or edge objects.
+ */
+class GRAPHTHEORY_EXPORT GraphSnapshot
+{
+public:
+    /**
+     * \struct Adjacency
+     * CSR adjacency arrays, see class documentation.
+     */
+    struct Adjacency {
+        QVector<int> offsets;   //!< size nodeCount() + 1
+        QVector<int> nodes;     //!< adjacent node for each entry
+        QVector<int> edges;     //!< edge index for each entry
+        QVector<qreal> weights; //!< weight of the edge of each entry
+    };
+
+    /**
+     * Creates an empty and invalid snapshot.
+     */
+    GraphSnapshot();
+
+    /**
+     * Creates a snapshot of @p document. If @p weightProperty is not empty, the edge weights are
+     * read from this dynamic property, otherwise all weights are 1.
+     *
+     * @param document  the document to be represented
+     * @param weightProperty  name of the dynamic edge property that contains edge weights
+     */
+    explicit GraphSnapshot(GraphDocumentPtr document, const QString &weightProperty = QString());
+
+    /**
+     * @return @c true if the document was not changed since the snapshot was created
+     */
+    bool isValid() const;
+
+    /**
+     * @return the represented document, null if the document was deleted meanwhile
+     */
+    GraphDocumentPtr document() const;
+
+    /**
+     * @return name of the dynamic property used for edge weights
+     */
+    QString weightProperty() const;
+
+    /**
+     * @return document revision at the time the snapshot was created
+     */
+    quint64 revision() const;
+
+    int nodeCount() const;
+    int edgeCount() const;
+
+    /**
+     * @return number of edge types, edge type indices are positions in GraphDocument::edgeTypes()
+     */
+    int edgeTypeCount() const;
+
+    /**
+     * Return the node with index @p index. The node is looked up at the document, hence the
+     * result is only meaningful while the snapshot is valid and null if the document was deleted.
+     *
+     * @return node with index @p index
+     */
+    NodePtr node(int index) const;
+
+    /**
+     * Return the edge with index @p index. The edge is looked up at the document, hence the
+     * result is only meaningful while the snapshot is valid and null if the document was deleted.
+     *
+     * @return edge with index @p index
+     */
+    EdgePtr edge(int index) const;
+
+    /**
+     * @return index of @p type or -1 if the type is not represented
+     */
+    int edgeTypeIndex(EdgeTypePtr type) const;
+
+    /**
+     * @return for each edge the index of its from node
+     */
+    const QVector<int> & edgeFrom() const;
+
+    /**
+     * @return for each edge the index of its to node
+     */
+    const QVector<int> & edgeTo() const;
+
+    /**
+     * @return for each edge the index of its edge type, -1 if the type is not registered at the
+     *         document; such edges are not contained in any adjacency
+     */
+    const QVector<int> & edgeTypes() const;
+
+    /**
+     * @return for each edge its weight
+     */
+    const QVector<qreal> & edgeWeights() const;
+
+    /**
+     * @return outgoing adjacency of all edges of type with index @p type, if @p type is -1
+     *         edges of all types are considered
+     */
+    const Adjacency & outAdjacency(int type = -1) const;
+
+    /**
+     * @return incoming adjacency of all edges of type with index @p type, if @p type is -1
+     *         edges of all types are considered
+     */
+    const Adjacency & inAdjacency(int type = -1) const;
+
+private:
+    QWeakPointer<GraphDocument> m_document;
+    QString m_weightProperty;
+    quint64 m_revision;
+    int m_nodeCount;
+    int m_edgeCount;
+    QVector<const EdgeType*> m_edgeTypes; // only for identification, types own their document
+    QVector<int> m_edgeFrom;
+    QVector<int> m_edgeTo;
+    QVector<int> m_edgeType;
+    QVector<qreal> m_edgeWeight;
+    QVector<Adjacency> m_out; // one entry per edge type and a last one for all types
+    QVector<Adjacency> m_in;
+};
+}
+
+#endif
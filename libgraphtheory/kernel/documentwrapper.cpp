@@ -24,6 +24,8 @@
 #include "graphdocument.h"
 #include "nodetype.h"
 #include "edge.h"
+#include "modifiers/topology.h"
+#include "modifiers/incrementallayout.h"
 #include <KLocalizedString>
 #include <QDebug>
 
@@ -32,6 +34,9 @@ using namespace GraphTheory;
 DocumentWrapper::DocumentWrapper(GraphDocumentPtr document, QScriptEngine *engine)
     : m_document(document)
     , m_engine(engine)
+    , m_batchOpen(false)
+    , m_batchTimer(new QTimer(this))
+    , m_incrementalLayout(new IncrementalLayout(document, this))
 {
     foreach (NodePtr node, document->nodes()) {
         registerWrapper(node);
@@ -42,10 +47,21 @@ DocumentWrapper::DocumentWrapper(GraphDocumentPtr document, QScriptEngine *engin
 
     connect(document.data(), &GraphDocument::nodeAboutToBeAdded, this, static_cast<void (DocumentWrapper::*)(NodePtr)>(&DocumentWrapper::registerWrapper));
     connect(document.data(), &GraphDocument::edgeAboutToBeAdded, this, static_cast<void (DocumentWrapper::*)(EdgePtr)>(&DocumentWrapper::registerWrapper));
+    connect(document.data(), &GraphDocument::nodesAboutToBeAdded, this, &DocumentWrapper::registerNodeWrappers);
+    connect(document.data(), &GraphDocument::edgesAboutToBeAdded, this, &DocumentWrapper::registerEdgeWrappers);
+
+    m_batchTimer->setSingleShot(true);
+    m_batchTimer->setInterval(0);
+    connect(m_batchTimer, &QTimer::timeout, this, &DocumentWrapper::closeBatch);
 }
 
 DocumentWrapper::~DocumentWrapper()
 {
+    // publish the elements created by the script since the last turn of the event loop
+    if (m_batchOpen) {
+        m_document->disconnect(this);
+        m_document->endBatch();
+    }
     qDeleteAll(m_edgeMap);
     qDeleteAll(m_nodeMap);
 }
@@ -77,6 +93,22 @@ void DocumentWrapper::registerWrapper(EdgePtr edge)
     return;
 }
 
+void DocumentWrapper::registerNodeWrappers(int first, int last)
+{
+    const NodeList nodes = m_document->nodes();
+    for (int i = first; i <= last; ++i) {
+        registerWrapper(nodes.at(i));
+    }
+}
+
+void DocumentWrapper::registerEdgeWrappers(int first, int last)
+{
+    const EdgeList edges = m_document->edges();
+    for (int i = first; i <= last; ++i) {
+        registerWrapper(edges.at(i));
+    }
+}
+
 NodeWrapper * DocumentWrapper::nodeWrapper(NodePtr node) const
 {
     Q_ASSERT(m_nodeMap.contains(node));
@@ -91,14 +123,11 @@ EdgeWrapper * DocumentWrapper::edgeWrapper(EdgePtr edge) const
 
 QScriptValue DocumentWrapper::node(int id) const
 {
-    //TODO average access time is linear, which might drastically be improved by
-    //     using proper caching mechanisms at Document objects
-    for (auto const &node : m_document->nodes()) {
-        if (node->id() == id) {
-            return m_engine->newQObject(nodeWrapper(node),
-                                        QScriptEngine::QtOwnership,
-                                        QScriptEngine::AutoCreateDynamicProperties);
-        }
+    const NodePtr node = m_document->node(id);
+    if (node) {
+        return m_engine->newQObject(nodeWrapper(node),
+                                    QScriptEngine::QtOwnership,
+                                    QScriptEngine::AutoCreateDynamicProperties);
     }
     QString command = QString("Document.node(%1)").arg(id);
     emit message(i18nc("@info:shell", "%1: no node with ID %2 registered", command, id), Kernel::ErrorMessage);
@@ -181,11 +210,96 @@ QScriptValue DocumentWrapper::edges(int type) const
     return array;
 }
 
+void DocumentWrapper::layout(const QString &method)
+{
+    Topology topology;
+    const NodeList nodes = m_document->nodes();
+    if (method == QLatin1String("forcedirected")) {
+        topology.applyMinCutTreeAlignment(nodes);
+    } else if (method == QLatin1String("multilevel")) {
+        topology.applyMultilevelAlignment(nodes);
+    } else if (method == QLatin1String("layered")) {
+        topology.applyLayeredAlignment(nodes);
+    } else if (method == QLatin1String("circle")) {
+        topology.applyCircleAlignment(nodes);
+    } else if (method == QLatin1String("incremental")) {
+        m_incrementalLayout->apply();
+    } else {
+        QString command = QString("Document.layout(%1)").arg(method);
+        emit message(i18nc("@info:shell", "%1: unknown layout method \"%2\"", command, method), Kernel::ErrorMessage);
+    }
+}
+
+QScriptValue DocumentWrapper::distanceMatrix(const QString &lengthProperty)
+{
+    const QString command = QString("Document.distanceMatrix(%1)").arg(lengthProperty);
+    return distanceMatrix(m_document->distanceMatrix(lengthProperty), command);
+}
+
+QScriptValue DocumentWrapper::distanceMatrix(const QString &lengthProperty, int type)
+{
+    EdgeTypePtr typePtr;
+    foreach (EdgeTypePtr typeTest, m_document->edgeTypes()) {
+        if (typeTest->id() == type) {
+            typePtr = typeTest;
+            break;
+        }
+    }
+    const QString command = QString("Document.distanceMatrix(%1, %2)").arg(lengthProperty).arg(type);
+    if (!typePtr) {
+        emit message(i18nc("@info:shell", "%1: edge type ID %2 not registered", command, type), Kernel::ErrorMessage);
+        return m_engine->newArray();
+    }
+    return distanceMatrix(m_document->distanceMatrix(lengthProperty, typePtr), command);
+}
+
+QScriptValue DocumentWrapper::distanceMatrix(const DistanceMatrix &matrix, const QString &command) const
+{
+    if (matrix.isNull()) {
+        emit message(i18nc("@info:shell", "%1: distance matrices are limited to %2 nodes", command, m_document->distanceMatrixLimit()), Kernel::ErrorMessage);
+        return m_engine->newArray();
+    }
+    QScriptValue array = m_engine->newArray(matrix.size());
+    for (int i = 0; i < matrix.size(); ++i) {
+        const qreal *distances = matrix.row(i);
+        QScriptValue row = m_engine->newArray(matrix.size());
+        for (int j = 0; j < matrix.size(); ++j) {
+            row.setProperty(j, distances[j]);
+        }
+        array.setProperty(i, row);
+    }
+    return array;
+}
+
+void DocumentWrapper::openBatch()
+{
+    if (m_batchOpen) {
+        return;
+    }
+    m_document->beginBatch();
+    m_batchOpen = true;
+    m_batchTimer->start();
+}
+
+void DocumentWrapper::closeBatch()
+{
+    if (!m_batchOpen) {
+        return;
+    }
+    m_batchOpen = false;
+    m_document->endBatch();
+}
+
 QScriptValue DocumentWrapper::createNode(int x, int y)
 {
+    // element creations of scripts are published together at the next turn of the event loop,
+    // which a running script takes every 100 ms
+    openBatch();
     NodePtr node = Node::create(m_document);
-    node->setX(x);
-    node->setY(y);
+    registerWrapper(node);
+    node->setPosition(QPointF(x, y));
+    // insertions are only announced at the end of the batch
+    m_incrementalLayout->addNode(node);
     return m_engine->newQObject(nodeWrapper(node),
                                 QScriptEngine::QtOwnership,
                                 QScriptEngine::AutoCreateDynamicProperties);
@@ -203,7 +317,10 @@ QScriptValue DocumentWrapper::createEdge(NodeWrapper *from, NodeWrapper *to)
         emit message(i18nc("@info:shell", "%1: \"to\" is not a valid node object", command), Kernel::ErrorMessage);
         return QScriptValue();
     }
+    openBatch();
     EdgePtr edge = Edge::create(from->node(), to->node());
+    registerWrapper(edge);
+    m_incrementalLayout->addEdge(edge);
     return m_engine->newQObject(edgeWrapper(edge),
                                 QScriptEngine::QtOwnership,
                                 QScriptEngine::AutoCreateDynamicProperties);
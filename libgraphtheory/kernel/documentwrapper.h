@@ -27,16 +27,19 @@
 #include "node.h"
 #include "edge.h"
 #include "graphdocument.h"
+#include "algorithms/distancematrix.h"
 
 #include <QScriptEngine>
 #include <QObject>
 #include <QColor>
+#include <QTimer>
 
 namespace GraphTheory
 {
 class DocumentWrapperPrivate;
 class NodeWrapper;
 class EdgeWrapper;
+class IncrementalLayout;
 
 /**
  * \class DocumentWrapper
@@ -72,19 +75,55 @@ public:
     Q_INVOKABLE void remove(GraphTheory::NodeWrapper *node);
     Q_INVOKABLE void remove(GraphTheory::EdgeWrapper *edge);
 
+    /**
+     * Arrange all nodes by the layout named \p method, which is one of "forcedirected",
+     * "multilevel", "layered" or "circle". The method "incremental" only moves the nodes
+     * and edges created or removed by the script since the last incremental layout.
+     */
+    Q_INVOKABLE void layout(const QString &method);
+
+    /**
+     * The matrix is cached by the document; as long as the document is not changed, it also
+     * answers Node.distance() queries. For documents with more than
+     * GraphDocument::distanceMatrixLimit() nodes, an error is reported and an empty array returned.
+     *
+     * \return array of arrays with the distances between all nodes, indexed like nodes(), where
+     *         the dynamic edge property \p lengthProperty is used as edge length
+     */
+    Q_INVOKABLE QScriptValue distanceMatrix(const QString &lengthProperty);
+
+    /**
+     * \return array of arrays with the distances between all nodes, indexed like nodes(), where
+     *         only edges of type with ID \p type are considered
+     */
+    Q_INVOKABLE QScriptValue distanceMatrix(const QString &lengthProperty, int type);
+
 Q_SIGNALS:
     void message(const QString &messageString, Kernel::MessageType type) const;
 
 private Q_SLOTS:
     void registerWrapper(NodePtr node);
     void registerWrapper(EdgePtr edge);
+    void registerNodeWrappers(int first, int last);
+    void registerEdgeWrappers(int first, int last);
+    void closeBatch();
 
 private:
+    /**
+     * Open a batch of the document for element creations, which is closed at the next
+     * turn of the event loop, i.e. at latest when the engine processes events.
+     */
+    void openBatch();
+
+    QScriptValue distanceMatrix(const DistanceMatrix &matrix, const QString &command) const;
     Q_DISABLE_COPY(DocumentWrapper)
     const GraphDocumentPtr m_document;
     QScriptEngine *m_engine;
     QMap<NodePtr, NodeWrapper*> m_nodeMap;
     QMap<EdgePtr, EdgeWrapper*> m_edgeMap;
+    bool m_batchOpen; // true if node/edge creations are batched at the document
+    QTimer *m_batchTimer;
+    IncrementalLayout *m_incrementalLayout;
 };
 }
 
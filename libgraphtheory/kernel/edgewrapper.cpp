@@ -104,8 +104,9 @@ bool EdgeWrapper::event(QEvent *e)
         QString name = QString::fromUtf8(propertyEvent->propertyName());
         QVariant value = property(propertyEvent->propertyName());
         // only propagate property to edge object if it is registered
-        if (m_edge->dynamicProperties().contains(name)) {
-            m_edge->setDynamicProperty(name, value);
+        const PropertyKey key = m_edge->type()->dynamicPropertyKey(name);
+        if (key.isValid()) {
+            m_edge->setDynamicProperty(key, value);
         }
         return true;
     }
@@ -117,8 +118,9 @@ void EdgeWrapper::updateDynamicProperties()
     foreach (const QString &property, m_edge->dynamicProperties()) {
         // property value must not be set to QVariant::Invalid, else the properties are not accessible
         // from the script engine
-        if (m_edge->dynamicProperty(property).isValid()) {
-            setProperty(property.toUtf8(), m_edge->dynamicProperty(property));
+        const QVariant value = m_edge->dynamicProperty(m_edge->type()->dynamicPropertyKey(property));
+        if (value.isValid()) {
+            setProperty(property.toUtf8(), value);
         } else {
             setProperty(property.toUtf8(), QVariant::Int);
         }
@@ -21,6 +21,8 @@
 #include "nodewrapper.h"
 #include "edgewrapper.h"
 #include "graphdocument.h"
+#include "graphsnapshot.h"
+#include "algorithms/shortestpaths.h"
 #include "nodetype.h"
 #include "edge.h"
 #include "typenames.h"
@@ -29,6 +31,7 @@
 #include <QColor>
 #include <QDebug>
 #include <QEvent>
+#include <algorithm>
 
 using namespace GraphTheory;
 
@@ -356,71 +359,34 @@ QList<NodeWrapper*> NodeWrapper::successors(int type) const
 
 QScriptValue NodeWrapper::distance(const QString &lengthProperty, QList< NodeWrapper* > targets)
 {
-    //TODO at a later point in time:
-    //     factor this algorithm out into a self-containted graph algorithm class
-
-    // Implementation of Floyd-Warshall Algorithm:
-    // asymptotic runtime: O(n^3), n = number of nodes
-    //
-    // 1 let D be a |V| × |V| matrix of minimum distances initialized to ∞ (infinity)
-    // 2 foreach(vertex v)
-    // 3    D[v][v] ← 0
-    // 4 foreach (edge (u,v))
-    // 5    D[u][v] := w(u,v)  // the weight of the edge (u,v)
-    // 6 for (k from 1 to |V|)
-    // 7    for (i from 1 to |V|)
-    // 8       for (j from 1 to |V|)
-    // 9          if (D[i][j] > D[i][k] + D[k][j])
-    // 10             D[i][j] := D[i][k] + D[k][j]
-    // 11         end if
-
-    const NodeList nodes = m_node->document()->nodes();
-    const EdgeList edges = m_node->document()->edges();
-    const int n = nodes.length();
-
-    // create fast access mapping of node IDs to positions
-    QMap<int, int> map;
-    for (int i = 0; i < n; ++i) {
-        map.insert(nodes.at(i)->id(), i);
-    }
-
-    // initialize distance matrix D
-    QVector< QVector<qreal> > D(n, QVector<qreal>(n));
-    for (int i = 0; i < n; ++i) {
-    for (int j = 0; j < n; ++j) {
-        if (i == j) {
-            D[i][j] = 0;
-        }
-        else {
-            D[i][j] = std::numeric_limits<qreal>::max();
-        }
-    }
-    }
-
-    // set edges lengths to D
-    for (const auto &edge : edges) {
-        D[map[edge->from()->id()]][map[edge->to()->id()]] = edge->dynamicProperty(lengthProperty).toDouble();
-        if (edge->type()->direction() == EdgeType::Bidirectional) {
-            D[map[edge->to()->id()]][map[edge->from()->id()]] = edge->dynamicProperty(lengthProperty).toDouble();
-        }
-    }
-
-    // computation
-    for (int k = 0; k < n; ++k) {
-    for (int i = 0; i < n; ++i) {
-    for (int j = 0; j < n; ++j) {
-        if (D[i][j] > D[i][k] + D[k][j]) {
-            D[i][j] = D[i][k] + D[k][j];
-        }
-    }
-    }
+    QVector<int> targetIndices;
+    targetIndices.reserve(targets.length());
+    for (const NodeWrapper *target : targets) {
+        targetIndices.append(target->node()->documentIndex());
+    }
+    const int source = m_node->documentIndex();
+
+    // a distance matrix the script requested by Document.distanceMatrix() answers the query as
+    // long as it is up to date, otherwise only the distances from this node are computed
+    QVector<qreal> distances;
+    const GraphDocumentPtr document = m_node->document();
+    const DistanceMatrix matrix = document->hasDistanceMatrix(lengthProperty)
+        ? document->distanceMatrix(lengthProperty) : DistanceMatrix();
+    if (!matrix.isNull() && source >= 0) {
+        const qreal *row = matrix.row(source);
+        distances = QVector<qreal>(matrix.size());
+        std::copy(row, row + matrix.size(), distances.begin());
+    } else {
+        const GraphSnapshot snapshot(document, lengthProperty);
+        const ShortestPaths shortestPaths(snapshot);
+        distances = shortestPaths.distances(source, targetIndices);
     }
 
     // compute return statement
     QScriptValue array = m_documentWrapper->engine()->newArray(targets.length());
-    const int from = map[m_node->id()];
-    for (int i = 0; i < targets.length(); ++i) {
-        const qreal distance = D[from][map[targets.at(i)->id()]];
+    for (int i = 0; i < targetIndices.length(); ++i) {
+        const int index = targetIndices.at(i);
+        const qreal distance = index >= 0 ? distances.at(index) : ShortestPaths::infinity();
         array.setProperty(i, distance);
     }
     return array;
@@ -433,8 +399,9 @@ bool NodeWrapper::event(QEvent *e)
         QString name = QString::fromUtf8(propertyEvent->propertyName());
         QVariant value = property(propertyEvent->propertyName());
         // only propagate property to node object if it is registered
-        if (m_node->dynamicProperties().contains(name)) {
-            m_node->setDynamicProperty(name, value);
+        const PropertyKey key = m_node->type()->dynamicPropertyKey(name);
+        if (key.isValid()) {
+            m_node->setDynamicProperty(key, value);
         }
         return true;
     }
@@ -446,8 +413,9 @@ void NodeWrapper::updateDynamicProperties()
     for (const auto &property : m_node->dynamicProperties()) {
         // property value must not be set to QVariant::Invalid, else the properties are not accessible
         // from the script engine
-        if (m_node->dynamicProperty(property).isValid()) {
-            setProperty(property.toUtf8(), m_node->dynamicProperty(property));
+        const QVariant value = m_node->dynamicProperty(m_node->type()->dynamicPropertyKey(property));
+        if (value.isValid()) {
+            setProperty(property.toUtf8(), value);
         } else {
             setProperty(property.toUtf8(), QVariant::Int);
         }
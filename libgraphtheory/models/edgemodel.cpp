@@ -32,6 +32,10 @@ class GraphTheory::EdgeModelPrivate {
 public:
     EdgeModelPrivate()
         : m_signalMapper(new QSignalMapper)
+        , m_rowCount(0)
+        , m_firstChangedRow(-1)
+        , m_lastChangedRow(-1)
+        , m_movedRow(-1)
     {
     }
 
@@ -40,16 +44,20 @@ public:
         m_signalMapper->deleteLater();
     }
 
-    void updateMappings()
+    void updateMappings(int first, int last)
     {
-        int edges = m_document->edges().count();
-        for (int i = 0; i < edges; i++) {
-            m_signalMapper->setMapping(m_document->edges().at(i).data(), i);
+        const EdgeList edges = m_document->edges();
+        for (int i = first; i <= last; ++i) {
+            m_signalMapper->setMapping(edges.at(i).data(), i);
         }
     }
 
     GraphDocumentPtr m_document;
     QSignalMapper *m_signalMapper;
+    int m_rowCount; // rows announced to views, may lag behind the document during batches
+    int m_firstChangedRow;
+    int m_lastChangedRow;
+    int m_movedRow;
 };
 
 EdgeModel::EdgeModel(QObject *parent)
@@ -85,19 +93,33 @@ void EdgeModel::setDocument(GraphDocumentPtr document)
         d->m_document.data()->disconnect(this);
     }
     d->m_document = document;
+    d->m_rowCount = d->m_document ? d->m_document->edges().count() : 0;
     if (d->m_document) {
         connect(d->m_document.data(), &GraphDocument::edgeAboutToBeAdded,
             this, &EdgeModel::onEdgeAboutToBeAdded);
         connect(d->m_document.data(), &GraphDocument::edgeAdded,
-            this, &EdgeModel::onEdgeAdded);
+            this, &EdgeModel::onEdgesAdded);
+        connect(d->m_document.data(), &GraphDocument::edgesAboutToBeAdded,
+            this, &EdgeModel::onEdgesAboutToBeAdded);
+        connect(d->m_document.data(), &GraphDocument::edgesAdded,
+            this, &EdgeModel::onEdgesAdded);
         connect(d->m_document.data(), &GraphDocument::edgesAboutToBeRemoved,
             this, &EdgeModel::onEdgesAboutToBeRemoved);
         connect(d->m_document.data(), &GraphDocument::edgesRemoved,
             this, &EdgeModel::onEdgesRemoved);
+        connect(d->m_document.data(), &GraphDocument::edgeAboutToBeMoved,
+            this, &EdgeModel::onEdgeAboutToBeMoved);
+        connect(d->m_document.data(), &GraphDocument::edgeMoved,
+            this, &EdgeModel::onEdgeMoved);
     }
     endResetModel();
 }
 
+GraphDocumentPtr EdgeModel::document() const
+{
+    return d->m_document;
+}
+
 QVariant EdgeModel::data(const QModelIndex &index, int role) const
 {
     Q_ASSERT(d->m_document);
@@ -106,7 +128,7 @@ QVariant EdgeModel::data(const QModelIndex &index, int role) const
         return QVariant();
     }
 
-    if (index.row() >= d->m_document->edges().count()) {
+    if (index.row() >= d->m_rowCount) {
         return QVariant();
     }
 
@@ -131,31 +153,54 @@ int EdgeModel::rowCount(const QModelIndex &parent) const
         return 0;
     }
 
-    return d->m_document->edges().count();
+    return d->m_rowCount;
 }
 
 void EdgeModel::onEdgeAboutToBeAdded(EdgePtr edge, int index)
 {
-    //TODO add missing signals
-    beginInsertRows(QModelIndex(), index, index);
+    Q_UNUSED(edge);
+    onEdgesAboutToBeAdded(index, index);
+}
+
+void EdgeModel::onEdgesAboutToBeAdded(int first, int last)
+{
+    d->m_firstChangedRow = first;
+    d->m_lastChangedRow = last;
+    beginInsertRows(QModelIndex(), first, last);
 }
 
-void EdgeModel::onEdgeAdded()
+void EdgeModel::onEdgesAdded()
 {
-    d->updateMappings();
+    d->m_rowCount += d->m_lastChangedRow - d->m_firstChangedRow + 1;
+    d->updateMappings(d->m_firstChangedRow, d->m_lastChangedRow);
     endInsertRows();
 }
 
 void EdgeModel::onEdgesAboutToBeRemoved(int first, int last)
 {
+    d->m_firstChangedRow = first;
+    d->m_lastChangedRow = last;
     beginRemoveRows(QModelIndex(), first, last);
 }
 
 void EdgeModel::onEdgesRemoved()
 {
+    d->m_rowCount -= d->m_lastChangedRow - d->m_firstChangedRow + 1;
     endRemoveRows();
 }
 
+void EdgeModel::onEdgeAboutToBeMoved(int from, int to)
+{
+    d->m_movedRow = to;
+    beginMoveRows(QModelIndex(), from, from, QModelIndex(), to);
+}
+
+void EdgeModel::onEdgeMoved()
+{
+    d->m_signalMapper->setMapping(d->m_document->edges().at(d->m_movedRow).data(), d->m_movedRow);
+    endMoveRows();
+}
+
 void EdgeModel::emitEdgeChanged(int row)
 {
     emit edgeChanged(row);
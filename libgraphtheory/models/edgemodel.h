@@ -50,6 +50,7 @@ public:
      */
     virtual QHash<int,QByteArray> roleNames() const Q_DECL_OVERRIDE;
     void setDocument(GraphDocumentPtr document);
+    GraphDocumentPtr document() const;
     virtual QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const  Q_DECL_OVERRIDE;
     virtual int rowCount(const QModelIndex &parent = QModelIndex()) const Q_DECL_OVERRIDE;
     virtual QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const Q_DECL_OVERRIDE;
@@ -59,9 +60,12 @@ Q_SIGNALS:
 
 private Q_SLOTS:
     void onEdgeAboutToBeAdded(EdgePtr node, int index);
-    void onEdgeAdded();
+    void onEdgesAboutToBeAdded(int first, int last);
+    void onEdgesAdded();
     void onEdgesAboutToBeRemoved(int first, int last);
     void onEdgesRemoved();
+    void onEdgeAboutToBeMoved(int from, int to);
+    void onEdgeMoved();
     void emitEdgeChanged(int row);
 
 private:
@@ -20,6 +20,7 @@
 
 #include "edgepropertymodel.h"
 #include "edge.h"
+#include "edgetype.h"
 #include "edgetypestyle.h"
 #include <KLocalizedString>
 #include <QDebug>
@@ -38,7 +39,7 @@ public:
     }
 
     EdgePtr m_edge;
-
+    QMetaObject::Connection m_typeConnection;
 };
 
 EdgePropertyModel::EdgePropertyModel(QObject *parent)
@@ -73,6 +74,7 @@ void EdgePropertyModel::setEdge(Edge *edge)
     if (d->m_edge) {
         d->m_edge.data()->disconnect(this);
     }
+    disconnect(d->m_typeConnection);
     d->m_edge = edge->self();
     if (d->m_edge) {
         connect(d->m_edge.data(), &Edge::dynamicPropertyAboutToBeAdded,
@@ -85,6 +87,14 @@ void EdgePropertyModel::setEdge(Edge *edge)
             this, &EdgePropertyModel::onDynamicPropertyRemoved);
         connect(d->m_edge.data(), &Edge::dynamicPropertyChanged,
             this, &EdgePropertyModel::onDynamicPropertyChanged);
+        // values changed by bulk operations are announced at the type
+        auto connectType = [=] () {
+            disconnect(d->m_typeConnection);
+            d->m_typeConnection = connect(d->m_edge->type().data(), &EdgeType::dynamicPropertyValuesChanged,
+                this, &EdgePropertyModel::onDynamicPropertyChanged);
+        };
+        connectType();
+        connect(d->m_edge.data(), &Edge::typeChanged, this, connectType);
         connect(d->m_edge.data(), &Edge::styleChanged,[=]() {
             QVector<int> changedRoles;
             changedRoles.append(VisibilityRole);
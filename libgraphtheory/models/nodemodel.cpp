@@ -30,6 +30,10 @@ class GraphTheory::NodeModelPrivate {
 public:
     NodeModelPrivate()
         : m_signalMapper(new QSignalMapper)
+        , m_rowCount(0)
+        , m_firstChangedRow(-1)
+        , m_lastChangedRow(-1)
+        , m_movedRow(-1)
     {
     }
 
@@ -38,16 +42,20 @@ public:
         m_signalMapper->deleteLater();
     }
 
-    void updateMappings()
+    void updateMappings(int first, int last)
     {
-        int nodes = m_document->nodes().count();
-        for (int i = 0; i < nodes; i++) {
-            m_signalMapper->setMapping(m_document->nodes().at(i).data(), i);
+        const NodeList nodes = m_document->nodes();
+        for (int i = first; i <= last; ++i) {
+            m_signalMapper->setMapping(nodes.at(i).data(), i);
         }
     }
 
     GraphDocumentPtr m_document;
     QSignalMapper *m_signalMapper;
+    int m_rowCount; // rows announced to views, may lag behind the document during batches
+    int m_firstChangedRow;
+    int m_lastChangedRow;
+    int m_movedRow;
 };
 
 NodeModel::NodeModel(QObject *parent)
@@ -82,15 +90,26 @@ void NodeModel::setDocument(GraphDocumentPtr document)
         d->m_document.data()->disconnect(this);
     }
     d->m_document = document;
+    d->m_rowCount = d->m_document ? d->m_document->nodes().count() : 0;
     if (d->m_document) {
         connect(d->m_document.data(), &GraphDocument::nodeAboutToBeAdded, this, &NodeModel::onNodeAboutToBeAdded);
-        connect(d->m_document.data(), &GraphDocument::nodeAdded, this, &NodeModel::onNodeAdded);
+        connect(d->m_document.data(), &GraphDocument::nodeAdded, this, &NodeModel::onNodesAdded);
+        connect(d->m_document.data(), &GraphDocument::nodesAboutToBeAdded, this, &NodeModel::onNodesAboutToBeAdded);
+        connect(d->m_document.data(), &GraphDocument::nodesAdded, this, &NodeModel::onNodesAdded);
         connect(d->m_document.data(), &GraphDocument::nodesAboutToBeRemoved, this, &NodeModel::onNodesAboutToBeRemoved);
         connect(d->m_document.data(), &GraphDocument::nodesRemoved, this, &NodeModel::onNodesRemoved);
+        connect(d->m_document.data(), &GraphDocument::nodeAboutToBeMoved, this, &NodeModel::onNodeAboutToBeMoved);
+        connect(d->m_document.data(), &GraphDocument::nodeMoved, this, &NodeModel::onNodeMoved);
+        connect(d->m_document.data(), &GraphDocument::nodePositionsChanged, this, &NodeModel::onNodePositionsChanged);
     }
     endResetModel();
 }
 
+GraphDocumentPtr NodeModel::document() const
+{
+    return d->m_document;
+}
+
 QVariant NodeModel::data(const QModelIndex &index, int role) const
 {
     Q_ASSERT(d->m_document);
@@ -99,7 +118,7 @@ QVariant NodeModel::data(const QModelIndex &index, int role) const
         return QVariant();
     }
 
-    if (index.row() >= d->m_document->nodes().count()) {
+    if (index.row() >= d->m_rowCount) {
         return QVariant();
     }
 
@@ -126,31 +145,73 @@ int NodeModel::rowCount(const QModelIndex &parent) const
         return 0;
     }
 
-    return d->m_document->nodes().count();
+    return d->m_rowCount;
 }
 
 void NodeModel::onNodeAboutToBeAdded(NodePtr node, int index)
 {
-    //TODO add missing signals
-    beginInsertRows(QModelIndex(), index, index);
+    Q_UNUSED(node);
+    onNodesAboutToBeAdded(index, index);
+}
+
+void NodeModel::onNodesAboutToBeAdded(int first, int last)
+{
+    d->m_firstChangedRow = first;
+    d->m_lastChangedRow = last;
+    beginInsertRows(QModelIndex(), first, last);
 }
 
-void NodeModel::onNodeAdded()
+void NodeModel::onNodesAdded()
 {
-    d->updateMappings();
+    d->m_rowCount += d->m_lastChangedRow - d->m_firstChangedRow + 1;
+    d->updateMappings(d->m_firstChangedRow, d->m_lastChangedRow);
     endInsertRows();
 }
 
 void NodeModel::onNodesAboutToBeRemoved(int first, int last)
 {
+    d->m_firstChangedRow = first;
+    d->m_lastChangedRow = last;
     beginRemoveRows(QModelIndex(), first, last);
 }
 
 void NodeModel::onNodesRemoved()
 {
+    d->m_rowCount -= d->m_lastChangedRow - d->m_firstChangedRow + 1;
     endRemoveRows();
 }
 
+void NodeModel::onNodeAboutToBeMoved(int from, int to)
+{
+    d->m_movedRow = to;
+    beginMoveRows(QModelIndex(), from, from, QModelIndex(), to);
+}
+
+void NodeModel::onNodeMoved()
+{
+    d->m_signalMapper->setMapping(d->m_document->nodes().at(d->m_movedRow).data(), d->m_movedRow);
+    endMoveRows();
+}
+
+void NodeModel::onNodePositionsChanged(const NodeList &nodes)
+{
+    // one notification for the row range of all moved nodes
+    int first = d->m_rowCount;
+    int last = -1;
+    foreach (const NodePtr &node, nodes) {
+        const int row = node->documentIndex();
+        if (row < 0 || row >= d->m_rowCount) {
+            continue;
+        }
+        first = qMin(first, row);
+        last = qMax(last, row);
+    }
+    if (last == -1) {
+        return;
+    }
+    emit dataChanged(index(first, 0), index(last, 0), QVector<int>() << DataRole);
+}
+
 void NodeModel::emitNodeChanged(int row)
 {
     emit nodeChanged(row);
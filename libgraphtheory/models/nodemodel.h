@@ -51,6 +51,7 @@ public:
      */
     virtual QHash<int,QByteArray> roleNames() const Q_DECL_OVERRIDE;
     void setDocument(GraphDocumentPtr document);
+    GraphDocumentPtr document() const;
     virtual QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const Q_DECL_OVERRIDE;
     virtual int rowCount(const QModelIndex &parent = QModelIndex()) const Q_DECL_OVERRIDE;
     virtual QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const Q_DECL_OVERRIDE;
@@ -60,9 +61,13 @@ Q_SIGNALS:
 
 private Q_SLOTS:
     void onNodeAboutToBeAdded(NodePtr node, int index);
-    void onNodeAdded();
+    void onNodesAboutToBeAdded(int first, int last);
+    void onNodesAdded();
     void onNodesAboutToBeRemoved(int first, int last);
     void onNodesRemoved();
+    void onNodeAboutToBeMoved(int from, int to);
+    void onNodeMoved();
+    void onNodePositionsChanged(const GraphTheory::NodeList &nodes);
     void emitNodeChanged(int row);
 
 private:
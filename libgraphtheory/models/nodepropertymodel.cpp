@@ -20,6 +20,7 @@
 
 #include "nodepropertymodel.h"
 #include "node.h"
+#include "nodetype.h"
 #include "nodetypestyle.h"
 #include <KLocalizedString>
 #include <QDebug>
@@ -38,7 +39,7 @@ public:
     }
 
     NodePtr m_node;
-
+    QMetaObject::Connection m_typeConnection;
 };
 
 NodePropertyModel::NodePropertyModel(QObject *parent)
@@ -73,6 +74,7 @@ void NodePropertyModel::setNode(Node* node)
     if (d->m_node) {
         d->m_node.data()->disconnect(this);
     }
+    disconnect(d->m_typeConnection);
     d->m_node = node->self();
     if (d->m_node) {
         connect(d->m_node.data(), &Node::dynamicPropertyAboutToBeAdded,
@@ -85,6 +87,14 @@ void NodePropertyModel::setNode(Node* node)
             this, &NodePropertyModel::onDynamicPropertyRemoved);
         connect(d->m_node.data(), &Node::dynamicPropertyChanged,
             this, &NodePropertyModel::onDynamicPropertyChanged);
+        // values changed by bulk operations are announced at the type
+        auto connectType = [=] () {
+            disconnect(d->m_typeConnection);
+            d->m_typeConnection = connect(d->m_node->type().data(), &NodeType::dynamicPropertyValuesChanged,
+                this, &NodePropertyModel::onDynamicPropertyChanged);
+        };
+        connectType();
+        connect(d->m_node.data(), &Node::typeChanged, this, connectType);
         connect(d->m_node.data(), &Node::styleChanged,[=]() {
             QVector<int> changedRoles;
             changedRoles.append(VisibilityRole);
@@ -0,0 +1,161 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "nodeselectionmodel.h"
+#include "graphdocument.h"
+#include "node.h"
+#include <QHash>
+
+using namespace GraphTheory;
+
+class GraphTheory::NodeSelectionModelPrivate {
+public:
+    NodeSelectionModelPrivate()
+    {
+    }
+
+    ~NodeSelectionModelPrivate()
+    {
+    }
+
+    GraphDocumentPtr m_document;
+    QHash<const Node*, NodePtr> m_selection;
+};
+
+NodeSelectionModel::NodeSelectionModel(QObject *parent)
+    : QObject(parent)
+    , d(new NodeSelectionModelPrivate)
+{
+
+}
+
+NodeSelectionModel::~NodeSelectionModel()
+{
+
+}
+
+void NodeSelectionModel::setDocument(GraphDocumentPtr document)
+{
+    if (d->m_document == document) {
+        return;
+    }
+    if (d->m_document) {
+        d->m_document.data()->disconnect(this);
+    }
+    d->m_document = document;
+    d->m_selection.clear();
+    if (d->m_document) {
+        connect(d->m_document.data(), &GraphDocument::nodesAboutToBeRemoved, this, &NodeSelectionModel::onNodesAboutToBeRemoved);
+    }
+}
+
+GraphDocumentPtr NodeSelectionModel::document() const
+{
+    return d->m_document;
+}
+
+bool NodeSelectionModel::isSelected(const Node *node) const
+{
+    return d->m_selection.contains(node);
+}
+
+int NodeSelectionModel::count() const
+{
+    return d->m_selection.count();
+}
+
+NodeList NodeSelectionModel::selectedNodes() const
+{
+    return d->m_selection.values();
+}
+
+void NodeSelectionModel::setSelected(NodePtr node, bool selected)
+{
+    if (!node || d->m_selection.contains(node.data()) == selected) {
+        return;
+    }
+    if (selected) {
+        d->m_selection.insert(node.data(), node);
+        emit selectionChanged(NodeList() << node, NodeList());
+    } else {
+        d->m_selection.remove(node.data());
+        emit selectionChanged(NodeList(), NodeList() << node);
+    }
+}
+
+void NodeSelectionModel::setSelection(const NodeList &nodes)
+{
+    // cost is linear in the sizes of the old and the new selection
+    QHash<const Node*, NodePtr> selection;
+    selection.reserve(nodes.count());
+    NodeList selected;
+    foreach (const NodePtr &node, nodes) {
+        if (selection.contains(node.data())) {
+            continue;
+        }
+        selection.insert(node.data(), node);
+        if (!d->m_selection.contains(node.data())) {
+            selected.append(node);
+        }
+    }
+    NodeList deselected;
+    QHash<const Node*, NodePtr>::const_iterator iter = d->m_selection.constBegin();
+    for (; iter != d->m_selection.constEnd(); ++iter) {
+        if (!selection.contains(iter.key())) {
+            deselected.append(iter.value());
+        }
+    }
+    d->m_selection.swap(selection);
+    if (!selected.isEmpty() || !deselected.isEmpty()) {
+        emit selectionChanged(selected, deselected);
+    }
+}
+
+void NodeSelectionModel::selectArea(const QRectF &area)
+{
+    if (!d->m_document) {
+        return;
+    }
+    setSelection(d->m_document->nodesAt(area));
+}
+
+void NodeSelectionModel::clear()
+{
+    if (d->m_selection.isEmpty()) {
+        return;
+    }
+    const NodeList deselected = d->m_selection.values();
+    d->m_selection.clear();
+    emit selectionChanged(NodeList(), deselected);
+}
+
+void NodeSelectionModel::onNodesAboutToBeRemoved(int first, int last)
+{
+    const NodeList nodes = d->m_document->nodes();
+    NodeList deselected;
+    for (int i = first; i <= last; ++i) {
+        if (d->m_selection.remove(nodes.at(i).data()) > 0) {
+            deselected.append(nodes.at(i));
+        }
+    }
+    if (!deselected.isEmpty()) {
+        emit selectionChanged(NodeList(), deselected);
+    }
+}
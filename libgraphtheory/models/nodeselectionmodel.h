@@ -0,0 +1,88 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NODESELECTIONMODEL_H
+#define NODESELECTIONMODEL_H
+
+#include "graphtheory_export.h"
+#include "typenames.h"
+
+#include <QObject>
+#include <QRectF>
+
+namespace GraphTheory
+{
+class NodeSelectionModelPrivate;
+
+/**
+ * \class NodeSelectionModel
+ * Set of selected nodes of a GraphDocument. Every change emits selectionChanged() once with
+ * the nodes that entered and left the selection, such that views only update these nodes.
+ * Nodes removed from the document are removed from the selection.
+ */
+class GRAPHTHEORY_EXPORT NodeSelectionModel : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit NodeSelectionModel(QObject *parent = 0);
+    virtual ~NodeSelectionModel();
+    /**
+     * Set the document whose nodes are selected. This clears the selection without
+     * emitting selectionChanged().
+     */
+    void setDocument(GraphDocumentPtr document);
+    GraphDocumentPtr document() const;
+    bool isSelected(const Node *node) const;
+    /**
+     * @return number of selected nodes
+     */
+    int count() const;
+    NodeList selectedNodes() const;
+    void setSelected(NodePtr node, bool selected);
+    /**
+     * Replace the selection by @p nodes.
+     */
+    void setSelection(const NodeList &nodes);
+    /**
+     * Replace the selection by all nodes whose position lies inside @p area (in global
+     * coordinates), using the spatial index of the document.
+     */
+    void selectArea(const QRectF &area);
+    void clear();
+
+Q_SIGNALS:
+    /**
+     * Emitted once per change of the selection.
+     * @param selected nodes that were added to the selection
+     * @param deselected nodes that were removed from the selection
+     */
+    void selectionChanged(const GraphTheory::NodeList &selected, const GraphTheory::NodeList &deselected);
+
+private Q_SLOTS:
+    void onNodesAboutToBeRemoved(int first, int last);
+
+private:
+    Q_DISABLE_COPY(NodeSelectionModel)
+    const QScopedPointer<NodeSelectionModelPrivate> d;
+};
+}
+
+#endif
@@ -0,0 +1,868 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "forcedirectedlayout.h"
+#include "graphdocument.h"
+#include "node.h"
+#include "edge.h"
+
+#include <QElapsedTimer>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QVarLengthArray>
+#include <QVector>
+#include <QtConcurrent>
+#include <qmath.h>
+
+#include <algorithm>
+#include <limits>
+
+using namespace GraphTheory;
+
+namespace
+{
+// quadtree cells below this depth keep all remaining bodies, which only happens for
+// (almost) coincident nodes
+const int MaximumDepth = 24;
+// nodes whose forces are computed by one concurrent task
+const int ChunkSize = 256;
+// step length factor of the adaptive cooling scheme
+const qreal StepFactor = 0.9;
+// coarsening stops when a level does not shrink below this ratio or is this small
+const qreal CoarseningRatio = 0.8;
+const int CoarsestSize = 8;
+
+struct Cell
+{
+    // mass weighted sum of the positions of all contained bodies, divided by mass gives the
+    // center of mass
+    qreal sumX;
+    qreal sumY;
+    qreal mass;
+    qreal centerX;
+    qreal centerY;
+    qreal half;
+    int child; // index of the first of four consecutive children, -1 for leaves
+    int body; // first body inserted into a leaf, -1 if empty
+};
+
+/**
+ * Barnes-Hut quadtree over a set of weighted points, stored in one array that is rebuilt for
+ * every iteration without reallocation.
+ */
+class QuadTree
+{
+public:
+    void build(const QVector<QPointF> &positions, const QVector<qreal> &masses)
+    {
+        qreal left = positions.first().x();
+        qreal right = left;
+        qreal top = positions.first().y();
+        qreal bottom = top;
+        foreach (const QPointF &position, positions) {
+            left = qMin(left, position.x());
+            right = qMax(right, position.x());
+            top = qMin(top, position.y());
+            bottom = qMax(bottom, position.y());
+        }
+        m_cells.resize(0);
+        m_leaf.resize(positions.size());
+        m_cells.append(createCell((left + right) / 2, (top + bottom) / 2,
+                                  qMax(qMax(right - left, bottom - top) / 2, qreal(1))));
+        for (int body = 0; body < positions.size(); ++body) {
+            insert(body, positions, masses);
+        }
+    }
+
+    /**
+     * @return repulsive displacement of @p body caused by all other bodies
+     */
+    QPointF repulsion(int body, const QPointF &position, qreal bodyMass, qreal strength, qreal theta2) const
+    {
+        QPointF displacement;
+        QVarLengthArray<int, 4 * MaximumDepth + 4> stack;
+        stack.append(0);
+        while (!stack.isEmpty()) {
+            const int index = stack.last();
+            stack.removeLast();
+            const Cell &cell = m_cells.at(index);
+            qreal mass = cell.mass;
+            qreal sumX = cell.sumX;
+            qreal sumY = cell.sumY;
+            if (index == m_leaf.at(body)) {
+                // leaf shared with coincident bodies: remove own contribution
+                mass -= bodyMass;
+                sumX -= bodyMass * position.x();
+                sumY -= bodyMass * position.y();
+            }
+            if (mass < 0.5) { // masses are node counts
+                continue;
+            }
+            qreal dx = position.x() - sumX / mass;
+            qreal dy = position.y() - sumY / mass;
+            qreal distance2 = dx * dx + dy * dy;
+            if (cell.child >= 0) {
+                const bool inside = qAbs(position.x() - cell.centerX) <= cell.half
+                    && qAbs(position.y() - cell.centerY) <= cell.half;
+                if (inside || 4 * cell.half * cell.half >= theta2 * distance2) {
+                    for (int i = 0; i < 4; ++i) {
+                        stack.append(cell.child + i);
+                    }
+                    continue;
+                }
+            }
+            if (distance2 < 1e-6) {
+                // push coincident nodes apart in a direction that only depends on the pair
+                const qreal angle = (body * 7919 + index * 104729) % 6283 / 1000.0;
+                dx = 0.01 * qCos(angle);
+                dy = 0.01 * qSin(angle);
+                distance2 = 1e-4;
+            }
+            const qreal factor = strength * mass * bodyMass / distance2;
+            displacement += QPointF(dx * factor, dy * factor);
+        }
+        return displacement;
+    }
+
+private:
+    static Cell createCell(qreal centerX, qreal centerY, qreal half)
+    {
+        Cell cell = { 0, 0, 0, centerX, centerY, half, -1, -1 };
+        return cell;
+    }
+
+    int quadrant(int index, const QPointF &position) const
+    {
+        const Cell &cell = m_cells.at(index);
+        return cell.child
+            + (position.x() < cell.centerX ? 0 : 1)
+            + (position.y() < cell.centerY ? 0 : 2);
+    }
+
+    void split(int index)
+    {
+        const qreal half = m_cells.at(index).half / 2;
+        const qreal x = m_cells.at(index).centerX;
+        const qreal y = m_cells.at(index).centerY;
+        m_cells[index].child = m_cells.size();
+        m_cells.append(createCell(x - half, y - half, half));
+        m_cells.append(createCell(x + half, y - half, half));
+        m_cells.append(createCell(x - half, y + half, half));
+        m_cells.append(createCell(x + half, y + half, half));
+    }
+
+    void add(int index, const QPointF &position, qreal mass)
+    {
+        Cell &cell = m_cells[index];
+        cell.sumX += mass * position.x();
+        cell.sumY += mass * position.y();
+        cell.mass += mass;
+    }
+
+    void insert(int body, const QVector<QPointF> &positions, const QVector<qreal> &masses)
+    {
+        const QPointF &position = positions.at(body);
+        int index = 0;
+        for (int depth = 0; ; ++depth) {
+            add(index, position, masses.at(body));
+            if (m_cells.at(index).child < 0) {
+                const int resident = m_cells.at(index).body;
+                if (resident < 0) {
+                    m_cells[index].body = body;
+                    m_leaf[body] = index;
+                    return;
+                }
+                if (depth >= MaximumDepth) {
+                    m_leaf[body] = index;
+                    return;
+                }
+                // move the resident one level down, its sums are already part of this cell
+                split(index);
+                m_cells[index].body = -1;
+                const int child = quadrant(index, positions.at(resident));
+                add(child, positions.at(resident), masses.at(resident));
+                m_cells[child].body = resident;
+                m_leaf[resident] = child;
+            }
+            index = quadrant(index, position);
+        }
+    }
+
+    QVector<Cell> m_cells;
+    QVector<int> m_leaf;
+};
+
+/**
+ * Graph of one level of the multilevel layout: the finest level represents the nodes, each node
+ * of a coarser level a group of adjacent nodes of the next finer level. Masses count the
+ * represented nodes, weights the represented edges.
+ */
+struct Level
+{
+    int size() const
+    {
+        return positions.size();
+    }
+
+    QVector<QPointF> positions;
+    QVector<qreal> masses;
+    // undirected adjacency in compressed row format
+    QVector<int> offsets;
+    QVector<int> adjacency;
+    QVector<qreal> weights;
+    // node of the next coarser level this node is merged into
+    QVector<int> groups;
+};
+
+/**
+ * Coarsen @p fine by a heavy edge matching. Nodes left without partner join the lightest adjacent
+ * group, such that also star like structures collapse.
+ * @return @e false if the level did not shrink sufficiently, otherwise @e true
+ */
+bool coarsen(Level &fine, Level &coarse)
+{
+    const int count = fine.size();
+    QVector<int> order(count);
+    for (int i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    // visit nodes of low degree first, which keeps hubs available as partners for leaves
+    std::stable_sort(order.begin(), order.end(), [&fine] (int a, int b) {
+        return fine.offsets.at(a + 1) - fine.offsets.at(a) < fine.offsets.at(b + 1) - fine.offsets.at(b);
+    });
+
+    QVector<int> &groups = fine.groups;
+    groups.fill(-1, count);
+    int groupCount = 0;
+    foreach (int node, order) {
+        if (groups.at(node) >= 0) {
+            continue;
+        }
+        int partner = -1;
+        qreal partnerWeight = 0;
+        for (int e = fine.offsets.at(node); e < fine.offsets.at(node + 1); ++e) {
+            const int neighbor = fine.adjacency.at(e);
+            if (groups.at(neighbor) < 0 && fine.weights.at(e) > partnerWeight) {
+                partner = neighbor;
+                partnerWeight = fine.weights.at(e);
+            }
+        }
+        if (partner >= 0) {
+            groups[node] = groupCount;
+            groups[partner] = groupCount;
+            ++groupCount;
+        }
+    }
+    QVector<qreal> groupMasses(groupCount, 0);
+    for (int node = 0; node < count; ++node) {
+        if (groups.at(node) >= 0) {
+            groupMasses[groups.at(node)] += fine.masses.at(node);
+        }
+    }
+    foreach (int node, order) {
+        if (groups.at(node) >= 0) {
+            continue;
+        }
+        // all neighbors are matched, otherwise the node would have a partner
+        int group = -1;
+        for (int e = fine.offsets.at(node); e < fine.offsets.at(node + 1); ++e) {
+            const int candidate = groups.at(fine.adjacency.at(e));
+            if (candidate >= 0 && (group < 0 || groupMasses.at(candidate) < groupMasses.at(group))) {
+                group = candidate;
+            }
+        }
+        if (group < 0) {
+            group = groupCount++;
+            groupMasses.append(0);
+        }
+        groups[node] = group;
+        groupMasses[group] += fine.masses.at(node);
+    }
+    if (groupCount > CoarseningRatio * count) {
+        return false;
+    }
+
+    // members of each group in compressed row format
+    QVector<int> memberOffsets(groupCount + 1, 0);
+    for (int node = 0; node < count; ++node) {
+        ++memberOffsets[groups.at(node) + 1];
+    }
+    for (int group = 0; group < groupCount; ++group) {
+        memberOffsets[group + 1] += memberOffsets[group];
+    }
+    QVector<int> members(count);
+    QVector<int> fill = memberOffsets;
+    for (int node = 0; node < count; ++node) {
+        members[fill[groups.at(node)]++] = node;
+    }
+
+    coarse.positions.fill(QPointF(), groupCount);
+    coarse.masses = groupMasses;
+    coarse.offsets.fill(0, groupCount + 1);
+    coarse.adjacency.clear();
+    coarse.weights.clear();
+    // slot of a neighboring group in the adjacency of the current group
+    QVector<int> rowPositions(groupCount, -1);
+    for (int group = 0; group < groupCount; ++group) {
+        const int first = coarse.adjacency.size();
+        for (int m = memberOffsets.at(group); m < memberOffsets.at(group + 1); ++m) {
+            const int node = members.at(m);
+            for (int e = fine.offsets.at(node); e < fine.offsets.at(node + 1); ++e) {
+                const int neighbor = groups.at(fine.adjacency.at(e));
+                if (neighbor == group) {
+                    continue;
+                }
+                if (rowPositions.at(neighbor) < first) {
+                    rowPositions[neighbor] = coarse.adjacency.size();
+                    coarse.adjacency.append(neighbor);
+                    coarse.weights.append(0);
+                }
+                coarse.weights[rowPositions.at(neighbor)] += fine.weights.at(e);
+            }
+        }
+        coarse.offsets[group + 1] = coarse.adjacency.size();
+    }
+    return true;
+}
+
+/**
+ * Place the nodes of @p level around @p center on a spiral with distance @p length between
+ * consecutive rings.
+ */
+void placeOnSpiral(Level &level, const QPointF &center, qreal length)
+{
+    for (int i = 0; i < level.size(); ++i) {
+        const qreal angle = i * 2.39996; // golden angle
+        const qreal radius = length * qSqrt(i);
+        level.positions[i] = center + QPointF(radius * qCos(angle), radius * qSin(angle));
+    }
+}
+
+/**
+ * Place the nodes of @p fine at the positions of their groups in @p coarse, members of the same
+ * group are placed around it. The area of a layout grows with the number of nodes, hence the
+ * coarse layout is scaled accordingly.
+ */
+void interpolate(const Level &coarse, Level &fine, qreal length)
+{
+    QPointF center;
+    foreach (const QPointF &position, coarse.positions) {
+        center += position;
+    }
+    center = center * (qreal(1) / coarse.size());
+    const qreal scale = qSqrt(qreal(fine.size()) / coarse.size());
+
+    QVector<int> ranks(coarse.size(), 0);
+    for (int node = 0; node < fine.size(); ++node) {
+        const int group = fine.groups.at(node);
+        const int rank = ranks[group]++;
+        const qreal angle = rank * 2.39996;
+        const qreal radius = rank == 0 ? 0 : length / 4;
+        fine.positions[node] = center + (coarse.positions.at(group) - center) * scale
+            + QPointF(radius * qCos(angle), radius * qSin(angle));
+    }
+}
+
+QRectF boundingRect(const QVector<QPointF> &positions)
+{
+    QPointF topLeft = positions.first();
+    QPointF bottomRight = topLeft;
+    foreach (const QPointF &position, positions) {
+        topLeft = QPointF(qMin(topLeft.x(), position.x()), qMin(topLeft.y(), position.y()));
+        bottomRight = QPointF(qMax(bottomRight.x(), position.x()), qMax(bottomRight.y(), position.y()));
+    }
+    return QRectF(topLeft, bottomRight);
+}
+}
+
+class GraphTheory::ForceDirectedLayoutPrivate
+{
+public:
+    ForceDirectedLayoutPrivate()
+        : edgeLength(100)
+        , theta(1)
+        , maximumIterations(1000)
+        , tolerance(0.01)
+        , updateInterval(50)
+        , multilevel(false)
+        , live(false)
+        , iterations(0)
+        , converged(false)
+        , pinnedCount(0)
+    {
+    }
+
+    void prepare(const NodeList &nodes);
+    void applyPositions(const QVector<QPointF> &positions);
+
+    /**
+     * Move the nodes of @p level until their positions converge.
+     * @return @e true if converged, otherwise @e false
+     */
+    bool relax(ForceDirectedLayout *q, Level &level, qreal step, int progressOffset, int progressMaximum);
+
+    qreal edgeLength;
+    qreal theta;
+    int maximumIterations;
+    qreal tolerance;
+    int updateInterval;
+    bool multilevel;
+    std::function<bool()> cancelCondition;
+
+    QFutureWatcher<void> watcher;
+    QAtomicInt canceled;
+    bool live;
+    int iterations;
+    bool converged;
+
+    // input, only accessed by the thread that started the layout
+    GraphDocumentPtr document;
+    NodeList nodes;
+    NodeList pinnedNodes;
+
+    // nodes of the finest level that keep their position
+    QVector<bool> pinned;
+    int pinnedCount;
+
+    // owned by the layout computation while it is running, the first level holds the nodes
+    QVector<Level> levels;
+
+    // intermediate result for the thread that started the layout
+    QMutex mutex;
+    QVector<QPointF> published;
+};
+
+void ForceDirectedLayoutPrivate::prepare(const NodeList &list)
+{
+    nodes = list;
+    document = nodes.first()->document();
+    iterations = 0;
+    converged = false;
+    canceled.store(0);
+
+    levels.resize(1);
+    Level &level = levels.first();
+    QHash<const Node*, int> indices;
+    indices.reserve(nodes.size());
+    level.positions.resize(nodes.size());
+    level.masses.fill(1, nodes.size());
+    for (int i = 0; i < nodes.size(); ++i) {
+        indices.insert(nodes.at(i).data(), i);
+        level.positions[i] = nodes.at(i)->position();
+    }
+
+    // multilevel layouts start from scratch, hence cannot respect pinned nodes
+    pinned.clear();
+    pinnedCount = 0;
+    if (!multilevel && !pinnedNodes.isEmpty()) {
+        pinned.fill(false, nodes.size());
+        foreach (const NodePtr &node, pinnedNodes) {
+            const int index = indices.value(node.data(), -1);
+            if (index >= 0 && !pinned.at(index)) {
+                pinned[index] = true;
+                ++pinnedCount;
+            }
+        }
+    }
+
+    // edges leaving the node set are ignored, collecting them from the nodes keeps the effort
+    // proportional to the node set
+    QVector<QPair<int, int>> pairs;
+    for (int from = 0; from < nodes.size(); ++from) {
+        foreach (const EdgePtr &edge, nodes.at(from)->edges()) {
+            if (edge->from() != nodes.at(from)) {
+                continue;
+            }
+            const int to = indices.value(edge->to().data(), -1);
+            if (to < 0 || from == to) {
+                continue;
+            }
+            pairs.append(qMakePair(from, to));
+        }
+    }
+    level.offsets.fill(0, nodes.size() + 1);
+    foreach (const auto &pair, pairs) {
+        ++level.offsets[pair.first + 1];
+        ++level.offsets[pair.second + 1];
+    }
+    for (int i = 0; i < nodes.size(); ++i) {
+        level.offsets[i + 1] += level.offsets[i];
+    }
+    level.adjacency.resize(level.offsets.last());
+    level.weights.fill(1, level.offsets.last());
+    QVector<int> fill = level.offsets;
+    foreach (const auto &pair, pairs) {
+        level.adjacency[fill[pair.first]++] = pair.second;
+        level.adjacency[fill[pair.second]++] = pair.first;
+    }
+}
+
+void ForceDirectedLayoutPrivate::applyPositions(const QVector<QPointF> &result)
+{
+    // nodes may have been removed meanwhile, all movements are published at once
+    BatchGuard batch(document);
+    for (int i = 0; i < nodes.size(); ++i) {
+        if (nodes.at(i)->isValid()) {
+            nodes.at(i)->setPosition(result.at(i));
+        }
+    }
+}
+
+bool ForceDirectedLayoutPrivate::relax(ForceDirectedLayout *q, Level &level, qreal step,
+                                       int progressOffset, int progressMaximum)
+{
+    QVector<QPointF> &positions = level.positions;
+    const int count = positions.size();
+    const bool *fixed = &level == &levels.first() && pinnedCount > 0 ? pinned.constData() : 0;
+    const int movableCount = fixed ? count - pinnedCount : count;
+    if (count <= 1 || movableCount == 0) {
+        return true;
+    }
+    const qreal k = edgeLength;
+    const qreal strength = k * k;
+    const qreal theta2 = theta * theta;
+    const qreal *masses = level.masses.constData();
+    const int *offsets = level.offsets.constData();
+    const int *adjacency = level.adjacency.constData();
+    const qreal *weights = level.weights.constData();
+    int adjacencyCount = level.adjacency.size();
+    if (fixed) {
+        for (int i = 0; i < count; ++i) {
+            if (fixed[i]) {
+                adjacencyCount -= offsets[i + 1] - offsets[i];
+            }
+        }
+    }
+    const bool publish = live && &level == &levels.first();
+
+    QuadTree tree;
+    QVector<QPointF> displacements(count);
+    QVector<qreal> edgeLengths(count);
+    QVector<QPair<int, int>> chunks;
+    for (int first = 0; first < count; first += ChunkSize) {
+        chunks.append(qMakePair(first, qMin(first + ChunkSize, count)));
+    }
+
+    // adaptive step length (Hu 2005): grow after continued energy decrease, shrink otherwise
+    qreal energy = std::numeric_limits<qreal>::max();
+    int progress = 0;
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int iteration = 1; iteration <= maximumIterations && canceled.load() == 0; ++iteration) {
+        if (!live && cancelCondition && cancelCondition()) {
+            canceled.store(1);
+            break;
+        }
+        tree.build(positions, level.masses);
+        const QPointF *current = positions.constData();
+        // detach once, entries are written concurrently
+        QPointF *displacement = displacements.data();
+        qreal *lengthSums = edgeLengths.data();
+        QtConcurrent::blockingMap(chunks, [&tree, current, displacement, lengthSums, fixed, masses, offsets, adjacency, weights, k, strength, theta2]
+                                          (const QPair<int, int> &chunk) {
+            for (int i = chunk.first; i < chunk.second; ++i) {
+                if (fixed && fixed[i]) {
+                    displacement[i] = QPointF();
+                    lengthSums[i] = 0;
+                    continue;
+                }
+                QPointF force = tree.repulsion(i, current[i], masses[i], strength, theta2);
+                qreal lengths = 0;
+                for (int e = offsets[i]; e < offsets[i + 1]; ++e) {
+                    const QPointF delta = current[adjacency[e]] - current[i];
+                    const qreal length = qSqrt(QPointF::dotProduct(delta, delta));
+                    force += delta * (weights[e] * length / k);
+                    lengths += length;
+                }
+                displacement[i] = force;
+                lengthSums[i] = lengths;
+            }
+        });
+
+        const qreal previousEnergy = energy;
+        energy = 0;
+        qreal movement = 0;
+        qreal lengths = 0;
+        for (int i = 0; i < count; ++i) {
+            lengths += edgeLengths.at(i);
+            const qreal force2 = QPointF::dotProduct(displacements.at(i), displacements.at(i));
+            energy += force2;
+            if (force2 > 0) {
+                const qreal length = qMin(step, qSqrt(force2));
+                positions[i] += displacements.at(i) * (length / qSqrt(force2));
+                movement += length;
+            }
+        }
+        ++iterations;
+
+        if (energy < previousEnergy) {
+            if (++progress >= 5) {
+                progress = 0;
+                step /= StepFactor;
+            }
+        } else {
+            progress = 0;
+            step *= StepFactor;
+        }
+        // layouts of large graphs spread out, hence movements are measured in current edge lengths
+        const qreal scale = adjacencyCount > 0 && lengths > 0 ? lengths / adjacencyCount : k;
+        if (movement / movableCount < tolerance * scale) {
+            return true;
+        }
+
+        if (live && timer.elapsed() >= updateInterval) {
+            timer.restart();
+            if (publish) {
+                QMutexLocker locker(&mutex);
+                const bool pending = !published.isEmpty();
+                published = positions;
+                if (!pending) {
+                    QMetaObject::invokeMethod(q, "applyPublishedPositions", Qt::QueuedConnection);
+                }
+            }
+            emit q->progressChanged(progressOffset + iteration, progressMaximum);
+        }
+    }
+    return false;
+}
+
+ForceDirectedLayout::ForceDirectedLayout(QObject *parent)
+    : QObject(parent)
+    , d(new ForceDirectedLayoutPrivate)
+{
+    connect(&d->watcher, &QFutureWatcher<void>::finished, this, &ForceDirectedLayout::finish);
+}
+
+ForceDirectedLayout::~ForceDirectedLayout()
+{
+    if (isRunning()) {
+        d->canceled.store(1);
+        d->watcher.waitForFinished();
+    }
+}
+
+qreal ForceDirectedLayout::edgeLength() const
+{
+    return d->edgeLength;
+}
+
+void ForceDirectedLayout::setEdgeLength(qreal length)
+{
+    d->edgeLength = length;
+}
+
+qreal ForceDirectedLayout::theta() const
+{
+    return d->theta;
+}
+
+void ForceDirectedLayout::setTheta(qreal theta)
+{
+    d->theta = theta;
+}
+
+int ForceDirectedLayout::maximumIterations() const
+{
+    return d->maximumIterations;
+}
+
+void ForceDirectedLayout::setMaximumIterations(int iterations)
+{
+    d->maximumIterations = iterations;
+}
+
+qreal ForceDirectedLayout::tolerance() const
+{
+    return d->tolerance;
+}
+
+void ForceDirectedLayout::setTolerance(qreal tolerance)
+{
+    d->tolerance = tolerance;
+}
+
+int ForceDirectedLayout::updateInterval() const
+{
+    return d->updateInterval;
+}
+
+void ForceDirectedLayout::setUpdateInterval(int milliseconds)
+{
+    d->updateInterval = milliseconds;
+}
+
+NodeList ForceDirectedLayout::pinnedNodes() const
+{
+    return d->pinnedNodes;
+}
+
+void ForceDirectedLayout::setPinnedNodes(const NodeList &nodes)
+{
+    d->pinnedNodes = nodes;
+}
+
+bool ForceDirectedLayout::isMultilevel() const
+{
+    return d->multilevel;
+}
+
+void ForceDirectedLayout::setMultilevel(bool multilevel)
+{
+    d->multilevel = multilevel;
+}
+
+void ForceDirectedLayout::setCancelCondition(const std::function<bool()> &condition)
+{
+    d->cancelCondition = condition;
+}
+
+void ForceDirectedLayout::apply(const NodeList &nodes)
+{
+    if (isRunning() || nodes.isEmpty()) {
+        return;
+    }
+    d->prepare(nodes);
+    d->live = false;
+    run();
+    if (!isCanceled()) {
+        d->applyPositions(d->levels.first().positions);
+    }
+    d->nodes.clear();
+    d->document.reset();
+    d->levels.clear();
+    d->pinned.clear();
+}
+
+bool ForceDirectedLayout::start(const NodeList &nodes)
+{
+    if (isRunning()) {
+        return false;
+    }
+    if (nodes.isEmpty()) {
+        d->iterations = 0;
+        d->converged = true;
+        d->canceled.store(0);
+        emit finished();
+        return true;
+    }
+    d->prepare(nodes);
+    d->live = true;
+    d->watcher.setFuture(QtConcurrent::run(this, &ForceDirectedLayout::run));
+    return true;
+}
+
+void ForceDirectedLayout::run()
+{
+    // executed in worker thread when started asynchronously: only touch the private
+    // layout data and publish copies of the positions
+    const qreal k = d->edgeLength;
+    QVector<Level> &levels = d->levels;
+    const QRectF bounds = boundingRect(levels.first().positions);
+
+    if (d->multilevel) {
+        while (levels.last().size() > CoarsestSize && d->canceled.load() == 0) {
+            Level coarse;
+            if (!coarsen(levels.last(), coarse)) {
+                break;
+            }
+            levels.append(coarse);
+        }
+    }
+    const int progressMaximum = levels.size() * d->maximumIterations;
+
+    // layouts need distinct positions to start from, multilevel layouts always start from scratch
+    Level &coarsest = levels.last();
+    qreal step = qMax(k, qMax(bounds.width(), bounds.height()) / 10);
+    if (d->multilevel || (d->pinnedCount == 0 && bounds.width() < 1 && bounds.height() < 1)) {
+        placeOnSpiral(coarsest, bounds.center(), k);
+        step = qMax(k, k * qSqrt(coarsest.size()) / 5);
+    }
+    d->converged = d->relax(this, coarsest, step, 0, progressMaximum);
+
+    // refine level by level, the coarse layout only needs local corrections
+    for (int i = levels.size() - 2; i >= 0 && d->canceled.load() == 0; --i) {
+        interpolate(levels.at(i + 1), levels[i], k);
+        const int progressOffset = (levels.size() - 1 - i) * d->maximumIterations;
+        d->converged = d->relax(this, levels[i], k, progressOffset, progressMaximum);
+        levels.resize(i + 1);
+    }
+    if (d->canceled.load() != 0) {
+        d->converged = false;
+    }
+    emit progressChanged(d->converged ? progressMaximum : qMin(d->iterations, progressMaximum), progressMaximum);
+}
+
+void ForceDirectedLayout::applyPublishedPositions()
+{
+    QVector<QPointF> positions;
+    {
+        QMutexLocker locker(&d->mutex);
+        positions.swap(d->published);
+    }
+    if (positions.isEmpty() || d->nodes.isEmpty()) {
+        return;
+    }
+    d->applyPositions(positions);
+}
+
+void ForceDirectedLayout::finish()
+{
+    {
+        // drop intermediate positions that were not applied yet
+        QMutexLocker locker(&d->mutex);
+        d->published.clear();
+    }
+    d->applyPositions(d->levels.first().positions);
+    d->nodes.clear();
+    d->document.reset();
+    d->levels.clear();
+    d->pinned.clear();
+    emit finished();
+}
+
+void ForceDirectedLayout::cancel()
+{
+    if (isRunning()) {
+        d->canceled.store(1);
+    }
+}
+
+bool ForceDirectedLayout::isRunning() const
+{
+    return d->watcher.isRunning();
+}
+
+bool ForceDirectedLayout::isCanceled() const
+{
+    return d->canceled.load() != 0;
+}
+
+int ForceDirectedLayout::iterations() const
+{
+    return d->iterations;
+}
+
+bool ForceDirectedLayout::isConverged() const
+{
+    return d->converged;
+}
@@ -0,0 +1,177 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FORCEDIRECTEDLAYOUT_H
+#define FORCEDIRECTEDLAYOUT_H
+
+#include "typenames.h"
+#include "graphtheory_export.h"
+
+#include <QObject>
+
+#include <functional>
+
+namespace GraphTheory
+{
+
+class ForceDirectedLayoutPrivate;
+
+/**
+ * \class ForceDirectedLayout
+ * Fruchterman-Reingold force directed layout for large graphs.
+ *
+ * Repulsive forces are approximated by a Barnes-Hut quadtree, hence an iteration costs
+ * O(n log n) for n nodes instead of O(n^2). The forces of all nodes are computed in parallel.
+ * The step length is adapted to the progress of the system energy and the layout stops as
+ * soon as the average node movement falls below tolerance() times the average edge length,
+ * or after maximumIterations() iterations.
+ *
+ * The layout either runs synchronously by apply() or in a worker thread by start(). While
+ * running in a worker thread, the current positions are applied to the nodes about every
+ * updateInterval() milliseconds, such that views show the progress, and the layout can be
+ * aborted by cancel(). All edges between the given nodes are considered, their direction
+ * and type is ignored. For very large graphs the multilevel mode gives good layouts in
+ * near-linear time.
+ */
+class GRAPHTHEORY_EXPORT ForceDirectedLayout : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit ForceDirectedLayout(QObject *parent = 0);
+
+    /**
+     * Cancels a running layout and waits for the worker to finish.
+     */
+    ~ForceDirectedLayout();
+
+    /**
+     * @return ideal edge length, default is 100
+     */
+    qreal edgeLength() const;
+    void setEdgeLength(qreal length);
+
+    /**
+     * Barnes-Hut opening criterion: a quadtree cell of size s in distance d is approximated
+     * by its center of mass if s/d < theta. 0 computes exact forces, default is 1.
+     */
+    qreal theta() const;
+    void setTheta(qreal theta);
+
+    /**
+     * @return maximal number of iterations, per level in multilevel mode, default is 1000
+     */
+    int maximumIterations() const;
+    void setMaximumIterations(int iterations);
+
+    /**
+     * @return average node movement relative to the current average edge length below which
+     *         the layout is considered converged, default is 0.01
+     */
+    qreal tolerance() const;
+    void setTolerance(qreal tolerance);
+
+    /**
+     * @return interval in milliseconds at which a layout running in a worker thread applies
+     *         intermediate positions, default is 50
+     */
+    int updateInterval() const;
+    void setUpdateInterval(int milliseconds);
+
+    /**
+     * Pinned nodes keep their position but still push and pull the other nodes. This allows
+     * to lay out only a part of a graph in the context of its surrounding. Pinned nodes are
+     * ignored in multilevel mode. Default is an empty list.
+     */
+    NodeList pinnedNodes() const;
+    void setPinnedNodes(const NodeList &nodes);
+
+    /**
+     * In multilevel mode the graph is repeatedly coarsened by merging matched adjacent nodes.
+     * The coarsest graph is laid out first and each finer level starts from the interpolated
+     * positions of the coarser one, which only needs few local iterations. The current
+     * node positions are ignored except for their center. Default is @e false.
+     */
+    bool isMultilevel() const;
+    void setMultilevel(bool multilevel);
+
+    /**
+     * A layout computed by apply() evaluates @p condition once per iteration and stops without
+     * moving any node as soon as it returns @e true. Layouts in a worker thread are stopped
+     * by cancel() instead. Default is no condition.
+     */
+    void setCancelCondition(const std::function<bool()> &condition);
+
+    /**
+     * Compute the layout of @p nodes in the calling thread and apply it.
+     * All nodes must belong to the same document.
+     */
+    void apply(const NodeList &nodes);
+
+    /**
+     * Start the layout of @p nodes in a worker thread. Node positions and edges are read when
+     * calling this method, later changes of the graph structure are not considered.
+     * @return @e true if the layout was started, otherwise @e false if another layout is
+     *         still running
+     */
+    bool start(const NodeList &nodes);
+
+    /**
+     * Request a running layout to stop. The positions of the last finished iteration are
+     * applied and finished() is emitted.
+     */
+    void cancel();
+
+    /**
+     * @return @e true while a layout is running in a worker thread, otherwise @e false
+     */
+    bool isRunning() const;
+
+    /**
+     * @return @e true if the last layout was canceled or stopped by its cancel condition,
+     *         otherwise @e false
+     */
+    bool isCanceled() const;
+
+    /**
+     * @return number of iterations of the last layout
+     */
+    int iterations() const;
+
+    /**
+     * @return @e true if the last layout stopped because the positions converged
+     */
+    bool isConverged() const;
+
+Q_SIGNALS:
+    void progressChanged(int iteration, int maximum);
+    void finished();
+
+private Q_SLOTS:
+    void applyPublishedPositions();
+    void finish();
+
+private:
+    void run();
+    const QScopedPointer<ForceDirectedLayoutPrivate> d;
+};
+}
+
+#endif
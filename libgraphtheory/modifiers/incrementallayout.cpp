@@ -0,0 +1,294 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "incrementallayout.h"
+#include "forcedirectedlayout.h"
+#include "graphdocument.h"
+#include "node.h"
+#include "edge.h"
+
+#include <QHash>
+#include <QQueue>
+#include <QSet>
+#include <qmath.h>
+
+using namespace GraphTheory;
+
+class GraphTheory::IncrementalLayoutPrivate
+{
+public:
+    IncrementalLayoutPrivate(GraphDocumentPtr document)
+        : document(document)
+        , edgeLength(100)
+        , neighborhoodRadius(300)
+        , maximumIterations(100)
+    {
+    }
+
+    void addNode(const NodePtr &node)
+    {
+        if (!added.contains(node.data())) {
+            added.insert(node.data(), node);
+        }
+    }
+
+    void addEdge(const EdgePtr &edge)
+    {
+        if (!changed.contains(edge->from().data())) {
+            changed.insert(edge->from().data(), edge->from());
+        }
+        if (!changed.contains(edge->to().data())) {
+            changed.insert(edge->to().data(), edge->to());
+        }
+    }
+
+    /**
+     * Place all new nodes at the barycenter of their placed neighbors, starting at the nodes
+     * next to the present graph. New nodes without any placed neighbor keep their position.
+     */
+    void placeAddedNodes(const NodeList &nodes);
+
+    GraphDocumentPtr document;
+    qreal edgeLength;
+    qreal neighborhoodRadius;
+    int maximumIterations;
+    QHash<const Node*, NodePtr> added;
+    QHash<const Node*, NodePtr> changed;
+};
+
+void IncrementalLayoutPrivate::placeAddedNodes(const NodeList &nodes)
+{
+    QSet<const Node*> unplaced;
+    foreach (const NodePtr &node, nodes) {
+        unplaced.insert(node.data());
+    }
+    QQueue<NodePtr> queue;
+    foreach (const NodePtr &node, nodes) {
+        foreach (const EdgePtr &edge, node->edges()) {
+            const NodePtr other = edge->from() == node ? edge->to() : edge->from();
+            if (!unplaced.contains(other.data())) {
+                queue.enqueue(node);
+                break;
+            }
+        }
+    }
+
+    // nodes are queued once a neighbor is placed
+    int placed = 0;
+    int seed = 0;
+    while (!unplaced.isEmpty()) {
+        NodePtr node;
+        if (queue.isEmpty()) {
+            // the remaining new nodes are not connected to the present graph
+            while (!unplaced.contains(nodes.at(seed).data())) {
+                ++seed;
+            }
+            node = nodes.at(seed);
+        } else {
+            node = queue.dequeue();
+            if (!unplaced.contains(node.data())) {
+                continue;
+            }
+            QPointF sum;
+            int count = 0;
+            foreach (const EdgePtr &edge, node->edges()) {
+                const NodePtr other = edge->from() == node ? edge->to() : edge->from();
+                if (!unplaced.contains(other.data())) {
+                    sum += other->position();
+                    ++count;
+                }
+            }
+            // spread nodes that share their neighbors
+            const qreal angle = ++placed * 2.39996; // golden angle
+            node->setPosition(sum / count + QPointF(qCos(angle), qSin(angle)) * (edgeLength / 2));
+        }
+        unplaced.remove(node.data());
+        foreach (const EdgePtr &edge, node->edges()) {
+            const NodePtr other = edge->from() == node ? edge->to() : edge->from();
+            if (unplaced.contains(other.data())) {
+                queue.enqueue(other);
+            }
+        }
+    }
+}
+
+IncrementalLayout::IncrementalLayout(GraphDocumentPtr document, QObject *parent)
+    : QObject(parent)
+    , d(new IncrementalLayoutPrivate(document))
+{
+    connect(document.data(), &GraphDocument::nodeAboutToBeAdded, this, &IncrementalLayout::onNodeAdded);
+    connect(document.data(), &GraphDocument::nodesAboutToBeAdded, this, &IncrementalLayout::onNodesAdded);
+    connect(document.data(), &GraphDocument::edgeAboutToBeAdded, this, &IncrementalLayout::onEdgeAdded);
+    connect(document.data(), &GraphDocument::edgesAboutToBeAdded, this, &IncrementalLayout::onEdgesAdded);
+    connect(document.data(), &GraphDocument::edgesAboutToBeRemoved, this, &IncrementalLayout::onEdgesAboutToBeRemoved);
+}
+
+IncrementalLayout::~IncrementalLayout()
+{
+}
+
+qreal IncrementalLayout::edgeLength() const
+{
+    return d->edgeLength;
+}
+
+void IncrementalLayout::setEdgeLength(qreal length)
+{
+    d->edgeLength = length;
+}
+
+qreal IncrementalLayout::neighborhoodRadius() const
+{
+    return d->neighborhoodRadius;
+}
+
+void IncrementalLayout::setNeighborhoodRadius(qreal radius)
+{
+    d->neighborhoodRadius = radius;
+}
+
+int IncrementalLayout::maximumIterations() const
+{
+    return d->maximumIterations;
+}
+
+void IncrementalLayout::setMaximumIterations(int iterations)
+{
+    d->maximumIterations = iterations;
+}
+
+void IncrementalLayout::addNode(NodePtr node)
+{
+    d->addNode(node);
+}
+
+void IncrementalLayout::addEdge(EdgePtr edge)
+{
+    d->addEdge(edge);
+}
+
+NodeList IncrementalLayout::changedNodes() const
+{
+    NodeList nodes;
+    foreach (const NodePtr &node, d->added) {
+        if (node->isValid()) {
+            nodes.append(node);
+        }
+    }
+    foreach (const NodePtr &node, d->changed) {
+        if (node->isValid() && !d->added.contains(node.data())) {
+            nodes.append(node);
+        }
+    }
+    return nodes;
+}
+
+bool IncrementalLayout::hasChanges() const
+{
+    return !d->added.isEmpty() || !d->changed.isEmpty();
+}
+
+void IncrementalLayout::clear()
+{
+    d->added.clear();
+    d->changed.clear();
+}
+
+void IncrementalLayout::apply()
+{
+    NodeList added;
+    foreach (const NodePtr &node, d->added) {
+        if (node->isValid()) {
+            added.append(node);
+        }
+    }
+    const NodeList nodes = changedNodes();
+    clear();
+    if (nodes.isEmpty()) {
+        return;
+    }
+
+    BatchGuard batch(d->document);
+    d->placeAddedNodes(added);
+
+    // pin all adjacent and close nodes, they form the context of the changed nodes
+    QSet<const Node*> visited;
+    foreach (const NodePtr &node, nodes) {
+        visited.insert(node.data());
+    }
+    NodeList context;
+    const QPointF radius(d->neighborhoodRadius, d->neighborhoodRadius);
+    foreach (const NodePtr &node, nodes) {
+        foreach (const EdgePtr &edge, node->edges()) {
+            const NodePtr other = edge->from() == node ? edge->to() : edge->from();
+            if (!visited.contains(other.data())) {
+                visited.insert(other.data());
+                context.append(other);
+            }
+        }
+        const QRectF area(node->position() - radius, node->position() + radius);
+        foreach (const NodePtr &other, d->document->nodesAt(area)) {
+            if (!visited.contains(other.data())) {
+                visited.insert(other.data());
+                context.append(other);
+            }
+        }
+    }
+
+    ForceDirectedLayout layout;
+    layout.setEdgeLength(d->edgeLength);
+    layout.setMaximumIterations(d->maximumIterations);
+    layout.setPinnedNodes(context);
+    layout.apply(nodes + context);
+}
+
+void IncrementalLayout::onNodeAdded(NodePtr node)
+{
+    d->addNode(node);
+}
+
+void IncrementalLayout::onNodesAdded(int first, int last)
+{
+    const NodeList nodes = d->document->nodes();
+    for (int i = first; i <= last; ++i) {
+        d->addNode(nodes.at(i));
+    }
+}
+
+void IncrementalLayout::onEdgeAdded(EdgePtr edge)
+{
+    d->addEdge(edge);
+}
+
+void IncrementalLayout::onEdgesAdded(int first, int last)
+{
+    const EdgeList edges = d->document->edges();
+    for (int i = first; i <= last; ++i) {
+        d->addEdge(edges.at(i));
+    }
+}
+
+void IncrementalLayout::onEdgesAboutToBeRemoved(int first, int last)
+{
+    const EdgeList edges = d->document->edges();
+    for (int i = first; i <= last; ++i) {
+        d->addEdge(edges.at(i));
+    }
+}
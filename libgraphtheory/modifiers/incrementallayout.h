@@ -0,0 +1,118 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef INCREMENTALLAYOUT_H
+#define INCREMENTALLAYOUT_H
+
+#include "typenames.h"
+#include "graphtheory_export.h"
+
+#include <QObject>
+
+namespace GraphTheory
+{
+
+class IncrementalLayoutPrivate;
+
+/**
+ * \class IncrementalLayout
+ * Keeps the layout of a graph document up to date after local edits.
+ *
+ * The layout records all nodes that were added to the document and the end nodes of all
+ * added and removed edges since the last call of apply(). Only these nodes are moved: new
+ * nodes are first placed next to their already placed neighbors and then all changed nodes
+ * are relaxed by the force directed layout of ForceDirectedLayout. Their neighbors and all
+ * nodes within neighborhoodRadius() are pinned, such that they shape the result without
+ * being moved. Hence, the effort of apply() depends on the size of the change and not on
+ * the size of the graph.
+ *
+ * Nodes and edges added during a batch of the document are only announced at the end of
+ * the batch. Code that lays out within a batch must register them by addNode() and addEdge().
+ */
+class GRAPHTHEORY_EXPORT IncrementalLayout : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit IncrementalLayout(GraphDocumentPtr document, QObject *parent = 0);
+    ~IncrementalLayout();
+
+    /**
+     * @return ideal edge length, default is 100
+     */
+    qreal edgeLength() const;
+    void setEdgeLength(qreal length);
+
+    /**
+     * @return distance around each changed node in which other nodes are considered,
+     *         default is 300
+     */
+    qreal neighborhoodRadius() const;
+    void setNeighborhoodRadius(qreal radius);
+
+    /**
+     * @return maximal number of force directed iterations of apply(), default is 100
+     */
+    int maximumIterations() const;
+    void setMaximumIterations(int iterations);
+
+    /**
+     * Register @p node as newly added, it is placed next to its neighbors by apply().
+     */
+    void addNode(NodePtr node);
+
+    /**
+     * Register @p edge as changed, its end nodes are moved by apply().
+     */
+    void addEdge(EdgePtr edge);
+
+    /**
+     * @return all valid nodes that are moved by the next apply()
+     */
+    NodeList changedNodes() const;
+
+    /**
+     * @return @e true if nodes or edges changed since the last apply(), otherwise @e false
+     */
+    bool hasChanges() const;
+
+    /**
+     * Forget all recorded changes, e.g. after the whole document was laid out.
+     */
+    void clear();
+
+    /**
+     * Move all changed nodes and forget the recorded changes.
+     */
+    void apply();
+
+private Q_SLOTS:
+    void onNodeAdded(NodePtr node);
+    void onNodesAdded(int first, int last);
+    void onEdgeAdded(EdgePtr edge);
+    void onEdgesAdded(int first, int last);
+    void onEdgesAboutToBeRemoved(int first, int last);
+
+private:
+    const QScopedPointer<IncrementalLayoutPrivate> d;
+};
+}
+
+#endif
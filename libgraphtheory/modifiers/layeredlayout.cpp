@@ -0,0 +1,677 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "layeredlayout.h"
+#include "graphdocument.h"
+#include "node.h"
+#include "edge.h"
+#include "edgetype.h"
+
+#include <QHash>
+#include <QPair>
+#include <QVector>
+
+#include <algorithm>
+#include <limits>
+
+using namespace GraphTheory;
+
+namespace
+{
+typedef QPair<int, int> Arc;
+
+/**
+ * Adjacency of a directed graph in compressed row format.
+ */
+struct Adjacency
+{
+    Adjacency(int count, const QVector<Arc> &arcs, bool reverse)
+        : offsets(count + 1, 0)
+        , targets(arcs.size())
+        , arcIds(arcs.size())
+    {
+        foreach (const Arc &arc, arcs) {
+            ++offsets[(reverse ? arc.second : arc.first) + 1];
+        }
+        for (int i = 0; i < count; ++i) {
+            offsets[i + 1] += offsets[i];
+        }
+        QVector<int> fill = offsets;
+        for (int id = 0; id < arcs.size(); ++id) {
+            const int from = reverse ? arcs.at(id).second : arcs.at(id).first;
+            const int to = reverse ? arcs.at(id).first : arcs.at(id).second;
+            targets[fill[from]] = to;
+            arcIds[fill[from]++] = id;
+        }
+    }
+
+    QVector<int> offsets;
+    QVector<int> targets;
+    QVector<int> arcIds;
+};
+
+/**
+ * Node buckets of the greedy cycle removal: sinks, sources and all other nodes by the
+ * difference of their out and in degree, as doubly linked lists.
+ */
+class DegreeBuckets
+{
+public:
+    enum { Sinks = 0, Sources = 1 };
+
+    DegreeBuckets(int count, int maximumDegree)
+        : m_maximumDegree(maximumDegree)
+        , m_heads(2 * maximumDegree + 3, -1)
+        , m_next(count, -1)
+        , m_previous(count, -1)
+        , m_bucket(count, -1)
+        , m_top(Sources)
+    {
+    }
+
+    int bucket(int outDegree, int inDegree) const
+    {
+        if (outDegree == 0) {
+            return Sinks;
+        }
+        if (inDegree == 0) {
+            return Sources;
+        }
+        return 2 + outDegree - inDegree + m_maximumDegree;
+    }
+
+    void insert(int node, int bucket)
+    {
+        m_bucket[node] = bucket;
+        m_previous[node] = -1;
+        m_next[node] = m_heads.at(bucket);
+        if (m_heads.at(bucket) >= 0) {
+            m_previous[m_heads.at(bucket)] = node;
+        }
+        m_heads[bucket] = node;
+        m_top = qMax(m_top, bucket);
+    }
+
+    void remove(int node)
+    {
+        if (m_previous.at(node) >= 0) {
+            m_next[m_previous.at(node)] = m_next.at(node);
+        } else {
+            m_heads[m_bucket.at(node)] = m_next.at(node);
+        }
+        if (m_next.at(node) >= 0) {
+            m_previous[m_next.at(node)] = m_previous.at(node);
+        }
+        m_bucket[node] = -1;
+    }
+
+    void move(int node, int bucket)
+    {
+        if (m_bucket.at(node) != bucket) {
+            remove(node);
+            insert(node, bucket);
+        }
+    }
+
+    /**
+     * @return first node of @p bucket or -1 if empty
+     */
+    int first(int bucket) const
+    {
+        return m_heads.at(bucket);
+    }
+
+    /**
+     * @return node with the largest degree difference or -1 if there is none
+     */
+    int largest()
+    {
+        while (m_top > Sources && m_heads.at(m_top) < 0) {
+            --m_top;
+        }
+        return m_top > Sources ? m_heads.at(m_top) : -1;
+    }
+
+private:
+    int m_maximumDegree;
+    QVector<int> m_heads;
+    QVector<int> m_next;
+    QVector<int> m_previous;
+    QVector<int> m_bucket;
+    int m_top;
+};
+
+/**
+ * Break all cycles by the greedy heuristic of Eades, Lin and Smyth: sinks are repeatedly moved
+ * to the end of a node sequence, sources to its front and otherwise the node with the largest
+ * difference of out and in degree to the front. Arcs pointing backwards are reversed. This
+ * takes linear time and reverses at most m/2 - n/6 of m arcs.
+ * @return number of reversed arcs
+ */
+int breakCycles(int count, QVector<Arc> &arcs)
+{
+    const Adjacency out(count, arcs, false);
+    const Adjacency in(count, arcs, true);
+    QVector<int> outDegree(count);
+    QVector<int> inDegree(count);
+    int maximumDegree = 0;
+    for (int node = 0; node < count; ++node) {
+        outDegree[node] = out.offsets.at(node + 1) - out.offsets.at(node);
+        inDegree[node] = in.offsets.at(node + 1) - in.offsets.at(node);
+        maximumDegree = qMax(maximumDegree, qMax(outDegree.at(node), inDegree.at(node)));
+    }
+    DegreeBuckets buckets(count, maximumDegree);
+    for (int node = count - 1; node >= 0; --node) {
+        buckets.insert(node, buckets.bucket(outDegree.at(node), inDegree.at(node)));
+    }
+
+    QVector<int> rank(count, -1);
+    int front = 0;
+    int back = count - 1;
+    for (int placed = 0; placed < count; ++placed) {
+        int node = buckets.first(DegreeBuckets::Sinks);
+        if (node >= 0) {
+            rank[node] = back--;
+        } else {
+            node = buckets.first(DegreeBuckets::Sources);
+            if (node < 0) {
+                node = buckets.largest();
+            }
+            rank[node] = front++;
+        }
+        buckets.remove(node);
+        for (int e = out.offsets.at(node); e < out.offsets.at(node + 1); ++e) {
+            const int target = out.targets.at(e);
+            if (rank.at(target) < 0) {
+                --inDegree[target];
+                buckets.move(target, buckets.bucket(outDegree.at(target), inDegree.at(target)));
+            }
+        }
+        for (int e = in.offsets.at(node); e < in.offsets.at(node + 1); ++e) {
+            const int source = in.targets.at(e);
+            if (rank.at(source) < 0) {
+                --outDegree[source];
+                buckets.move(source, buckets.bucket(outDegree.at(source), inDegree.at(source)));
+            }
+        }
+    }
+
+    int reversed = 0;
+    for (int id = 0; id < arcs.size(); ++id) {
+        if (rank.at(arcs.at(id).first) > rank.at(arcs.at(id).second)) {
+            arcs[id] = qMakePair(arcs.at(id).second, arcs.at(id).first);
+            ++reversed;
+        }
+    }
+    return reversed;
+}
+
+/**
+ * Longest path layering of an acyclic graph. Sources are moved down directly above their
+ * highest successor afterwards, which shortens their edges.
+ * @return layer of each node
+ */
+QVector<int> assignLayers(int count, const QVector<Arc> &arcs)
+{
+    const Adjacency out(count, arcs, false);
+    QVector<int> inDegree(count, 0);
+    foreach (const Arc &arc, arcs) {
+        ++inDegree[arc.second];
+    }
+    QVector<int> order;
+    order.reserve(count);
+    for (int node = 0; node < count; ++node) {
+        if (inDegree.at(node) == 0) {
+            order.append(node);
+        }
+    }
+    QVector<int> layers(count, 0);
+    for (int i = 0; i < order.size(); ++i) {
+        const int node = order.at(i);
+        for (int e = out.offsets.at(node); e < out.offsets.at(node + 1); ++e) {
+            const int target = out.targets.at(e);
+            layers[target] = qMax(layers.at(target), layers.at(node) + 1);
+            if (--inDegree[target] == 0) {
+                order.append(target);
+            }
+        }
+    }
+    QVector<bool> source(count, true);
+    foreach (const Arc &arc, arcs) {
+        source[arc.second] = false;
+    }
+    for (int node = 0; node < count; ++node) {
+        if (!source.at(node) || out.offsets.at(node) == out.offsets.at(node + 1)) {
+            continue;
+        }
+        int layer = std::numeric_limits<int>::max();
+        for (int e = out.offsets.at(node); e < out.offsets.at(node + 1); ++e) {
+            layer = qMin(layer, layers.at(out.targets.at(e)) - 1);
+        }
+        layers[node] = layer;
+    }
+    return layers;
+}
+
+/**
+ * Layered graph where every arc connects consecutive layers, long arcs are split by dummy nodes.
+ */
+struct LayeredGraph
+{
+    LayeredGraph(const QVector<Arc> &arcs, const QVector<int> &nodeLayers)
+        : layerOf(nodeLayers)
+    {
+        QVector<Arc> segments;
+        foreach (const Arc &arc, arcs) {
+            int from = arc.first;
+            for (int layer = layerOf.at(arc.first) + 1; layer < layerOf.at(arc.second); ++layer) {
+                const int dummy = layerOf.size();
+                layerOf.append(layer);
+                segments.append(qMakePair(from, dummy));
+                from = dummy;
+            }
+            segments.append(qMakePair(from, arc.second));
+        }
+        const int size = layerOf.size();
+        int layerCount = 0;
+        foreach (int layer, layerOf) {
+            layerCount = qMax(layerCount, layer + 1);
+        }
+        layers.resize(layerCount);
+        for (int node = 0; node < size; ++node) {
+            layers[layerOf.at(node)].append(node);
+        }
+        position.resize(size);
+        for (int layer = 0; layer < layerCount; ++layer) {
+            updatePositions(layer);
+        }
+        const Adjacency down(size, segments, false);
+        const Adjacency up(size, segments, true);
+        downOffsets = down.offsets;
+        downTargets = down.targets;
+        upOffsets = up.offsets;
+        upTargets = up.targets;
+    }
+
+    void updatePositions(int layer)
+    {
+        const QVector<int> &nodes = layers.at(layer);
+        for (int i = 0; i < nodes.size(); ++i) {
+            position[nodes.at(i)] = i;
+        }
+    }
+
+    /**
+     * Reorder @p layer by the barycenters of the neighbors in the layer above (@p fromAbove) or
+     * below. Nodes without such neighbors keep their position.
+     */
+    void sortByBarycenter(int layer, bool fromAbove)
+    {
+        const QVector<int> &offsets = fromAbove ? upOffsets : downOffsets;
+        const QVector<int> &targets = fromAbove ? upTargets : downTargets;
+        QVector<int> &nodes = layers[layer];
+        QVector<QPair<qreal, int>> keys(nodes.size());
+        for (int i = 0; i < nodes.size(); ++i) {
+            const int node = nodes.at(i);
+            qreal key = i;
+            const int degree = offsets.at(node + 1) - offsets.at(node);
+            if (degree > 0) {
+                qreal sum = 0;
+                for (int e = offsets.at(node); e < offsets.at(node + 1); ++e) {
+                    sum += position.at(targets.at(e));
+                }
+                // scale to positions of this layer
+                const int neighbors = layers.at(fromAbove ? layer - 1 : layer + 1).size();
+                key = sum / degree * nodes.size() / qMax(neighbors, 1);
+            }
+            keys[i] = qMakePair(key, node);
+        }
+        std::stable_sort(keys.begin(), keys.end(), [] (const QPair<qreal, int> &a, const QPair<qreal, int> &b) {
+            return a.first < b.first;
+        });
+        for (int i = 0; i < nodes.size(); ++i) {
+            nodes[i] = keys.at(i).second;
+        }
+        updatePositions(layer);
+    }
+
+    /**
+     * Count crossings between @p layer and the layer below with an accumulator tree
+     * (Barth, Juenger, Mutzel 2002).
+     */
+    qint64 crossings(int layer) const
+    {
+        const QVector<int> &upper = layers.at(layer);
+        const int lowerSize = layers.at(layer + 1).size();
+        QVector<int> sequence;
+        QVector<int> ends;
+        foreach (int node, upper) {
+            ends.resize(0);
+            for (int e = downOffsets.at(node); e < downOffsets.at(node + 1); ++e) {
+                ends.append(position.at(downTargets.at(e)));
+            }
+            std::sort(ends.begin(), ends.end());
+            sequence += ends;
+        }
+        int leaves = 1;
+        while (leaves < lowerSize) {
+            leaves *= 2;
+        }
+        QVector<int> tree(2 * leaves - 1, 0);
+        qint64 count = 0;
+        foreach (int end, sequence) {
+            int index = end + leaves - 1;
+            ++tree[index];
+            while (index > 0) {
+                if (index % 2 == 1) {
+                    count += tree.at(index + 1);
+                }
+                index = (index - 1) / 2;
+                ++tree[index];
+            }
+        }
+        return count;
+    }
+
+    qint64 crossings() const
+    {
+        qint64 count = 0;
+        for (int layer = 0; layer + 1 < layers.size(); ++layer) {
+            count += crossings(layer);
+        }
+        return count;
+    }
+
+    QVector<int> layerOf;
+    QVector<QVector<int>> layers;
+    QVector<int> position;
+    QVector<int> downOffsets;
+    QVector<int> downTargets;
+    QVector<int> upOffsets;
+    QVector<int> upTargets;
+};
+
+/**
+ * Minimize crossings by alternating down and up barycenter sweeps.
+ * Sweeping stops early as soon as @p canceled returns @e true.
+ * @return number of crossings of the best order found, which is applied to @p graph
+ */
+qint64 minimizeCrossings(LayeredGraph &graph, int sweeps, const std::function<bool()> &canceled)
+{
+    qint64 best = graph.crossings();
+    QVector<QVector<int>> bestLayers = graph.layers;
+    for (int sweep = 0; sweep < sweeps && best > 0 && !canceled(); ++sweep) {
+        for (int layer = 1; layer < graph.layers.size(); ++layer) {
+            graph.sortByBarycenter(layer, true);
+        }
+        for (int layer = graph.layers.size() - 2; layer >= 0; --layer) {
+            graph.sortByBarycenter(layer, false);
+        }
+        const qint64 count = graph.crossings();
+        if (count < best) {
+            best = count;
+            bestLayers = graph.layers;
+        }
+    }
+    graph.layers = bestLayers;
+    for (int layer = 0; layer < graph.layers.size(); ++layer) {
+        graph.updatePositions(layer);
+    }
+    return best;
+}
+
+/**
+ * Place the nodes of one layer as close as possible to @p desired in least squares sense, in
+ * their order and with at least @p distance between consecutive nodes. Substituting
+ * x_i - i * distance turns this into an isotonic regression, solved by pool adjacent violators.
+ */
+void placeLayer(const QVector<qreal> &desired, qreal distance, QVector<qreal> &result)
+{
+    const int size = desired.size();
+    QVector<qreal> blockSums;
+    QVector<int> blockSizes;
+    for (int i = 0; i < size; ++i) {
+        blockSums.append(desired.at(i) - i * distance);
+        blockSizes.append(1);
+        while (blockSums.size() > 1) {
+            const int last = blockSums.size() - 1;
+            if (blockSums.at(last - 1) / blockSizes.at(last - 1) <= blockSums.at(last) / blockSizes.at(last)) {
+                break;
+            }
+            blockSums[last - 1] += blockSums.at(last);
+            blockSizes[last - 1] += blockSizes.at(last);
+            blockSums.removeLast();
+            blockSizes.removeLast();
+        }
+    }
+    result.resize(size);
+    int i = 0;
+    for (int block = 0; block < blockSums.size(); ++block) {
+        const qreal value = blockSums.at(block) / blockSizes.at(block);
+        for (int j = 0; j < blockSizes.at(block); ++j, ++i) {
+            result[i] = value + i * distance;
+        }
+    }
+}
+
+/**
+ * Assign horizontal coordinates that pull nodes towards the mean of their neighbors.
+ * @return coordinate of each node of @p graph
+ */
+QVector<qreal> assignCoordinates(const LayeredGraph &graph, qreal distance)
+{
+    QVector<qreal> x(graph.layerOf.size());
+    for (int node = 0; node < x.size(); ++node) {
+        x[node] = graph.position.at(node) * distance;
+    }
+    QVector<qreal> desired;
+    QVector<qreal> placed;
+    // rounds of down, up and both sided alignment
+    for (int round = 0; round < 6; ++round) {
+        const bool useUp = round % 3 != 1;
+        const bool useDown = round % 3 != 0;
+        const bool downwards = round % 3 != 1;
+        for (int i = 0; i < graph.layers.size(); ++i) {
+            const int layer = downwards ? i : graph.layers.size() - 1 - i;
+            const QVector<int> &nodes = graph.layers.at(layer);
+            desired.resize(nodes.size());
+            for (int j = 0; j < nodes.size(); ++j) {
+                const int node = nodes.at(j);
+                qreal sum = 0;
+                int degree = 0;
+                if (useUp) {
+                    for (int e = graph.upOffsets.at(node); e < graph.upOffsets.at(node + 1); ++e) {
+                        sum += x.at(graph.upTargets.at(e));
+                        ++degree;
+                    }
+                }
+                if (useDown) {
+                    for (int e = graph.downOffsets.at(node); e < graph.downOffsets.at(node + 1); ++e) {
+                        sum += x.at(graph.downTargets.at(e));
+                        ++degree;
+                    }
+                }
+                desired[j] = degree > 0 ? sum / degree : x.at(node);
+            }
+            placeLayer(desired, distance, placed);
+            for (int j = 0; j < nodes.size(); ++j) {
+                x[nodes.at(j)] = placed.at(j);
+            }
+        }
+    }
+    return x;
+}
+
+/**
+ * Arcs between @p nodes in terms of their indices, self loops are skipped.
+ */
+QVector<Arc> collectArcs(const NodeList &nodes, bool *directed = 0)
+{
+    QHash<const Node*, int> indices;
+    indices.reserve(nodes.size());
+    for (int i = 0; i < nodes.size(); ++i) {
+        indices.insert(nodes.at(i).data(), i);
+    }
+    QVector<Arc> arcs;
+    if (directed) {
+        *directed = true;
+    }
+    foreach (const EdgePtr &edge, nodes.first()->document()->edges()) {
+        const int from = indices.value(edge->from().data(), -1);
+        const int to = indices.value(edge->to().data(), -1);
+        if (from < 0 || to < 0 || from == to) {
+            continue;
+        }
+        if (directed && edge->type()->direction() == EdgeType::Bidirectional) {
+            *directed = false;
+        }
+        arcs.append(qMakePair(from, to));
+    }
+    return arcs;
+}
+}
+
+class GraphTheory::LayeredLayoutPrivate
+{
+public:
+    LayeredLayoutPrivate()
+        : layerDistance(100)
+        , nodeDistance(100)
+        , sweeps(8)
+        , reversedEdges(0)
+        , crossings(0)
+    {
+    }
+
+    qreal layerDistance;
+    qreal nodeDistance;
+    int sweeps;
+    std::function<bool()> cancelCondition;
+    int reversedEdges;
+    qint64 crossings;
+};
+
+LayeredLayout::LayeredLayout()
+    : d(new LayeredLayoutPrivate)
+{
+}
+
+LayeredLayout::~LayeredLayout()
+{
+}
+
+qreal LayeredLayout::layerDistance() const
+{
+    return d->layerDistance;
+}
+
+void LayeredLayout::setLayerDistance(qreal distance)
+{
+    d->layerDistance = distance;
+}
+
+qreal LayeredLayout::nodeDistance() const
+{
+    return d->nodeDistance;
+}
+
+void LayeredLayout::setNodeDistance(qreal distance)
+{
+    d->nodeDistance = distance;
+}
+
+int LayeredLayout::sweeps() const
+{
+    return d->sweeps;
+}
+
+void LayeredLayout::setSweeps(int sweeps)
+{
+    d->sweeps = sweeps;
+}
+
+void LayeredLayout::setCancelCondition(const std::function<bool()> &condition)
+{
+    d->cancelCondition = condition;
+}
+
+void LayeredLayout::apply(const NodeList &nodes)
+{
+    d->reversedEdges = 0;
+    d->crossings = 0;
+    if (nodes.isEmpty()) {
+        return;
+    }
+    const std::function<bool()> condition = d->cancelCondition;
+    const auto canceled = [condition]() { return condition && condition(); };
+    const int count = nodes.size();
+    QVector<Arc> arcs = collectArcs(nodes);
+    d->reversedEdges = breakCycles(count, arcs);
+    // parallel arcs share their dummy nodes
+    std::sort(arcs.begin(), arcs.end());
+    arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+    if (canceled()) {
+        return;
+    }
+
+    LayeredGraph graph(arcs, assignLayers(count, arcs));
+    d->crossings = minimizeCrossings(graph, d->sweeps, canceled);
+    if (canceled()) {
+        return;
+    }
+    const QVector<qreal> x = assignCoordinates(graph, d->nodeDistance);
+
+    // keep the layout at the center of the present positions
+    QPointF center;
+    qreal left = std::numeric_limits<qreal>::max();
+    qreal right = -std::numeric_limits<qreal>::max();
+    for (int node = 0; node < count; ++node) {
+        center += nodes.at(node)->position();
+        left = qMin(left, x.at(node));
+        right = qMax(right, x.at(node));
+    }
+    center /= count;
+    const QPointF offset = center - QPointF((left + right) / 2, (graph.layers.size() - 1) * d->layerDistance / 2);
+
+    BatchGuard batch(nodes.first()->document());
+    for (int node = 0; node < count; ++node) {
+        nodes.at(node)->setPosition(offset + QPointF(x.at(node), graph.layerOf.at(node) * d->layerDistance));
+    }
+}
+
+int LayeredLayout::reversedEdges() const
+{
+    return d->reversedEdges;
+}
+
+qint64 LayeredLayout::crossings() const
+{
+    return d->crossings;
+}
+
+bool LayeredLayout::isAcyclic(const NodeList &nodes)
+{
+    if (nodes.isEmpty()) {
+        return true;
+    }
+    bool directed;
+    QVector<Arc> arcs = collectArcs(nodes, &directed);
+    return directed && breakCycles(nodes.size(), arcs) == 0;
+}
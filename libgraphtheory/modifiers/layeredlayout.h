@@ -0,0 +1,112 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LAYEREDLAYOUT_H
+#define LAYEREDLAYOUT_H
+
+#include "typenames.h"
+#include "graphtheory_export.h"
+
+#include <QScopedPointer>
+
+#include <functional>
+
+namespace GraphTheory
+{
+
+class LayeredLayoutPrivate;
+
+/**
+ * \class LayeredLayout
+ * Sugiyama style layout that draws directed graphs top down in layers.
+ *
+ * The layout runs in four phases, each linear or near-linear in the size of the graph:
+ * - cycles are broken by reversing few edges, found by the greedy heuristic of Eades,
+ *   Lin and Smyth,
+ * - nodes are assigned to layers by their longest path from a source, sources are moved
+ *   down to their successors,
+ * - edges spanning several layers are split by dummy nodes and the order inside the layers
+ *   is improved by barycenter sweeps, keeping the order with the fewest crossings,
+ * - horizontal coordinates are placed close to the mean of the adjacent nodes while keeping
+ *   the order and nodeDistance() between the nodes of a layer.
+ *
+ * All edges between the given nodes are considered from their start to their end node,
+ * independently of their type.
+ */
+class GRAPHTHEORY_EXPORT LayeredLayout
+{
+public:
+    LayeredLayout();
+    ~LayeredLayout();
+
+    /**
+     * @return vertical distance between consecutive layers, default is 100
+     */
+    qreal layerDistance() const;
+    void setLayerDistance(qreal distance);
+
+    /**
+     * @return minimal horizontal distance between nodes of the same layer, default is 100
+     */
+    qreal nodeDistance() const;
+    void setNodeDistance(qreal distance);
+
+    /**
+     * @return number of down and up barycenter sweeps for crossing minimization, default is 8
+     */
+    int sweeps() const;
+    void setSweeps(int sweeps);
+
+    /**
+     * The layout evaluates @p condition between its phases and sweeps and stops without
+     * moving any node as soon as it returns @e true. Default is no condition.
+     */
+    void setCancelCondition(const std::function<bool()> &condition);
+
+    /**
+     * Compute the layout of @p nodes and apply it. The layout is centered at the center of the
+     * present positions. All nodes must belong to the same document.
+     */
+    void apply(const NodeList &nodes);
+
+    /**
+     * @return number of edges reversed to break cycles by the last layout
+     */
+    int reversedEdges() const;
+
+    /**
+     * @return number of edge crossings between consecutive layers of the last layout, edges
+     *         spanning several layers counted as chains of dummy nodes
+     */
+    qint64 crossings() const;
+
+    /**
+     * @return @e true if all edges between @p nodes are directed and form no cycle, otherwise
+     *         @e false
+     */
+    static bool isAcyclic(const NodeList &nodes);
+
+private:
+    Q_DISABLE_COPY(LayeredLayout)
+    const QScopedPointer<LayeredLayoutPrivate> d;
+};
+}
+
+#endif
@@ -19,6 +19,8 @@
  */
 
 #include "topology.h"
+#include "forcedirectedlayout.h"
+#include "layeredlayout.h"
 #include "graphdocument.h"
 #include "edge.h"
 #include "logging_p.h"
@@ -27,7 +29,6 @@
 #include <QPair>
 #include <QVector>
 
-#include <boost/graph/fruchterman_reingold.hpp>
 #include <boost/graph/circle_layout.hpp>
 #include <boost/graph/random_layout.hpp>
 #include <boost/graph/adjacency_list.hpp>
@@ -73,71 +74,31 @@ void Topology::applyMinCutTreeAlignment(NodeList nodes)
         return;
     }
 
-    PositionVec position_vec(nodes.count());
-
-    // set box inside which we may reposition
-    QList<qreal> xList;
-    QList<qreal> yList;
-    foreach(NodePtr node, nodes) {
-        xList << node->x();
-        yList << node->y();
-    }
-    qSort(xList.begin(), xList.end());
-    qSort(yList.begin(), yList.end());
+    // minimize cuts by Fruchterman-Reingold layout, views are informed once about all movements
+    ForceDirectedLayout layout;
+    layout.setCancelCondition(m_cancelCondition);
+    layout.apply(nodes);
+}
 
-    // do not perform algorithm if graph is very dense:
-    // this prevents very long algorithm computations and possible threading issues
-    if (xList.last() - xList.first() < 10 && yList.last() - yList.first() < 10 ) {
-        qCDebug(GRAPHTHEORY_GENERAL) << "Aborting min cut alignment: nodes are already close to each other.";
+void Topology::applyMultilevelAlignment(NodeList nodes)
+{
+    if (nodes.count() < 2) {
         return;
     }
+    ForceDirectedLayout layout;
+    layout.setMultilevel(true);
+    layout.setCancelCondition(m_cancelCondition);
+    layout.apply(nodes);
+}
 
-    topology_type topology(xList.first(), yList.first(), xList.last(), yList.last());
-
-    // create IDs for all nodes
-    QMap<NodePtr, int> node_mapping;
-    QMap<QPair<int, int>, EdgePtr > edge_mapping; // to map all edges back afterwards
-    int counter = 0;
-    foreach(NodePtr node, nodes) {
-        node_mapping[node] = counter++;
-    }
-
-    QVector<BoostEdge> edges(nodes.first()->document()->edges().count());
-
-    counter = 0;
-    foreach(EdgePtr edge, nodes.first()->document()->edges()) {
-        edges[counter++] = BoostEdge(node_mapping[edge->from()], node_mapping[edge->to()]);
-    }
-
-    // setup the graph
-    Graph graph(
-        edges.begin(),
-        edges.end(),
-        nodes.count()
-    );
-
-    PositionMap positionMap(position_vec.begin(), get(boost::vertex_index, graph));
-    counter = 0;
-    foreach(NodePtr node, nodes) {
-        positionMap[counter][0] = node->x();
-        positionMap[counter][1] = node->y();
-        counter++;
-    }
-
-    // minimize cuts by Fruchtman-Reingold layout algorithm
-    boost::fruchterman_reingold_force_directed_layout< topology_type, Graph, PositionMap >
-    (graph,
-     positionMap,
-     topology,
-     boost::cooling(boost::linear_cooling<double>(100))
-    );
-
-    // put nodes at whiteboard as generated
-    foreach(NodePtr node, nodes) {
-        Vertex v = boost::vertex(node_mapping[node], graph);
-        node->setX(positionMap[v][0]);
-        node->setY(positionMap[v][1]);
+void Topology::applyLayeredAlignment(NodeList nodes)
+{
+    if (nodes.isEmpty()) {
+        return;
     }
+    LayeredLayout layout;
+    layout.setCancelCondition(m_cancelCondition);
+    layout.apply(nodes);
 }
 
 void Topology::applyCircleAlignment(NodeList nodes, qreal radius)
@@ -197,28 +158,33 @@ void Topology::applyCircleAlignment(NodeList nodes, qreal radius)
                                                     positionMap,
                                                     radius);
 
-    // put nodes at whiteboard as generated
+    // put nodes at whiteboard as generated, views are informed once about all movements
+    BatchGuard batch(nodes.first()->document());
     foreach(NodePtr node, nodes) {
         Vertex v = boost::vertex(node_mapping[node], graph);
-        node->setX(positionMap[v][0]);
-        node->setY(positionMap[v][1]);
+        node->setPosition(QPointF(positionMap[v][0], positionMap[v][1]));
     }
 }
 
 
 void Topology::directedGraphDefaultTopology(GraphDocumentPtr document)
 {
-    //TODO: port to graphviz layout functions
-    qCDebug(GRAPHTHEORY_GENERAL) << "Temporary implementation, should be replaced soon.";
-    applyCircleAlignment(document->nodes(), 300);
-    applyMinCutTreeAlignment(document->nodes());
+    // layers only help to read graphs where all edges can point downwards
+    const NodeList nodes = document->nodes();
+    if (!document->edges().isEmpty() && LayeredLayout::isAcyclic(nodes)) {
+        applyLayeredAlignment(nodes);
+    } else {
+        applyMultilevelAlignment(nodes);
+    }
 }
 
 
 void Topology::undirectedGraphDefaultTopology(GraphDocumentPtr document)
 {
-    //TODO: port to graphviz layout functions
-    qCDebug(GRAPHTHEORY_GENERAL) << "Temporary implementation, should be replaced soon.";
-    applyCircleAlignment(document->nodes(), 300);
-    applyMinCutTreeAlignment(document->nodes());
+    applyMultilevelAlignment(document->nodes());
+}
+
+void Topology::setCancelCondition(const std::function<bool()> &condition)
+{
+    m_cancelCondition = condition;
 }
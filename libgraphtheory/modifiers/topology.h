@@ -24,6 +24,8 @@
 #include "typenames.h"
 #include "graphtheory_export.h"
 
+#include <functional>
+
 #define BOOST_MATH_DISABLE_FLOAT128 1
 
 namespace GraphTheory
@@ -43,16 +45,37 @@ public:
 
     /** \brief applies Fruchterman-Reingold cut minimization
      *
-     * For the given node set this algorithm applies the Boost implementation
-     * of the Frutherman-Reingold force directed layout algorithm to minimize
-     * crossing edges. Data must be element of the same graph. The
-     * crossings of all present edges contained in this graph are
-     * minimized. This method directly modifies the node.
+     * For the given node set this algorithm applies the Frutherman-Reingold force
+     * directed layout algorithm of ForceDirectedLayout to minimize crossing edges.
+     * Data must be element of the same graph. The crossings of all present edges
+     * between the given nodes are minimized. This method directly modifies the node.
      * \param nodeList is the list of all nodes
      * \return void
      */
     void applyMinCutTreeAlignment(NodeList nodes);
 
+    /** \brief applies multilevel force directed layout
+     *
+     * For the given node set the graph is coarsened level by level, the coarsest graph is
+     * laid out by the Frutherman-Reingold algorithm of ForceDirectedLayout and the layout is
+     * refined on each finer level. Present coordinates are not respected, the layout is placed
+     * at their center. Data must be element of the same graph. This layout is suitable for
+     * very large graphs.
+     * \param nodeList is the list of all nodes
+     * \return void
+     */
+    void applyMultilevelAlignment(NodeList nodes);
+
+    /** \brief applies layered topology to node set
+     *
+     * For the given node set the Sugiyama style layout of LayeredLayout is applied, which
+     * draws directed edges from top to bottom and minimizes their crossings. Cycles are broken
+     * by reversing few edges. Data must be element of the same graph.
+     * \param nodeList is the list of all nodes
+     * \return void
+     */
+    void applyLayeredAlignment(NodeList nodes);
+
     /** \brief applies Circle topology to node set
      *
      * For the given node set this algorithm applies the Boost implementation
@@ -65,10 +88,11 @@ public:
      */
     void applyCircleAlignment(NodeList nodes, qreal radius=0);
 
-    /** \brief applies a default topology for undirected graphs
+    /** \brief applies a default topology for directed graphs
      *
-     * Use this method to apply a best-fit topology to an undirected graph (though the
-     * graph need not to be of type "Graph") only based on the node connections.
+     * Use this method to apply a best-fit topology to a directed graph only based on the
+     * node connections. Directed acyclic graphs are drawn in layers, all other graphs by
+     * the multilevel force directed layout.
      * I.e., no possible present coordinates are respected.
      */
     void directedGraphDefaultTopology(GraphDocumentPtr document);
@@ -80,6 +104,17 @@ public:
      * I.e., no possible present coordinates are respected.
      */
     void undirectedGraphDefaultTopology(GraphDocumentPtr document);
+
+    /** \brief sets a condition to stop alignments early
+     *
+     * The force directed and layered alignments evaluate \p condition regularly and stop
+     * without moving any node as soon as it returns true, e.g. when the import of a file is
+     * canceled. By default alignments always finish.
+     */
+    void setCancelCondition(const std::function<bool()> &condition);
+
+private:
+    std::function<bool()> m_cancelCondition;
 };
 }
 
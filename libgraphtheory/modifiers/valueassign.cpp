@@ -21,17 +21,186 @@
 #include "valueassign.h"
 #include "node.h"
 #include "edge.h"
-#include <limits.h>
+#include "nodetype.h"
+#include "edgetype.h"
+#include "propertytable.h"
+#include <QHash>
 #include <QString>
-#include <QVariant>
 #include <QVector>
-#include <boost/random/mersenne_twister.hpp>
-#include <boost/random/uniform_int.hpp>
-#include <boost/random/uniform_real.hpp>
-#include <boost/random/variate_generator.hpp>
+#include <QtConcurrent>
 
 using namespace GraphTheory;
 
+namespace
+{
+const int BlockSize = 1 << 16;
+
+/**
+ * Counter-based random numbers following the Philox4x32-10 generator of Salmon et al. The
+ * number for @p counter only depends on the seed and the counter, so numbers can be generated
+ * in parallel and in any order with the same result for any number of threads.
+ */
+class Philox
+{
+public:
+    explicit Philox(quint64 seed)
+        : m_key0(quint32(seed))
+        , m_key1(quint32(seed >> 32))
+    {
+    }
+
+    quint64 operator()(quint64 counter) const
+    {
+        quint32 c0 = quint32(counter);
+        quint32 c1 = quint32(counter >> 32);
+        quint32 c2 = 0;
+        quint32 c3 = 0;
+        quint32 k0 = m_key0;
+        quint32 k1 = m_key1;
+        for (int round = 0; round < 10; ++round) {
+            const quint64 p0 = Q_UINT64_C(0xD2511F53) * c0;
+            const quint64 p1 = Q_UINT64_C(0xCD9E8D57) * c2;
+            c0 = quint32(p1 >> 32) ^ c1 ^ k0;
+            c1 = quint32(p1);
+            c2 = quint32(p0 >> 32) ^ c3 ^ k1;
+            c3 = quint32(p0);
+            k0 += 0x9E3779B9;
+            k1 += 0xBB67AE85;
+        }
+        return (quint64(c0) << 32) | c1;
+    }
+
+    /**
+     * @return number uniformly distributed in [0,1) for @p counter
+     */
+    qreal uniform(quint64 counter) const
+    {
+        return ((*this)(counter) >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    /**
+     * @return integer uniformly distributed in [lowerLimit,upperLimit] for @p counter
+     */
+    int uniform(quint64 counter, int lowerLimit, int upperLimit) const
+    {
+        const quint64 range = quint64(qint64(upperLimit) - lowerLimit) + 1;
+        return int(lowerLimit + qint64((((*this)(counter) >> 32) * range) >> 32));
+    }
+
+private:
+    const quint32 m_key0;
+    const quint32 m_key1;
+};
+
+/**
+ * Call @p function for all indices in [0,count), in parallel for large counts.
+ */
+template<typename Function>
+void forBlocks(int count, Function function)
+{
+    if (count <= BlockSize) {
+        for (int i = 0; i < count; ++i) {
+            function(i);
+        }
+        return;
+    }
+    QVector<int> blocks;
+    for (int first = 0; first < count; first += BlockSize) {
+        blocks.append(first);
+    }
+    QtConcurrent::blockingMap(blocks, [count, &function] (const int &first) {
+        const int last = qMin(count, first + BlockSize);
+        for (int i = first; i < last; ++i) {
+            function(i);
+        }
+    });
+}
+
+/**
+ * Bulk assignment of one property to a list of nodes or edges. The elements are grouped by
+ * type, values are written to the property tables of the types column by column and each type
+ * announces the changed values once.
+ */
+template<typename T>
+class Assignment
+{
+public:
+    typedef decltype(T()->type()) TypePtr;
+
+    Assignment(const QVector<T> &list, const QString &property, bool overrideValues)
+        : m_count(0)
+    {
+        if (property.isEmpty()) {
+            return;
+        }
+        QHash<PropertyTable *, int> groups;
+        PropertyTable *table = nullptr;
+        int current = -1;
+        for (int i = 0; i < list.size(); ++i) {
+            const TypePtr type = list.at(i)->type();
+            if (type->propertyTable() != table) {
+                table = type->propertyTable();
+                current = groups.value(table, -1);
+                if (current < 0) {
+                    current = m_groups.size();
+                    groups.insert(table, current);
+                    Group group;
+                    group.type = type;
+                    group.column = table->addColumn(property);
+                    m_groups.append(group);
+                }
+            }
+            Group &group = m_groups[current];
+            const int row = list.at(i)->propertyRow();
+            if (!overrideValues && table->hasValue(group.column, row)) {
+                continue;
+            }
+            group.rows.append(row);
+            group.indices.append(m_count++);
+        }
+    }
+
+    /**
+     * @return number of elements that get a value assigned
+     */
+    int count() const
+    {
+        return m_count;
+    }
+
+    /**
+     * Assign @p value(index) to all elements, where index enumerates the elements that get
+     * a value assigned in list order.
+     */
+    template<typename Value, typename Function>
+    void assign(Function value)
+    {
+        foreach (const Group &group, m_groups) {
+            QVector<Value> values(group.rows.size());
+            Value *data = values.data();
+            const int *indices = group.indices.constData();
+            forBlocks(values.size(), [data, indices, &value] (int i) {
+                data[i] = value(indices[i]);
+            });
+            PropertyTable *table = group.type->propertyTable();
+            table->setValues(group.column, group.rows, values);
+            group.type->notifyDynamicPropertyValuesChanged(table->key(group.column));
+        }
+    }
+
+private:
+    struct Group
+    {
+        TypePtr type;
+        int column;
+        QVector<int> rows;
+        QVector<int> indices;
+    };
+    QVector<Group> m_groups;
+    int m_count;
+};
+}
+
 ValueAssign::ValueAssign()
 {
 }
@@ -40,11 +209,15 @@ ValueAssign::ValueAssign()
 template<typename T>
 void ValueAssign::enumerate(const QVector<T> &list, const QString &property, int start, const QString &baseString, bool overrideValues)
 {
-    for (int i = 0; i < list.size(); i++) {
-        if (!overrideValues && !list[i]->dynamicProperty(property).isNull()) {
-            return;
-        }
-        list[i]->setDynamicProperty(property, baseString + QString::number(start++));
+    Assignment<T> assignment(list, property, overrideValues);
+    if (baseString.isEmpty()) {
+        assignment.template assign<int>([start] (int index) {
+            return start + index;
+        });
+    } else {
+        assignment.template assign<QString>([start, &baseString] (int index) {
+            return baseString + QString::number(start + index);
+        });
     }
 }
 template GRAPHTHEORY_EXPORT void ValueAssign::enumerate<NodePtr>(const QVector<NodePtr> &list, const QString &property, int start, const QString &baseString, bool overrideValues);
@@ -54,6 +227,8 @@ template GRAPHTHEORY_EXPORT void ValueAssign::enumerate<EdgePtr>(const QVector<E
 template<typename T>
 void ValueAssign::enumerateAlpha(const QVector< T >& list, const QString &property, const QString &start, bool overrideValues)
 {
+    Assignment<T> assignment(list, property, overrideValues);
+
     QString identifier = start;
     for (int i = start.length()-1; i >= 0; --i) {
         // ensure that we only have letters
@@ -62,11 +237,9 @@ void ValueAssign::enumerateAlpha(const QVector< T >& list, const QString &proper
         }
     }
 
-    for (int i = 0; i < list.size(); i++) {
-        if (!overrideValues && !list[i]->dynamicProperty(property).isNull()) {
-            return;
-        }
-        list[i]->setDynamicProperty(property, identifier);
+    QVector<QString> identifiers(assignment.count());
+    for (int i = 0; i < identifiers.size(); i++) {
+        identifiers[i] = identifier;
 
         // compute new identifier by lexicographical increasing
         for (int i = identifier.length()-1; i >= 0; --i) {
@@ -82,6 +255,9 @@ void ValueAssign::enumerateAlpha(const QVector< T >& list, const QString &proper
             }
         }
     }
+    assignment.template assign<QString>([&identifiers] (int index) {
+        return identifiers.at(index);
+    });
 }
 template GRAPHTHEORY_EXPORT void ValueAssign::enumerateAlpha<NodePtr>(const QVector<NodePtr> &list, const QString &property, const QString &start, bool overrideValues);
 template GRAPHTHEORY_EXPORT void ValueAssign::enumerateAlpha<EdgePtr>(const QVector<EdgePtr> &list, const QString &property, const QString &start, bool overrideValues);
@@ -94,18 +270,11 @@ void ValueAssign::assignRandomIntegers(const QVector<T> &list, const QString &pr
         return;
     }
 
-    boost::mt19937 gen;
-    gen.seed(static_cast<unsigned int>(seed));
-
-    boost::uniform_int<> distribution(lowerLimit, upperLimit);
-    boost::variate_generator<boost::mt19937&, boost::uniform_int<> > die(gen, distribution);
-
-    for (int i = 0; i < list.size(); i++) {
-        if (!overrideValues && !list[i]->dynamicProperty(property).isNull()) {
-            return;
-        }
-        list[i]->setDynamicProperty(property, QString::number(die()));
-    }
+    const Philox random(static_cast<quint32>(seed));
+    Assignment<T> assignment(list, property, overrideValues);
+    assignment.template assign<int>([&random, lowerLimit, upperLimit] (int index) {
+        return random.uniform(index, lowerLimit, upperLimit);
+    });
 }
 template GRAPHTHEORY_EXPORT void ValueAssign::assignRandomIntegers<NodePtr>(const QVector<NodePtr> &list, const QString &property, int lowerLimit, int upperLimit, int seed, bool overrideValues);
 template GRAPHTHEORY_EXPORT void ValueAssign::assignRandomIntegers<EdgePtr>(const QVector<EdgePtr> &list, const QString &property, int lowerLimit, int upperLimit, int seed, bool overrideValues);
@@ -118,18 +287,11 @@ void ValueAssign::assignRandomReals(const QVector<T> &list, const QString &prope
         return;
     }
 
-    boost::mt19937 gen;
-    gen.seed(static_cast<unsigned int>(seed));
-
-    boost::uniform_real<> distribution(lowerLimit, upperLimit);
-    boost::variate_generator<boost::mt19937&, boost::uniform_real<> > die(gen, distribution);
-
-    for (int i = 0; i < list.size(); i++) {
-        if (!overrideValues && !list[i]->dynamicProperty(property).isNull()) {
-            return;
-        }
-        list[i]->setDynamicProperty(property, QString::number(die()));
-    }
+    const Philox random(static_cast<quint32>(seed));
+    Assignment<T> assignment(list, property, overrideValues);
+    assignment.template assign<qreal>([&random, lowerLimit, upperLimit] (int index) {
+        return lowerLimit + random.uniform(index) * (upperLimit - lowerLimit);
+    });
 }
 template GRAPHTHEORY_EXPORT void ValueAssign::assignRandomReals<NodePtr>(const QVector<NodePtr> &list, const QString &property, qreal lowerLimit, qreal upperLimit, int seed, bool overrideValues);
 template GRAPHTHEORY_EXPORT void ValueAssign::assignRandomReals<EdgePtr>(const QVector<EdgePtr> &list, const QString &property, qreal lowerLimit, qreal upperLimit, int seed, bool overrideValues);
@@ -137,12 +299,10 @@ template GRAPHTHEORY_EXPORT void ValueAssign::assignRandomReals<EdgePtr>(const Q
 template<typename T>
 void ValueAssign::assignConstantValue(const QVector<T> &list, const QString &property, const QString &constant, bool overrideValues)
 {
-    for (int i = 0; i < list.size(); i++) {
-        if (!overrideValues && !list[i]->dynamicProperty(property).isNull()) {
-            return;
-        }
-        list[i]->setDynamicProperty(property, constant);
-    }
+    Assignment<T> assignment(list, property, overrideValues);
+    assignment.template assign<QString>([&constant] (int) {
+        return constant;
+    });
 }
 template GRAPHTHEORY_EXPORT void ValueAssign::assignConstantValue<NodePtr>(const QVector<NodePtr> &list, const QString &property, const QString &constant, bool overrideValues);
 template GRAPHTHEORY_EXPORT void ValueAssign::assignConstantValue<EdgePtr>(const QVector<EdgePtr> &list, const QString &property, const QString &constant, bool overrideValues);
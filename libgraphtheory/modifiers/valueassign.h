@@ -28,6 +28,11 @@ namespace GraphTheory
 {
 
 /** \brief this class provides value assigner
+ *
+ * Values are written to the property tables of the node and edge types in one pass per type.
+ * Instead of a signal for each element, each type emits NodeType::dynamicPropertyValuesChanged()
+ * or EdgeType::dynamicPropertyValuesChanged() once. Elements whose value is kept because
+ * overriding is disabled are skipped.
  */
 class GRAPHTHEORY_EXPORT ValueAssign
 {
@@ -35,7 +40,8 @@ class GRAPHTHEORY_EXPORT ValueAssign
 public:
     ValueAssign();
     /**
-     * Assign integers in increasing order starting at 'start' to all nodes.
+     * Assign integers in increasing order starting at 'start' to all nodes. The values are
+     * integers if 'baseString' is empty, otherwise strings.
      *
      * \param list QVector of EdgePtr or NodePtr
      * \param property the property the shall be set to specified value
@@ -58,9 +64,9 @@ public:
     void enumerateAlpha(const QVector<T> &list, const QString &property, const QString &start, bool overrideValues = true);
 
     /**
-     * Assign integers uniformly at random from range [lowerLimit,upperLimit] to data elements. Using Mersenne-Twister
-     * random number generator, initialized by 'seed'. If not lowerLimit < upperLimit the function returns without
-     * any operation.
+     * Assign integers uniformly at random from range [lowerLimit,upperLimit] to data elements. Using a counter-based
+     * Philox random number generator, initialized by 'seed', the values are generated in parallel and do not depend
+     * on the number of threads. If not lowerLimit < upperLimit the function returns without any operation.
      *
      * \param list QVector of EdgePtr or NodePtr
      * \param property the property the shall be set to specified value
@@ -72,9 +78,9 @@ public:
     void assignRandomIntegers(const QVector<T> &list, const QString &property, int lowerLimit, int upperLimit, int seed, bool overrideValues = true);
 
     /**
-     * Assign float values uniformly at random from range [lowerLimit,upperLimit] to nodes. Using Mersenne-Twister
-     * random number generator, initialized by 'seed'. If not lowerLimit < upperLimit the function returns without
-     * any operation.
+     * Assign float values uniformly at random from range [lowerLimit,upperLimit] to nodes. Using a counter-based
+     * Philox random number generator, initialized by 'seed', the values are generated in parallel and do not depend
+     * on the number of threads. If not lowerLimit < upperLimit the function returns without any operation.
      *
      * \param list QVector of EdgePtr or NodePtr
      * \param property the property the shall be set to specified value
@@ -23,10 +23,12 @@
 #include "nodetype.h"
 #include "edge.h"
 #include "nodetypestyle.h"
+#include "propertytable.h"
 #include "logging_p.h"
 
 #include <QPointF>
 #include <QColor>
+#include <QHash>
 
 using namespace GraphTheory;
 
@@ -41,6 +43,8 @@ public:
         , m_y(0)
         , m_color(Qt::white)
         , m_id(-1)
+        , m_documentIndex(-1)
+        , m_propertyRow(-1)
     {
     }
 
@@ -52,11 +56,14 @@ public:
     GraphDocumentPtr m_document;
     NodeTypePtr m_type;
     EdgeList m_edges;
+    QHash<const Edge*, int> m_edgeIndex; //!< position of each edge in m_edges
     bool m_valid;
     qreal m_x;
     qreal m_y;
     QColor m_color;
     int m_id;
+    int m_documentIndex;
+    int m_propertyRow;
 };
 
 Node::Node()
@@ -73,6 +80,9 @@ Node::Node()
 
 Node::~Node()
 {
+    if (d->m_type) {
+        d->m_type->propertyTable()->releaseRow(d->m_propertyRow);
+    }
     --Node::objectCounter;
 }
 
@@ -91,6 +101,46 @@ NodePtr Node::create(GraphDocumentPtr document)
     return pi;
 }
 
+NodeList Node::create(GraphDocumentPtr document, const QVector<QPointF> &positions, NodeTypePtr type)
+{
+    if (!type) {
+        type = document->nodeTypes().first();
+    }
+    NodeList nodes;
+    nodes.reserve(positions.size());
+    BatchGuard batch(document);
+    foreach (const QPointF &position, positions) {
+        NodePtr pi(new Node);
+        pi->setQpointer(pi);
+        pi->d->m_document = document;
+        pi->d->m_id = document->generateId();
+        pi->d->m_x = position.x();
+        pi->d->m_y = position.y();
+        pi->setType(type);
+        pi->d->m_valid = true;
+        document->insert(pi->d->q);
+        nodes.append(pi);
+    }
+    return nodes;
+}
+
+NodePtr Node::createObject(GraphDocumentPtr document, int id, const QPointF &position,
+                           const QColor &color, NodeTypePtr type, int propertyRow)
+{
+    NodePtr pi(new Node);
+    pi->setQpointer(pi);
+    pi->d->m_document = document;
+    pi->d->m_id = id;
+    pi->d->m_x = position.x();
+    pi->d->m_y = position.y();
+    pi->d->m_color = color;
+    pi->d->m_type = type;
+    pi->d->m_propertyRow = propertyRow;
+    pi->connectType();
+    pi->d->m_valid = true;
+    return pi;
+}
+
 NodePtr Node::self() const
 {
     return d->q;
@@ -98,8 +148,15 @@ NodePtr Node::self() const
 
 void Node::destroy()
 {
+    // removal renumbers the elements of the document, which needs all objects
+    d->m_document->createObjects();
     d->m_valid = false;
-    foreach (EdgePtr edge, d->m_edges) {
+    // detach edges before removing them, such that removing each edge from this node
+    // does not have to search the remaining adjacency list
+    const EdgeList edges = d->m_edges;
+    d->m_edges.clear();
+    d->m_edgeIndex.clear();
+    foreach (EdgePtr edge, edges) {
         d->m_document->remove(edge);
     }
     d->m_document->remove(d->q);
@@ -130,27 +187,46 @@ void Node::setType(NodeTypePtr type)
     if (d->m_type == type) {
         return;
     }
+    // move values to the property table of the new type, including values of properties
+    // that are not registered at the new type
+    PropertyTable *properties = type->propertyTable();
+    const int row = properties->allocateRow();
     if (d->m_type) {
         d->m_type->disconnect(this);
         d->m_type->style()->disconnect(this);
+        PropertyTable *oldProperties = d->m_type->propertyTable();
+        foreach (const QString &property, oldProperties->columnNames()) {
+            const int column = oldProperties->column(property);
+            if (oldProperties->hasValue(column, d->m_propertyRow)) {
+                properties->setValue(properties->addColumn(property), row, oldProperties->value(column, d->m_propertyRow));
+            }
+        }
+        oldProperties->releaseRow(d->m_propertyRow);
     }
     d->m_type = type;
-    connect(type.data(), &NodeType::dynamicPropertyAboutToBeAdded,
+    d->m_propertyRow = row;
+    connectType();
+    emit typeChanged(type);
+    emit styleChanged();
+}
+
+void Node::connectType()
+{
+    NodeType *type = d->m_type.data();
+    connect(type, &NodeType::dynamicPropertyAboutToBeAdded,
         this, &Node::dynamicPropertyAboutToBeAdded);
-    connect(type.data(), &NodeType::dynamicPropertyAdded,
+    connect(type, &NodeType::dynamicPropertyAdded,
         this, &Node::dynamicPropertyAdded);
-    connect(type.data(), &NodeType::dynamicPropertiesAboutToBeRemoved,
+    connect(type, &NodeType::dynamicPropertiesAboutToBeRemoved,
         this, &Node::dynamicPropertiesAboutToBeRemoved);
-    connect(type.data(), &NodeType::dynamicPropertyRemoved,
+    connect(type, &NodeType::dynamicPropertyRemoved,
         this, &Node::dynamicPropertyRemoved);
-    connect(type.data(), &NodeType::dynamicPropertyRemoved,
+    connect(type, &NodeType::dynamicPropertyRemoved,
         this, &Node::updateDynamicProperty);
-    connect(type.data(), &NodeType::dynamicPropertyRenamed,
+    connect(type, &NodeType::dynamicPropertyRenamed,
         this, &Node::renameDynamicProperty);
     connect(type->style(), &NodeTypeStyle::changed,
         this, &Node::styleChanged);
-    emit typeChanged(type);
-    emit styleChanged();
 }
 
 void Node::insert(EdgePtr edge)
@@ -158,9 +234,15 @@ void Node::insert(EdgePtr edge)
     if (edge->from() != d->q && edge->to() != d->q) {
         return;
     }
-    if (d->m_edges.contains(edge)) {
+    if (d->m_edgeIndex.contains(edge.data())) {
         return;
     }
+    attach(edge);
+}
+
+void Node::attach(EdgePtr edge)
+{
+    d->m_edgeIndex.insert(edge.data(), d->m_edges.length());
     d->m_edges.append(edge);
     emit edgeAdded(edge);
 }
@@ -170,18 +252,24 @@ void Node::remove(EdgePtr edge)
     if (edge && edge->isValid()) {
         edge->destroy();
     }
-    // efficient way to remove edge without having to preserve order
-    for (int i = 0; i < d->m_edges.length(); ++i) {
-        if (d->m_edges.at(i) == edge) {
-            d->m_edges[i] = d->m_edges.last();
-            d->m_edges.removeLast();
-            return;
-        }
+    // move last edge into the gap, the order of the adjacency list is not preserved
+    const auto iter = d->m_edgeIndex.find(edge.data());
+    if (iter == d->m_edgeIndex.end()) {
+        return;
+    }
+    const int index = iter.value();
+    d->m_edgeIndex.erase(iter);
+    const EdgePtr last = d->m_edges.last();
+    d->m_edges.removeLast();
+    if (last != edge) {
+        d->m_edges[index] = last;
+        d->m_edgeIndex.insert(last.data(), index);
     }
 }
 
 EdgeList Node::edges(EdgeTypePtr type) const
 {
+    d->m_document->createEdgeObjects(this);
     if (!type) {
         return d->m_edges;
     }
@@ -196,6 +284,7 @@ EdgeList Node::edges(EdgeTypePtr type) const
 
 EdgeList Node::inEdges(EdgeTypePtr type) const
 {
+    d->m_document->createEdgeObjects(this);
     EdgeList inEdges;
     foreach (EdgePtr edge, d->m_edges) {
         if (type && edge->type() != type) {
@@ -216,6 +305,7 @@ EdgeList Node::inEdges(EdgeTypePtr type) const
 
 EdgeList Node::outEdges(EdgeTypePtr type) const
 {
+    d->m_document->createEdgeObjects(this);
     EdgeList outEdges;
     foreach (EdgePtr edge, d->m_edges) {
         if (type && edge->type() != type) {
@@ -244,7 +334,11 @@ void Node::setId(int id)
     if (id == d->m_id) {
         return;
     }
+    const int oldId = d->m_id;
     d->m_id = id;
+    if (d->q && d->m_document) {
+        d->m_document->updateNodeId(d->q, oldId);
+    }
     emit idChanged(id);
 }
 
@@ -255,11 +349,7 @@ qreal Node::x() const
 
 void Node::setX(qreal x)
 {
-    if (x == d->m_x) {
-        return;
-    }
-    d->m_x = x;
-    emit positionChanged(QPointF(x, d->m_y));
+    setPosition(QPointF(x, d->m_y));
 }
 
 qreal Node::y() const
@@ -269,11 +359,26 @@ qreal Node::y() const
 
 void Node::setY(qreal y)
 {
-    if (y == d->m_y) {
+    setPosition(QPointF(d->m_x, y));
+}
+
+QPointF Node::position() const
+{
+    return QPointF(d->m_x, d->m_y);
+}
+
+void Node::setPosition(const QPointF &position)
+{
+    if (position.x() == d->m_x && position.y() == d->m_y) {
         return;
     }
-    d->m_y = y;
-    emit positionChanged(QPointF(d->m_x, y));
+    d->m_x = position.x();
+    d->m_y = position.y();
+    // during a batch of the document, the change is announced when the batch is closed
+    if (d->m_document && !d->m_document->updateNodePosition(this)) {
+        return;
+    }
+    emit positionChanged(position);
 }
 
 QColor Node::color() const
@@ -292,7 +397,20 @@ void Node::setColor(const QColor &color)
 
 QVariant Node::dynamicProperty(const QString &property) const
 {
-    return Node::property(("_graph_" + property).toLatin1());
+    if (!d->m_type) {
+        return QVariant();
+    }
+    const PropertyTable *properties = d->m_type->propertyTable();
+    return properties->value(properties->column(property), d->m_propertyRow);
+}
+
+QVariant Node::dynamicProperty(const PropertyKey &key) const
+{
+    if (!d->m_type) {
+        return QVariant();
+    }
+    const PropertyTable *properties = d->m_type->propertyTable();
+    return properties->value(properties->column(key), d->m_propertyRow);
 }
 
 QStringList Node::dynamicProperties() const
@@ -307,12 +425,36 @@ void Node::setDynamicProperty(const QString &property, const QVariant &value)
 {
     if (!d->m_type) {
         qCWarning(GRAPHTHEORY_GENERAL) << "No type registered, aborting to set property.";
+        return;
+    }
+    PropertyTable *properties = d->m_type->propertyTable();
+    setDynamicPropertyValue(value.isValid() ? properties->addColumn(property) : properties->column(property), value);
+}
+
+void Node::setDynamicProperty(const PropertyKey &key, const QVariant &value)
+{
+    if (!d->m_type) {
+        qCWarning(GRAPHTHEORY_GENERAL) << "No type registered, aborting to set property.";
+        return;
     }
-    if (value.isValid() && !d->m_type->dynamicProperties().contains(property)) {
+    PropertyTable *properties = d->m_type->propertyTable();
+    int column = properties->column(key);
+    if (column < 0 && value.isValid() && key.isValid()) {
+        column = properties->addColumn(key.name());
+    }
+    setDynamicPropertyValue(column, value);
+}
+
+void Node::setDynamicPropertyValue(int column, const QVariant &value)
+{
+    const int index = d->m_type->dynamicPropertyIndex(column);
+    if (value.isValid() && index < 0) {
         qCWarning(GRAPHTHEORY_GENERAL) << "Dynamic property not registered at type, aborting to set property.";
     }
-    setProperty(("_graph_" + property).toLatin1(), value);
-    emit dynamicPropertyChanged(d->m_type->dynamicProperties().indexOf(property));
+    if (column >= 0) {
+        d->m_type->propertyTable()->setValue(column, d->m_propertyRow, value);
+    }
+    emit dynamicPropertyChanged(index);
 }
 
 void Node::updateDynamicProperty(const QString &property)
@@ -326,12 +468,27 @@ void Node::updateDynamicProperty(const QString &property)
 
 void Node::renameDynamicProperty(const QString &oldProperty, const QString &newProperty)
 {
-    setDynamicProperty(newProperty, dynamicProperty(oldProperty));
-    setDynamicProperty(oldProperty, QVariant::Invalid);
+    // values are already moved by the property table of the type
+    Q_UNUSED(oldProperty);
     emit dynamicPropertyChanged(d->m_type->dynamicProperties().indexOf(newProperty));
 }
 
+int Node::propertyRow() const
+{
+    return d->m_propertyRow;
+}
+
 void Node::setQpointer(NodePtr q)
 {
     d->q = q;
 }
+
+int Node::documentIndex() const
+{
+    return d->m_documentIndex;
+}
+
+void Node::setDocumentIndex(int index)
+{
+    d->m_documentIndex = index;
+}
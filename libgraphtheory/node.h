@@ -27,12 +27,14 @@
 
 #include <QObject>
 #include <QColor>
+#include <QPointF>
 
 class QPointF;
 
 namespace GraphTheory
 {
 class NodePrivate;
+class PropertyKey;
 
 /**
  * \class Node
@@ -55,6 +57,19 @@ public:
      */
     static NodePtr create(GraphDocumentPtr document);
 
+    /**
+     * Creates one new Node at each of the given positions. All nodes are inserted in one batch of
+     * @p document, i.e., they are announced by a single GraphDocument::nodesAboutToBeAdded().
+     * Use this method to construct large graphs.
+     *
+     * @param document  the GraphDocument containing the nodes
+     * @param positions  the positions of the nodes
+     * @param type  the NodeType of the nodes, the default node type if not set
+     * @return the created nodes, ordered like @p positions
+     */
+    static NodeList create(GraphDocumentPtr document, const QVector<QPointF> &positions,
+                           NodeTypePtr type = NodeTypePtr());
+
     /** Destroys the node */
     virtual ~Node();
 
@@ -161,6 +176,16 @@ public:
      */
     void setY(qreal y);
 
+    /**
+     * @return position of node
+     */
+    QPointF position() const;
+
+    /**
+     * set position of node to @c position, which emits positionChanged() only once
+     */
+    void setPosition(const QPointF &position);
+
     /**
      * @return color of node
      */
@@ -176,6 +201,11 @@ public:
      */
     QVariant dynamicProperty(const QString &property) const;
 
+    /**
+     * Overload of dynamicProperty() that accesses the property by a key of the node type.
+     */
+    QVariant dynamicProperty(const PropertyKey &key) const;
+
     /**
      * @return list of dynamic properties registered at node type
      */
@@ -183,8 +213,8 @@ public:
 
     /**
      * Set dynamic property with identifier @c property. If @c value is
-     * QVariant::Invalid, the dynamic property is unset. Internally, this
-     * method use the QObject::setProperty mechanism but prefixes properties to avoid name clashes.
+     * QVariant::Invalid, the dynamic property is unset. The value is stored in the
+     * property table of the node type.
      *
      * @param property is the identifier for the new property
      * @param value is the value of this property
@@ -192,13 +222,33 @@ public:
     void setDynamicProperty(const QString &property, const QVariant &value);
 
     /**
-     * Rename dynamic property from identifier @c oldProperty to @c newProperty.
+     * Overload of setDynamicProperty() that accesses the property by a key of the node type,
+     * which avoids looking up the property by name.
+     */
+    void setDynamicProperty(const PropertyKey &key, const QVariant &value);
+
+    /**
+     * Notify about renaming of dynamic property @c oldProperty to @c newProperty at the type.
+     * The values are moved by the property table of the type.
      *
      * @param oldProperty the former value of the property
      * @param newProperty the new value of the property
      */
     void renameDynamicProperty(const QString &oldProperty, const QString &newProperty);
 
+    /**
+     * @return row of this node in the property table of its type, see NodeType::propertyTable()
+     */
+    int propertyRow() const;
+
+    /**
+     * The document index is the position of the node in GraphDocument::nodes(). It changes
+     * when other nodes are removed from the document.
+     *
+     * @return position of the node in the list of nodes of its document, -1 if not registered
+     */
+    int documentIndex() const;
+
     /**
      * Debug method that tracks how many node objects exist.
      *
@@ -238,6 +288,34 @@ private:
     Q_DISABLE_COPY(Node)
     const QScopedPointer<NodePrivate> d;
     void setQpointer(NodePtr q);
+    /**
+     * Store @p value in @p column of the property table of the type, -1 if no column exists.
+     */
+    void setDynamicPropertyValue(int column, const QVariant &value);
+    /**
+     * Set position of the node in the list of nodes of its document to @p index.
+     * Only GraphDocument maintains this value.
+     */
+    void setDocumentIndex(int index);
+    /**
+     * Add the newly created @p edge without checking for duplicates. Only Edge::create() uses
+     * this method, it must not be called twice for the same edge.
+     */
+    void attach(EdgePtr edge);
+    /**
+     * Create the object of a node of a document in compact storage. The node takes over the row
+     * @p propertyRow of the property table of @p type and is not inserted into the document.
+     * Only GraphDocument uses this method.
+     */
+    static NodePtr createObject(GraphDocumentPtr document, int id, const QPointF &position,
+                                const QColor &color, NodeTypePtr type, int propertyRow);
+    /**
+     * Connect to the signals of the current type and its style.
+     */
+    void connectType();
+    friend class Edge;
+    friend class GraphDocument;
+    friend class GraphDocumentPrivate;
     static uint objectCounter;
 };
 }
@@ -0,0 +1,128 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "nodehandle.h"
+#include "graphdocument.h"
+#include "node.h"
+#include "nodetype.h"
+#include "propertytable.h"
+#include "elementpool_p.h"
+
+using namespace GraphTheory;
+
+int NodeHandle::id() const
+{
+    if (const NodePool *pool = m_document->nodePool(m_index)) {
+        return pool->ids.at(m_index);
+    }
+    return m_document->nodeObject(m_index)->id();
+}
+
+void NodeHandle::setId(int id)
+{
+    if (NodePool *pool = m_document->nodePool(m_index)) {
+        const int oldId = pool->ids.at(m_index);
+        pool->ids[m_index] = id;
+        m_document->updatePoolNodeId(m_index, oldId, id);
+        return;
+    }
+    m_document->nodeObject(m_index)->setId(id);
+}
+
+QPointF NodeHandle::position() const
+{
+    if (const NodePool *pool = m_document->nodePool(m_index)) {
+        return QPointF(pool->xs.at(m_index), pool->ys.at(m_index));
+    }
+    return m_document->nodeObject(m_index)->position();
+}
+
+void NodeHandle::setPosition(const QPointF &position)
+{
+    if (NodePool *pool = m_document->nodePool(m_index)) {
+        pool->xs[m_index] = position.x();
+        pool->ys[m_index] = position.y();
+        return;
+    }
+    m_document->nodeObject(m_index)->setPosition(position);
+}
+
+QColor NodeHandle::color() const
+{
+    if (const NodePool *pool = m_document->nodePool(m_index)) {
+        return QColor::fromRgba(pool->colors.at(m_index));
+    }
+    return m_document->nodeObject(m_index)->color();
+}
+
+void NodeHandle::setColor(const QColor &color)
+{
+    if (NodePool *pool = m_document->nodePool(m_index)) {
+        pool->colors[m_index] = color.rgba();
+        return;
+    }
+    m_document->nodeObject(m_index)->setColor(color);
+}
+
+NodeTypePtr NodeHandle::type() const
+{
+    if (const NodePool *pool = m_document->nodePool(m_index)) {
+        return pool->types.at(m_index)->self();
+    }
+    return m_document->nodeObject(m_index)->type();
+}
+
+int NodeHandle::propertyRow() const
+{
+    if (const NodePool *pool = m_document->nodePool(m_index)) {
+        return pool->propertyRows.at(m_index);
+    }
+    return m_document->nodeObject(m_index)->propertyRow();
+}
+
+QVariant NodeHandle::dynamicProperty(const PropertyKey &key) const
+{
+    if (const NodePool *pool = m_document->nodePool(m_index)) {
+        const PropertyTable *properties = pool->types.at(m_index)->propertyTable();
+        return properties->value(properties->column(key), pool->propertyRows.at(m_index));
+    }
+    return m_document->nodeObject(m_index)->dynamicProperty(key);
+}
+
+void NodeHandle::setDynamicProperty(const PropertyKey &key, const QVariant &value)
+{
+    if (NodePool *pool = m_document->nodePool(m_index)) {
+        PropertyTable *properties = pool->types.at(m_index)->propertyTable();
+        int column = properties->column(key);
+        if (column < 0 && value.isValid() && key.isValid()) {
+            column = properties->addColumn(key.name());
+        }
+        if (column >= 0) {
+            properties->setValue(column, pool->propertyRows.at(m_index), value);
+        }
+        return;
+    }
+    m_document->nodeObject(m_index)->setDynamicProperty(key, value);
+}
+
+NodePtr NodeHandle::node() const
+{
+    return m_document->nodeObject(m_index);
+}
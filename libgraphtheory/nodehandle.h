@@ -0,0 +1,123 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NODEHANDLE_H
+#define NODEHANDLE_H
+
+#include "graphtheory_export.h"
+#include "typenames.h"
+
+#include <QColor>
+#include <QPointF>
+#include <QVariant>
+
+namespace GraphTheory
+{
+class PropertyKey;
+
+/**
+ * \class NodeHandle
+ * Lightweight reference to a node of a GraphDocument by its position in
+ * GraphDocument::nodes().
+ *
+ * Handles give access to the data of a node in both storage modes of the document without
+ * creating Node objects for documents in GraphDocument::CompactStorage. Use them in importers
+ * and algorithms that process many nodes. Handles are cheap to copy, but like the position of
+ * a node they are only valid until nodes are removed from the document. Changes through a
+ * handle of a document in compact storage are not announced by any signal, unless the node
+ * already has an object.
+ */
+class GRAPHTHEORY_EXPORT NodeHandle
+{
+public:
+    /**
+     * Creates an invalid handle.
+     */
+    NodeHandle()
+        : m_document(nullptr)
+        , m_index(-1)
+    {
+    }
+
+    /**
+     * @return @c true if the handle refers to a node
+     */
+    bool isValid() const
+    {
+        return m_document != nullptr && m_index >= 0;
+    }
+
+    /**
+     * @return position of the node in GraphDocument::nodes()
+     */
+    int index() const
+    {
+        return m_index;
+    }
+
+    int id() const;
+    void setId(int id);
+    QPointF position() const;
+    void setPosition(const QPointF &position);
+    QColor color() const;
+    void setColor(const QColor &color);
+    NodeTypePtr type() const;
+
+    /**
+     * @return row of the node in the property table of its type
+     */
+    int propertyRow() const;
+
+    QVariant dynamicProperty(const PropertyKey &key) const;
+    void setDynamicProperty(const PropertyKey &key, const QVariant &value);
+
+    /**
+     * Return the Node object of this node. For a document in compact storage, this creates the
+     * object of this node only, which from then on holds the data of the node.
+     *
+     * @return the node object
+     */
+    NodePtr node() const;
+
+    bool operator==(const NodeHandle &other) const
+    {
+        return m_document == other.m_document && m_index == other.m_index;
+    }
+
+    bool operator!=(const NodeHandle &other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    friend class GraphDocument;
+    friend class EdgeHandle;
+    NodeHandle(GraphDocument *document, int index)
+        : m_document(document)
+        , m_index(index)
+    {
+    }
+
+    GraphDocument *m_document;
+    int m_index;
+};
+}
+
+#endif
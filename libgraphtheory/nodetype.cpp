@@ -20,6 +20,7 @@
 
 #include "nodetype.h"
 #include "nodetypestyle.h"
+#include "propertytable.h"
 #include "graphdocument.h"
 #include <QDebug>
 
@@ -44,11 +45,21 @@ public:
         m_style->deleteLater();
     }
 
+    void updatePropertyIndices()
+    {
+        m_propertyIndices.fill(-1, m_properties.columnCount());
+        for (int i = 0; i < m_dynamicProperties.count(); ++i) {
+            m_propertyIndices[m_properties.column(m_dynamicProperties.at(i))] = i;
+        }
+    }
+
     NodeTypePtr q;
     int m_id;
     NodeTypeStyle *m_style;
     GraphDocumentPtr m_document;
     QStringList m_dynamicProperties;
+    PropertyTable m_properties;
+    QVector<int> m_propertyIndices; //!< positions in m_dynamicProperties by column
     QString m_name;
     bool m_valid;
 };
@@ -138,19 +149,50 @@ NodeTypeStyle * NodeType::style() const
     return d->m_style;
 }
 
+PropertyTable * NodeType::propertyTable() const
+{
+    return &d->m_properties;
+}
+
+void NodeType::notifyDynamicPropertyValuesChanged(const PropertyKey &key)
+{
+    emit dynamicPropertyValuesChanged(dynamicPropertyIndex(d->m_properties.column(key)));
+}
+
 QStringList NodeType::dynamicProperties() const
 {
     return d->m_dynamicProperties;
 }
 
-void NodeType::addDynamicProperty(const QString& property)
+PropertyKey NodeType::addDynamicProperty(const QString& property)
 {
-    if (d->m_dynamicProperties.contains(property)) {
-        return;
+    const int column = d->m_properties.column(property);
+    if (dynamicPropertyIndex(column) >= 0) {
+        return d->m_properties.key(column);
     }
     emit dynamicPropertyAboutToBeAdded(property, d->m_dynamicProperties.count());
     d->m_dynamicProperties.append(property);
+    d->m_properties.addColumn(property);
+    d->updatePropertyIndices();
     emit dynamicPropertyAdded();
+    return d->m_properties.key(d->m_properties.column(property));
+}
+
+PropertyKey NodeType::dynamicPropertyKey(const QString &property) const
+{
+    const int column = d->m_properties.column(property);
+    if (dynamicPropertyIndex(column) < 0) {
+        return PropertyKey();
+    }
+    return d->m_properties.key(column);
+}
+
+int NodeType::dynamicPropertyIndex(int column) const
+{
+    if (column < 0 || column >= d->m_propertyIndices.size()) {
+        return -1;
+    }
+    return d->m_propertyIndices.at(column);
 }
 
 void NodeType::removeDynamicProperty(const QString& property)
@@ -161,6 +203,8 @@ void NodeType::removeDynamicProperty(const QString& property)
     int index = d->m_dynamicProperties.indexOf(property);
     emit dynamicPropertiesAboutToBeRemoved(index, index);
     d->m_dynamicProperties.removeAt(index);
+    d->m_properties.removeColumn(property);
+    d->updatePropertyIndices();
     emit dynamicPropertyRemoved(property);
 }
 
@@ -174,6 +218,7 @@ void NodeType::renameDynamicProperty(const QString& oldProperty, const QString&
     }
     int index = d->m_dynamicProperties.indexOf(oldProperty);
     d->m_dynamicProperties[index] = newProperty;
+    d->m_properties.renameColumn(oldProperty, newProperty);
     emit dynamicPropertyRenamed(oldProperty, newProperty);
     emit dynamicPropertyChanged(index);
 }
@@ -23,6 +23,7 @@
 
 #include "graphtheory_export.h"
 #include "typenames.h"
+#include "propertykey.h"
 
 #include <QObject>
 #include <QSharedPointer>
@@ -32,6 +33,7 @@ namespace GraphTheory
 {
 
 class NodeTypePrivate;
+class PropertyTable;
 class NodeTypeStyle;
 
 /**
@@ -112,8 +114,21 @@ public:
     /**
      * Add dynamic property @c property to list of dynamic properties.
      * Signal dynamicPropertyAdded(@c property) is emitted afterwards
+     *
+     * @return key of the property, also if it was registered before
+     */
+    PropertyKey addDynamicProperty(const QString &property);
+
+    /**
+     * @return key of registered dynamic property @p property, an invalid key if it is not registered
+     */
+    PropertyKey dynamicPropertyKey(const QString &property) const;
+
+    /**
+     * @return position in dynamicProperties() of the property stored in column @p column of
+     *         propertyTable(), -1 if the property is not registered
      */
-    void addDynamicProperty(const QString &property);
+    int dynamicPropertyIndex(int column) const;
 
     /**
      * Remove dynamic property @c property from list of dynamic properties.
@@ -128,6 +143,21 @@ public:
      */
     void renameDynamicProperty(const QString &oldProperty, const QString &newProperty);
 
+    /**
+     * The property table stores the dynamic property values of all nodes of this type, each node
+     * owns the row Node::propertyRow().
+     *
+     * @return storage of dynamic property values
+     */
+    PropertyTable * propertyTable() const;
+
+    /**
+     * Announce that values of dynamic property @p key were written to propertyTable() directly
+     * for many nodes. Signal dynamicPropertyValuesChanged() is emitted once instead of
+     * Node::dynamicPropertyChanged() at each node.
+     */
+    void notifyDynamicPropertyValuesChanged(const PropertyKey &key);
+
     /**
      * Debug method that tracks how many node objects exist.
      *
@@ -148,6 +178,8 @@ Q_SIGNALS:
     void dynamicPropertyRemoved(const QString &property);
     void dynamicPropertyRenamed(const QString &oldProperty, const QString &newProperty);
     void dynamicPropertyChanged(int index);
+    /** values of the dynamic property at @p index changed for several nodes **/
+    void dynamicPropertyValuesChanged(int index);
 
 protected:
     NodeType();
@@ -0,0 +1,89 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PROPERTYKEY_H
+#define PROPERTYKEY_H
+
+#include "graphtheory_export.h"
+
+#include <QString>
+
+namespace GraphTheory
+{
+
+class PropertyTable;
+
+/**
+ * \class PropertyKey
+ * Handle of a dynamic property at a NodeType or EdgeType.
+ *
+ * A key is obtained once by name from NodeType::addDynamicProperty(),
+ * NodeType::dynamicPropertyKey() or the according EdgeType methods and then used to access
+ * the property of many elements without further name lookups. Keys are cheap to copy. A key
+ * used at an element of another type or after its property was removed falls back to a lookup
+ * by name.
+ */
+class GRAPHTHEORY_EXPORT PropertyKey
+{
+public:
+    /**
+     * Creates an invalid key.
+     */
+    PropertyKey()
+        : m_table(nullptr)
+        , m_column(-1)
+        , m_serial(0)
+    {
+    }
+
+    /**
+     * @return @c true if the key was created for a property
+     */
+    bool isValid() const
+    {
+        return m_table != nullptr;
+    }
+
+    /**
+     * @return name of the property
+     */
+    QString name() const
+    {
+        return m_name;
+    }
+
+private:
+    friend class PropertyTable;
+    PropertyKey(const PropertyTable *table, int column, uint serial, const QString &name)
+        : m_table(table)
+        , m_column(column)
+        , m_serial(serial)
+        , m_name(name)
+    {
+    }
+
+    const PropertyTable *m_table;
+    int m_column;
+    uint m_serial;
+    QString m_name;
+};
+}
+
+#endif
@@ -0,0 +1,402 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "propertytable.h"
+
+#include <QStringList>
+
+using namespace GraphTheory;
+
+namespace
+{
+template<typename Target, typename Value>
+void assign(QVector<Target> &target, QBitArray &present, const QVector<int> &rows, const QVector<Value> &values)
+{
+    Q_ASSERT(rows.size() == values.size());
+    Target *data = target.data();
+    for (int i = 0; i < rows.size(); ++i) {
+        data[rows.at(i)] = Target(values.at(i));
+        present.setBit(rows.at(i));
+    }
+}
+}
+
+PropertyTable::PropertyTable()
+    : m_rowCount(0)
+    , m_capacity(0)
+    , m_serial(0)
+{
+}
+
+int PropertyTable::allocateRow()
+{
+    if (!m_freeRows.isEmpty()) {
+        const int row = m_freeRows.last();
+        m_freeRows.removeLast();
+        return row;
+    }
+    if (m_rowCount == m_capacity) {
+        m_capacity = qMax(16, 2 * m_capacity);
+        for (int i = 0; i < m_columns.size(); ++i) {
+            resize(m_columns[i]);
+        }
+    }
+    return m_rowCount++;
+}
+
+void PropertyTable::releaseRow(int row)
+{
+    Q_ASSERT(row >= 0 && row < m_rowCount);
+    for (int i = 0; i < m_columns.size(); ++i) {
+        clear(m_columns[i], row);
+    }
+    m_freeRows.append(row);
+}
+
+int PropertyTable::column(const QString &name) const
+{
+    return m_columnIndex.value(name, -1);
+}
+
+int PropertyTable::column(const PropertyKey &key) const
+{
+    if (key.m_table == this && key.m_column < m_columns.size()
+            && m_columns.at(key.m_column).serial == key.m_serial) {
+        return key.m_column;
+    }
+    if (!key.isValid()) {
+        return -1;
+    }
+    return column(key.name());
+}
+
+PropertyKey PropertyTable::key(int column) const
+{
+    if (column < 0) {
+        return PropertyKey();
+    }
+    const Column &entry = m_columns.at(column);
+    return PropertyKey(this, column, entry.serial, entry.name);
+}
+
+int PropertyTable::columnCount() const
+{
+    return m_columns.size();
+}
+
+int PropertyTable::addColumn(const QString &name)
+{
+    Q_ASSERT(!name.isEmpty());
+    int index = m_columnIndex.value(name, -1);
+    if (index >= 0) {
+        return index;
+    }
+    if (!m_freeColumns.isEmpty()) {
+        index = m_freeColumns.last();
+        m_freeColumns.removeLast();
+    } else {
+        index = m_columns.size();
+        m_columns.append(Column());
+    }
+    Column &column = m_columns[index];
+    column.name = name;
+    column.serial = ++m_serial;
+    resize(column);
+    m_columnIndex.insert(name, index);
+    return index;
+}
+
+void PropertyTable::removeColumn(const QString &name)
+{
+    const int index = m_columnIndex.value(name, -1);
+    if (index < 0) {
+        return;
+    }
+    m_columnIndex.remove(name);
+    m_columns[index] = Column();
+    m_freeColumns.append(index);
+}
+
+void PropertyTable::renameColumn(const QString &oldName, const QString &newName)
+{
+    const int index = m_columnIndex.value(oldName, -1);
+    if (index < 0 || oldName == newName) {
+        return;
+    }
+    removeColumn(newName);
+    m_columnIndex.remove(oldName);
+    m_columnIndex.insert(newName, index);
+    m_columns[index].name = newName;
+}
+
+QStringList PropertyTable::columnNames() const
+{
+    return m_columnIndex.keys();
+}
+
+PropertyTable::ValueType PropertyTable::valueType(int column) const
+{
+    if (column < 0) {
+        return Empty;
+    }
+    return m_columns.at(column).type;
+}
+
+bool PropertyTable::hasValue(int column, int row) const
+{
+    if (column < 0) {
+        return false;
+    }
+    Q_ASSERT(row >= 0 && row < m_rowCount);
+    return m_columns.at(column).present.testBit(row);
+}
+
+QVariant PropertyTable::value(int column, int row) const
+{
+    if (!hasValue(column, row)) {
+        return QVariant();
+    }
+    return value(m_columns.at(column), row);
+}
+
+void PropertyTable::setValue(int column, int row, const QVariant &value)
+{
+    Q_ASSERT(column >= 0 && column < m_columns.size());
+    Q_ASSERT(row >= 0 && row < m_rowCount);
+    Column &entry = m_columns[column];
+    const ValueType type = valueType(value);
+    if (type == Empty) {
+        clear(entry, row);
+        return;
+    }
+
+    prepare(entry, type);
+    switch (entry.type) {
+    case Boolean:
+        entry.booleans[row] = value.toBool();
+        break;
+    case Integer:
+        entry.integers[row] = value.toInt();
+        break;
+    case Real:
+        entry.reals[row] = value.toDouble();
+        break;
+    case String:
+        entry.strings[row] = value.toString();
+        break;
+    default:
+        entry.variants[row] = value;
+        break;
+    }
+    entry.present.setBit(row);
+}
+
+void PropertyTable::setValues(int column, const QVector<int> &rows, const QVector<qreal> &values)
+{
+    Q_ASSERT(column >= 0 && column < m_columns.size());
+    Column &entry = m_columns[column];
+    prepare(entry, Real);
+    if (entry.type == Real) {
+        assign(entry.reals, entry.present, rows, values);
+    } else {
+        assign(entry.variants, entry.present, rows, values);
+    }
+}
+
+void PropertyTable::setValues(int column, const QVector<int> &rows, const QVector<int> &values)
+{
+    Q_ASSERT(column >= 0 && column < m_columns.size());
+    Column &entry = m_columns[column];
+    prepare(entry, Integer);
+    if (entry.type == Integer) {
+        assign(entry.integers, entry.present, rows, values);
+    } else if (entry.type == Real) {
+        assign(entry.reals, entry.present, rows, values);
+    } else {
+        assign(entry.variants, entry.present, rows, values);
+    }
+}
+
+void PropertyTable::setValues(int column, const QVector<int> &rows, const QVector<QString> &values)
+{
+    Q_ASSERT(column >= 0 && column < m_columns.size());
+    Column &entry = m_columns[column];
+    prepare(entry, String);
+    if (entry.type == String) {
+        assign(entry.strings, entry.present, rows, values);
+    } else {
+        assign(entry.variants, entry.present, rows, values);
+    }
+}
+
+qreal PropertyTable::realValue(int column, int row) const
+{
+    if (!hasValue(column, row)) {
+        return 0;
+    }
+    const Column &entry = m_columns.at(column);
+    switch (entry.type) {
+    case Real:
+        return entry.reals.at(row);
+    case Integer:
+        return entry.integers.at(row);
+    case Boolean:
+        return entry.booleans.at(row) ? 1 : 0;
+    case String:
+        return entry.strings.at(row).toDouble();
+    default:
+        return entry.variants.at(row).toDouble();
+    }
+}
+
+const qreal * PropertyTable::reals(int column) const
+{
+    if (column < 0 || m_columns.at(column).type != Real) {
+        return nullptr;
+    }
+    return m_columns.at(column).reals.constData();
+}
+
+PropertyTable::ValueType PropertyTable::valueType(const QVariant &value)
+{
+    switch (static_cast<int>(value.type())) {
+    case QMetaType::UnknownType:
+        return Empty;
+    case QMetaType::Bool:
+        return Boolean;
+    case QMetaType::Int:
+        return Integer;
+    case QMetaType::Double:
+        return Real;
+    case QMetaType::QString:
+        return String;
+    default:
+        return Variant;
+    }
+}
+
+QVariant PropertyTable::value(const Column &column, int row)
+{
+    switch (column.type) {
+    case Boolean:
+        return column.booleans.at(row);
+    case Integer:
+        return column.integers.at(row);
+    case Real:
+        return column.reals.at(row);
+    case String:
+        return column.strings.at(row);
+    case Variant:
+        return column.variants.at(row);
+    default:
+        return QVariant();
+    }
+}
+
+void PropertyTable::resize(Column &column) const
+{
+    column.present.resize(m_capacity);
+    switch (column.type) {
+    case Boolean:
+        column.booleans.resize(m_capacity);
+        break;
+    case Integer:
+        column.integers.resize(m_capacity);
+        break;
+    case Real:
+        column.reals.resize(m_capacity);
+        break;
+    case String:
+        column.strings.resize(m_capacity);
+        break;
+    case Variant:
+        column.variants.resize(m_capacity);
+        break;
+    default:
+        break;
+    }
+}
+
+void PropertyTable::clear(Column &column, int row) const
+{
+    if (column.name.isEmpty() || !column.present.testBit(row)) {
+        return;
+    }
+    column.present.clearBit(row);
+    switch (column.type) {
+    case Boolean:
+        column.booleans[row] = false;
+        break;
+    case Integer:
+        column.integers[row] = 0;
+        break;
+    case Real:
+        column.reals[row] = 0;
+        break;
+    case String:
+        column.strings[row] = QString();
+        break;
+    case Variant:
+        column.variants[row] = QVariant();
+        break;
+    default:
+        break;
+    }
+}
+
+void PropertyTable::convert(Column &column, ValueType type) const
+{
+    Column converted;
+    converted.name = column.name;
+    converted.serial = column.serial;
+    converted.type = type;
+    resize(converted);
+    for (int row = 0; row < m_rowCount; ++row) {
+        if (!column.present.testBit(row)) {
+            continue;
+        }
+        switch (type) {
+        case Real:
+            converted.reals[row] = column.type == Integer ? column.integers.at(row) : value(column, row).toDouble();
+            break;
+        case Variant:
+            converted.variants[row] = value(column, row);
+            break;
+        default:
+            Q_ASSERT(column.type == Empty);
+            break;
+        }
+    }
+    converted.present = column.present;
+    column = converted;
+}
+
+void PropertyTable::prepare(Column &column, ValueType type) const
+{
+    if (column.type == Empty) {
+        convert(column, type);
+    } else if (column.type != type) {
+        if (column.type == Integer && type == Real) {
+            convert(column, Real);
+        } else if (!(column.type == Real && type == Integer)) {
+            convert(column, Variant);
+        }
+    }
+}
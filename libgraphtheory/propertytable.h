@@ -0,0 +1,200 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PROPERTYTABLE_H
+#define PROPERTYTABLE_H
+
+#include "graphtheory_export.h"
+#include "propertykey.h"
+
+#include <QBitArray>
+#include <QHash>
+#include <QString>
+#include <QVariant>
+#include <QVector>
+
+namespace GraphTheory
+{
+
+/**
+ * \class PropertyTable
+ * Column storage for the dynamic property values of all elements of one NodeType or EdgeType.
+ *
+ * Each element owns one row of the table, each property name one column. Columns are typed by
+ * the values stored in them: booleans, integers, real numbers and strings are kept in plain
+ * vectors, only columns with mixed or other values fall back to QVariant. Integer columns are
+ * promoted to real columns when a real number is stored. Row and column indices are stable
+ * handles; released rows and removed columns are reused.
+ *
+ * Columns exist for all names a value was set for, not only for the dynamic properties
+ * registered at the type. This keeps values of properties that are registered later or that
+ * elements carry over from another type.
+ */
+class GRAPHTHEORY_EXPORT PropertyTable
+{
+public:
+    enum ValueType {
+        Empty,      //!< no value was stored yet
+        Boolean,
+        Integer,    //!< values of type int
+        Real,
+        String,
+        Variant
+    };
+
+    PropertyTable();
+
+    /**
+     * @return new row for an element, all of its values are invalid
+     */
+    int allocateRow();
+
+    /**
+     * Clear all values of @p row and make it available for further elements.
+     */
+    void releaseRow(int row);
+
+    /**
+     * @return column of property @p name or -1 if no value of the property was stored
+     */
+    int column(const QString &name) const;
+
+    /**
+     * Resolve @p key without name lookup if it was created by this table and its column still
+     * exists, otherwise by the name of the key.
+     *
+     * @return column of @p key or -1 if no value of the property was stored
+     */
+    int column(const PropertyKey &key) const;
+
+    /**
+     * @return key for @p column, an invalid key if @p column is -1
+     */
+    PropertyKey key(int column) const;
+
+    /**
+     * @return number of columns, including unused columns; all column indices are lower
+     */
+    int columnCount() const;
+
+    /**
+     * @return column of property @p name, which is created if it does not exist
+     */
+    int addColumn(const QString &name);
+
+    /**
+     * Remove the column of property @p name and all of its values.
+     */
+    void removeColumn(const QString &name);
+
+    /**
+     * Rename the column of property @p oldName to @p newName, replacing an existing column
+     * @p newName.
+     */
+    void renameColumn(const QString &oldName, const QString &newName);
+
+    /**
+     * @return names of all columns
+     */
+    QStringList columnNames() const;
+
+    ValueType valueType(int column) const;
+
+    /**
+     * @return @c true if a value is stored at @p column and @p row
+     */
+    bool hasValue(int column, int row) const;
+
+    /**
+     * @return stored value or an invalid QVariant if @p column is -1 or no value is stored
+     */
+    QVariant value(int column, int row) const;
+
+    /**
+     * Store @p value at @p column and @p row. An invalid @p value clears the entry.
+     */
+    void setValue(int column, int row, const QVariant &value);
+
+    /**
+     * Store @p values at @p column, value @p values.at(i) at row @p rows.at(i). The column is
+     * converted at most once, following the same rules as setValue().
+     */
+    void setValues(int column, const QVector<int> &rows, const QVector<qreal> &values);
+
+    /**
+     * \overload
+     */
+    void setValues(int column, const QVector<int> &rows, const QVector<int> &values);
+
+    /**
+     * \overload
+     */
+    void setValues(int column, const QVector<int> &rows, const QVector<QString> &values);
+
+    /**
+     * Numeric value at @p column and @p row, which for real columns is a plain array access.
+     * Other values are converted like QVariant::toDouble().
+     *
+     * @return stored value or 0 if @p column is -1 or no value is stored
+     */
+    qreal realValue(int column, int row) const;
+
+    /**
+     * @return values of a real column indexed by row, entries without value are 0; a null
+     *         pointer if @p column is not a real column
+     */
+    const qreal * reals(int column) const;
+
+private:
+    struct Column
+    {
+        Column()
+            : type(Empty)
+            , serial(0)
+        {
+        }
+        QString name; //!< empty for unused columns
+        ValueType type;
+        uint serial; //!< distinguishes columns that reuse the same index
+        QBitArray present;
+        QVector<bool> booleans;
+        QVector<int> integers;
+        QVector<qreal> reals;
+        QVector<QString> strings;
+        QVector<QVariant> variants;
+    };
+    static ValueType valueType(const QVariant &value);
+    static QVariant value(const Column &column, int row);
+    void resize(Column &column) const;
+    void clear(Column &column, int row) const;
+    void convert(Column &column, ValueType type) const;
+    void prepare(Column &column, ValueType type) const;
+
+    QVector<Column> m_columns;
+    QHash<QString, int> m_columnIndex;
+    QVector<int> m_freeColumns;
+    QVector<int> m_freeRows;
+    int m_rowCount;
+    int m_capacity;
+    uint m_serial;
+};
+}
+
+#endif
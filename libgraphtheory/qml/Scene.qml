@@ -129,7 +129,15 @@ Item {
             width: sceneScrollView.width - 30
             height: sceneScrollView.height - 20
             z: -10 // must lie behind everything else
+            scale: zoom
+            transformOrigin: Item.TopLeft
             property variant origin: Qt.point(0, 0) // coordinate of global origin (0,0) in scene
+            property real zoom: 1.0 // only zooming out, the scroll area is not scaled
+            // area of the scene that is shown by the scroll view, in scene coordinates
+            property rect viewport: Qt.rect(sceneScrollView.flickableItem.contentX / zoom,
+                                            sceneScrollView.flickableItem.contentY / zoom,
+                                            sceneScrollView.viewport.width / zoom,
+                                            sceneScrollView.viewport.height / zoom)
             signal deleteSelected();
             signal startMoveSelected();
             signal finishMoveSelected();
@@ -153,6 +161,52 @@ Item {
                 selectionRect.to = Qt.point(width,height)
                 updateSelection();
             }
+            function selectionArea()
+            {
+                return Qt.rect(Math.min(selectionRect.from.x, selectionRect.to.x),
+                               Math.min(selectionRect.from.y, selectionRect.to.y),
+                               Math.abs(selectionRect.from.x - selectionRect.to.x),
+                               Math.abs(selectionRect.from.y - selectionRect.to.y))
+            }
+            function moveDelta()
+            {
+                return Qt.point(sceneAction.lastMousePosition.x - sceneAction.lastMousePressed.x,
+                                sceneAction.lastMousePosition.y - sceneAction.lastMousePressed.y)
+            }
+            function highlightEdgeEndpoints()
+            {
+                nodeLayer.clearHighlight()
+                if (addEdgeAction.from) {
+                    nodeLayer.setHighlighted(addEdgeAction.from, true)
+                }
+                if (addEdgeAction.to) {
+                    nodeLayer.setHighlighted(addEdgeAction.to, true)
+                }
+            }
+            // grow scene such that all nodes keep a margin of 10 pixels, rect in global coordinates
+            function fitNodes(rect)
+            {
+                if (rect.width == 0 && rect.height == 0) {
+                    return
+                }
+                var left = rect.x - origin.x
+                var top = rect.y - origin.y
+                if (left < 10 || top < 10) {
+                    var deltaX = Math.max(10 - left, 0)
+                    var deltaY = Math.max(10 - top, 0)
+                    origin = Qt.point(origin.x - deltaX, origin.y - deltaY)
+                    width += deltaX
+                    height += deltaY
+                }
+                var right = rect.x + rect.width - origin.x
+                var bottom = rect.y + rect.height - origin.y
+                if (right + 10 > width) {
+                    width = right + 10
+                }
+                if (bottom + 10 > height) {
+                    height = bottom + 10
+                }
+            }
 
             MouseArea {
                 id: sceneAction
@@ -176,14 +230,57 @@ Item {
                 onPressed: {
                     lastMousePressed = Qt.point(mouse.x, mouse.y)
                     lastMousePosition = Qt.point(mouse.x, mouse.y)
+                    var node = nodeLayer.nodeAt(lastMousePressed)
+                    if (deleteAction.checked) {
+                        if (node) {
+                            deleteNode(node)
+                            return
+                        }
+                        var edge = edgeLayer.edgeAt(lastMousePressed)
+                        if (edge) {
+                            deleteEdge(edge)
+                        }
+                        return
+                    }
+                    // node move action: single unselected node replaces selection,
+                    // afterwards the state-machine moves all selected nodes
+                    if (node && selectMoveAction.checked) {
+                        if (!nodeLayer.isHighlighted(node)) {
+                            scene.clearSelection()
+                            nodeLayer.setHighlighted(node, true)
+                        }
+                        nodePressed = true
+                    }
+                }
+                onDoubleClicked: {
+                    var node = nodeLayer.nodeAt(Qt.point(mouse.x, mouse.y))
+                    if (node) {
+                        showNodePropertiesDialog(node)
+                        return
+                    }
+                    var edge = edgeLayer.edgeAt(Qt.point(mouse.x, mouse.y))
+                    if (edge) {
+                        showEdgePropertiesDialog(edge)
+                    }
                 }
                 onPositionChanged: {
                     lastMousePosition = Qt.point(mouse.x, mouse.y)
+                    if (smStateMoving.active) {
+                        nodeLayer.moveHighlighted(scene.moveDelta())
+                    }
                 }
                 onReleased: {
                     lastMouseReleased = Qt.point(mouse.x, mouse.y)
                     sceneAction.nodePressed = false
                 }
+                onWheel: {
+                    if (!(wheel.modifiers & Qt.ControlModifier)) {
+                        wheel.accepted = false // scrolling is handled by the scroll view
+                        return
+                    }
+                    var factor = wheel.angleDelta.y > 0 ? 1.25 : 0.8
+                    scene.zoom = Math.min(1.0, Math.max(0.05, scene.zoom * factor))
+                }
             }
 
             SelectionRectangle {
@@ -200,191 +297,89 @@ Item {
                 toY: sceneAction.lastMousePosition.y
             }
 
-            Repeater {
+            EdgeLayerItem {
+                id: edgeLayer
+                anchors.fill: parent
                 model: edgeModel
-                EdgeItem {
-                    id: edgeItem
-                    edge: model.dataRole
-                    origin: scene.origin
-                    z: -1 // edges must be below nodes
-
-                    EdgePropertyItem {
-                        anchors.centerIn: parent
-                        edge: model.dataRole
-                    }
+                origin: scene.origin
+                visibleArea: scene.viewport
+                aggregated: scene.zoom < 0.25
+                labelsVisible: scene.zoom >= 0.5
+                z: -1 // edges must be below nodes
+            }
 
-                    MouseArea {
-                        anchors.fill: parent
-                        propagateComposedEvents: true
-                        onPressed: {
-                            if (deleteAction.checked) {
-                                deleteEdge(edge)
-                                mouse.accepted = true
-                            }
-                        }
-                        onDoubleClicked: {
-                            showEdgePropertiesDialog(edgeItem.edge);
-                        }
-                    }
+            Repeater { // property labels, only created for visible edges with properties
+                model: edgeLayer.labelEdges
+                EdgePropertyItem {
+                    edge: modelData
+                    x: (edge.fromNode.x + edge.toNode.x - width) / 2 - scene.origin.x
+                    y: (edge.fromNode.y + edge.toNode.y - height) / 2 - scene.origin.y
+                    z: -1
                 }
             }
 
-            Repeater {
+            NodeLayerItem {
+                id: nodeLayer
+                anchors.fill: parent
                 model: nodeModel
-                NodeItem {
-                    id: nodeItem
-                    node: model.dataRole
-                    origin: scene.origin
-                    highlighted: addEdgeAction.from == node || addEdgeAction.to == node
-                    property bool __modifyingPosition: false
-                    property variant __moveStartedPosition: Qt.point(0, 0)
-                    Connections {
-                        target: selectionRect
-                        onChanged: {
-                            if (selectMoveAction.checked && selectionRect.contains(x, y)) {
-                                highlighted = true
-                            } else {
-                                highlighted = false
-                            }
-                        }
-                    }
-                    Connections {
-                        target: scene
-                        onUpdateSelection: {
-                            if (selectionRect.contains(x, y)) {
-                                highlighted = true
-                            } else {
-                                highlighted = false
-                            }
-                        }
-                        onDeleteSelected: {
-                            if (highlighted) {
-                                deleteNode(node)
-                            }
-                        }
-                        onStartMoveSelected: {
-                            if (!highlighted) {
-                                return
-                            }
-                            __moveStartedPosition.x = node.x
-                            __moveStartedPosition.y = node.y
-                            node.x = Qt.binding(function() { return __moveStartedPosition.x + sceneAction.lastMousePosition.x - sceneAction.lastMousePressed.x })
-                            node.y = Qt.binding(function() { return __moveStartedPosition.y + sceneAction.lastMousePosition.y - sceneAction.lastMousePressed.y })
-                        }
-                        onFinishMoveSelected: {
-                            if (!highlighted) {
-                                return
-                            }
-                            node.x = __moveStartedPosition.x + sceneAction.lastMousePosition.x - sceneAction.lastMousePressed.x
-                            node.y = __moveStartedPosition.y + sceneAction.lastMousePosition.y - sceneAction.lastMousePressed.y
-                            __moveStartedPosition.x = 0
-                            __moveStartedPosition.y = 0
-                        }
-                        onCreateEdgeUpdateFromNode: {
-                            if (nodeItem.contains(Qt.point(sceneAction.lastMousePressed.x, sceneAction.lastMousePressed.y))) {
-                                node.highlighted = true
-                                addEdgeAction.from = node
-                            }
-                        }
-                        onCreateEdgeUpdateToNode: {
-                            if (nodeItem.contains(Qt.point(sceneAction.lastMouseReleased.x, sceneAction.lastMouseReleased.y))) {
-                                node.highlighted = true
-                                addEdgeAction.to = node
-                            }
-                        }
-                    }
-                    onXChanged: {
-                        if (scene.origin != nodeItem.origin
-                            || nodeItem.__modifyingPosition
-                        ) { // do nothing if item not initialized
-                            return;
-                        }
-                        if (x < 10) {
-                            nodeItem.__modifyingPosition = true;
-                            var delta = Math.max((10 - x), 10)
-                            scene.origin = Qt.point(scene.origin.x - delta, scene.origin.y);
-                            scene.width += delta;
-                            nodeItem.__modifyingPosition = false;
-                            return;
-                        }
-                        if (x + width + 10 > scene.width) {
-                            nodeItem.__modifyingPosition = true;
-                            var delta = Math.max(scene.width - (x + width) + 10, 10);
-                            scene.width += delta;
-                            nodeItem.__modifyingPosition = false;
-                            return;
-                        }
+                origin: scene.origin
+                visibleArea: scene.viewport
+                aggregated: scene.zoom < 0.25
+                labelsVisible: scene.zoom >= 0.5
+                onNodesRectChanged: scene.fitNodes(nodesRect)
+            }
+
+            Repeater { // property labels, only created for visible nodes with properties
+                model: nodeLayer.labelNodes
+                NodePropertyItem {
+                    node: modelData
+                    x: node.x - scene.origin.x - width / 2
+                    y: node.y - scene.origin.y - height / 2
+                }
+            }
+
+            Connections {
+                target: selectionRect
+                onChanged: {
+                    if (selectMoveAction.checked) {
+                        nodeLayer.highlightRect(scene.selectionArea())
+                    } else {
+                        nodeLayer.clearHighlight()
                     }
-                    onYChanged: {
-                        if (scene.origin != nodeItem.origin
-                            || nodeItem.__modifyingPosition
-                        ) { // do nothing if item not initialized
-                            return;
-                        }
-                        if (y < 10) {
-                            nodeItem.__modifyingPosition = true;
-                            var delta = (10 - y)
-                            scene.origin = Qt.point(scene.origin.x, scene.origin.y - delta);
-                            scene.height += delta;
-                            nodeItem.__modifyingPosition = false;
-                            return;
-                        }
-                        if (y + height + 10 > scene.height) {
-                            nodeItem.__modifyingPosition = true;
-                            var delta = Math.max(scene.height - (y + height) + 10, 10);
-                            scene.height += delta;
-                            nodeItem.__modifyingPosition = false;
-                            return;
-                        }
+                }
+            }
+            Connections {
+                target: addEdgeAction
+                onFromChanged: scene.highlightEdgeEndpoints()
+                onToChanged: scene.highlightEdgeEndpoints()
+            }
+            Connections {
+                target: scene
+                onUpdateSelection: {
+                    nodeLayer.highlightRect(scene.selectionArea())
+                }
+                onDeleteSelected: {
+                    var nodes = nodeLayer.highlightedNodes()
+                    for (var i = 0; i < nodes.length; ++i) {
+                        deleteNode(nodes[i])
                     }
-                    NodePropertyItem {
-                        anchors.centerIn: parent
-                        node: model.dataRole
+                }
+                onStartMoveSelected: {
+                    nodeLayer.startMoveHighlighted()
+                }
+                onFinishMoveSelected: {
+                    nodeLayer.moveHighlighted(scene.moveDelta())
+                }
+                onCreateEdgeUpdateFromNode: {
+                    var node = nodeLayer.nodeAt(sceneAction.lastMousePressed)
+                    if (node) {
+                        addEdgeAction.from = node
                     }
-
-                    Drag.active: dragArea.drag.active
-                    MouseArea {
-                        id: dragArea
-                        anchors.fill: parent
-                        propagateComposedEvents: true
-                        drag.target: { // only enable drag when move/select checked
-                            selectMoveAction.checked ? parent : undefined
-                        }
-                        Loader {
-                            id: nodeDialogLoader
-                        }
-                        onDoubleClicked: {
-                            showNodePropertiesDialog(nodeItem.node);
-                            mouse.accepted = true
-                        }
-                        onPressed: {
-                            // never handle undefined actions signals
-                            if (!(selectMoveAction.checked || deleteAction.checked)) {
-                                mouse.accepted = false
-                                return
-                            }
-                            if (deleteAction.checked) {
-                                deleteNode(nodeItem.node)
-                                mouse.accepted = true
-                                return
-                            }
-                            // single-node move action: directly handle it
-                            sceneAction.nodePressed = true
-                            if (selectMoveAction.checked && !nodeItem.highlighted) {
-                                scene.clearSelection()
-                                nodeItem.highlighted = true
-                                mouse.accepted = true
-                                return
-                            }
-                            // multi-node move action: gets handled by state-machine
-                            if (selectMoveAction.checked && nodeItem.highlighted) {
-                                mouse.accepted = false
-                                return
-                            }
-                        }
-                        onReleased: {
-                            sceneAction.nodePressed = false
-                        }
+                }
+                onCreateEdgeUpdateToNode: {
+                    var node = nodeLayer.nodeAt(sceneAction.lastMouseReleased)
+                    if (node) {
+                        addEdgeAction.to = node
                     }
                 }
             }
@@ -0,0 +1,691 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "edgelayeritem.h"
+#include "edgetype.h"
+#include "edgetypestyle.h"
+#include "node.h"
+#include "nodetype.h"
+#include "nodetypestyle.h"
+#include "graphdocument.h"
+#include "spatialgrid.h"
+#include "models/edgemodel.h"
+#include <QHash>
+#include <QPointer>
+#include <QSet>
+#include <QSGFlatColorMaterial>
+#include <QSGGeometryNode>
+#include <QVector2D>
+#include <algorithm>
+#include <cstring>
+
+using namespace GraphTheory;
+
+namespace
+{
+// two triangles for the line and one triangle for the arrow head
+const int verticesPerEdge = 9;
+const qreal halfLineWidth = 1;
+const qreal arrowBaseSize = 6;
+const qreal arrowPadding = 8; // distance from head to node center
+
+inline void setVertex(QSGGeometry::Point2D *vertex, const QPointF &point)
+{
+    vertex->set(point.x(), point.y());
+}
+
+/** distance of @p point to the line segment from @p from to @p to */
+qreal segmentDistance(const QPointF &point, const QPointF &from, const QPointF &to)
+{
+    const QVector2D axis(to - from);
+    const QVector2D offset(point - from);
+    const qreal lengthSquared = axis.lengthSquared();
+    if (lengthSquared == 0) {
+        return offset.length();
+    }
+    const qreal t = qBound<qreal>(0, QVector2D::dotProduct(offset, axis) / lengthSquared, 1);
+    return (offset - axis * t).length();
+}
+}
+
+class GraphTheory::EdgeLayerItemPrivate {
+public:
+    /** all culled edges of one edge type, drawn by one geometry node */
+    struct Batch {
+        EdgeTypePtr type;
+        QColor color;
+        QVector<EdgePtr> edges;
+        QVector<QSGGeometry::Point2D> vertices;
+        int dirtyFirst; //!< first vertex changed since last sync, -1 if clean
+        int dirtyLast;
+    };
+
+    EdgeLayerItemPrivate()
+        : m_origin(0, 0)
+        , m_aggregated(false)
+        , m_labelsVisible(true)
+        , m_labelsChanged(false)
+        , m_rebuild(false)
+        , m_cull(false)
+        , m_nodesDirty(true)
+    {
+    }
+
+    ~EdgeLayerItemPrivate()
+    {
+    }
+
+    bool isVisible(const EdgePtr &edge) const
+    {
+        return edge->isValid()
+            && edge->type()->style()->isVisible()
+            && edge->from()->type()->style()->isVisible()
+            && edge->to()->type()->style()->isVisible();
+    }
+
+    void writeEdge(Batch &batch, int slot)
+    {
+        const EdgePtr &edge = batch.edges.at(slot);
+        QSGGeometry::Point2D *vertex = batch.vertices.data() + slot * verticesPerEdge;
+        const QPointF from = QPointF(edge->from()->x(), edge->from()->y()) - m_origin;
+        const QPointF to = QPointF(edge->to()->x(), edge->to()->y()) - m_origin;
+        const QVector2D axis(to - from);
+        const qreal length = axis.length();
+
+        if (!isVisible(edge) || length == 0) { // degenerated triangles are not rasterized
+            for (int i = 0; i < verticesPerEdge; ++i) {
+                setVertex(vertex + i, from);
+            }
+        } else {
+            const QVector2D unit = axis / length;
+            const QPointF normal = QPointF(-unit.y(), unit.x()) * halfLineWidth;
+            setVertex(vertex + 0, from + normal);
+            setVertex(vertex + 1, from - normal);
+            setVertex(vertex + 2, to + normal);
+            setVertex(vertex + 3, to + normal);
+            setVertex(vertex + 4, from - normal);
+            setVertex(vertex + 5, to - normal);
+
+            // arrow head as in QSGArrowHeadNode
+            if (batch.type->direction() == EdgeType::Unidirectional) {
+                const QPointF normale = (unit * arrowBaseSize).toPointF();
+                const QPointF halfBaseLine(normale.y(), -normale.x());
+                const QPointF tip = to - (unit * arrowPadding).toPointF();
+                setVertex(vertex + 6, tip);
+                setVertex(vertex + 7, tip - 3 * normale + halfBaseLine);
+                setVertex(vertex + 8, tip - 3 * normale - halfBaseLine);
+            } else {
+                setVertex(vertex + 6, to);
+                setVertex(vertex + 7, to);
+                setVertex(vertex + 8, to);
+            }
+        }
+        const int first = slot * verticesPerEdge;
+        const int last = first + verticesPerEdge - 1;
+        batch.dirtyFirst = batch.dirtyFirst == -1 ? first : qMin(batch.dirtyFirst, first);
+        batch.dirtyLast = qMax(batch.dirtyLast, last);
+    }
+
+    /** @return bounding rectangle of line and arrow head of @p edge in global coordinates */
+    QRectF edgeRect(const Edge *edge) const
+    {
+        const QPointF from(edge->from()->x(), edge->from()->y());
+        const QPointF to(edge->to()->x(), edge->to()->y());
+        const qreal margin = halfLineWidth + arrowBaseSize;
+        return QRectF(from, to).normalized().adjusted(-margin, -margin, margin, margin);
+    }
+
+    /** @return @c true if both end points of @p edge are drawn as one aggregated point */
+    bool isAggregated(const Edge *edge) const
+    {
+        return m_grid.cell(QPointF(edge->from()->x(), edge->from()->y()))
+            == m_grid.cell(QPointF(edge->to()->x(), edge->to()->y()));
+    }
+
+    /** @return @c true if @p edge is close enough to the visible area to get vertices */
+    bool isInCulledArea(const Edge *edge) const
+    {
+        return m_culledArea.isEmpty() || m_culledArea.intersects(edgeRect(edge));
+    }
+
+    /**
+     * Register @p edge at the edge index and the grid, reusing the handle of a removed edge
+     * if possible.
+     */
+    void addEdge(const EdgePtr &edge)
+    {
+        int handle;
+        if (m_freeHandles.isEmpty()) {
+            handle = m_edges.count();
+            m_edges.append(edge);
+        } else {
+            handle = m_freeHandles.takeLast();
+            m_edges[handle] = edge;
+        }
+        m_index.insert(edge.data(), handle);
+        m_grid.insert(handle, edgeRect(edge.data()));
+    }
+
+    /**
+     * Remove @p edge from the edge index and the grid.
+     * @return @c true if the edge had vertices, such that the culled edges have to be recomputed
+     */
+    bool takeEdge(const Edge *edge)
+    {
+        const int handle = m_index.take(edge);
+        m_grid.remove(handle);
+        m_edges[handle].clear();
+        m_freeHandles.append(handle);
+        return m_slots.remove(edge) > 0;
+    }
+
+    /**
+     * Update grid and vertices of @p edge after its end points moved. Vertices are not written
+     * if @p cull is set, since they are recomputed anyway.
+     * @return @c true if the culled edges have to be recomputed
+     */
+    bool updateEdge(const Edge *edge, bool cull)
+    {
+        const int handle = m_index.value(edge, -1);
+        if (handle == -1) {
+            return cull;
+        }
+        const QRectF area = edgeRect(edge);
+        m_grid.insert(handle, area);
+        if (cull) {
+            return true;
+        }
+        const QPair<int, int> slot = m_slots.value(edge, qMakePair(-1, -1));
+        if (m_aggregated && (slot.first == -1) != isAggregated(edge)) {
+            // edge left or entered an aggregated cell
+            return true;
+        }
+        if (slot.first != -1) {
+            writeEdge(m_batches[slot.first], slot.second);
+            return false;
+        }
+        // edge entered the culled area
+        return m_culledArea.isEmpty() || m_culledArea.intersects(area);
+    }
+
+    /**
+     * Update grid and vertices of all edges incident to moved nodes.
+     * @return @c true if the culled edges have to be recomputed
+     */
+    bool moveEdges()
+    {
+        const NodeList moved = m_movedNodes;
+        m_movedNodes.clear();
+        bool cull = m_cull;
+        QSet<const Edge*> updated;
+        foreach (const NodePtr &node, moved) {
+            foreach (const EdgePtr &edge, node->edges()) {
+                if (updated.contains(edge.data())) {
+                    continue;
+                }
+                updated.insert(edge.data());
+                cull = updateEdge(edge.data(), cull);
+            }
+        }
+        return cull;
+    }
+
+    /** create vertices for all edges close to the visible area */
+    void cull()
+    {
+        m_nodesDirty = true;
+        m_slots.clear();
+        for (int b = 0; b < m_batches.count(); ++b) {
+            m_batches[b].edges.clear();
+            m_batches[b].dirtyFirst = -1;
+            m_batches[b].dirtyLast = -1;
+        }
+
+        QVector<int> culled;
+        if (m_visibleArea.isEmpty()) {
+            m_culledArea = QRectF();
+            culled.reserve(m_edges.count());
+            for (int i = 0; i < m_edges.count(); ++i) {
+                if (m_edges.at(i)) {
+                    culled.append(i);
+                }
+            }
+        } else {
+            // include half a visible area in each direction to avoid culling during scrolling
+            const QRectF visible = m_visibleArea.translated(m_origin);
+            m_culledArea = visible.adjusted(-visible.width() / 2, -visible.height() / 2,
+                                            visible.width() / 2, visible.height() / 2);
+            culled = m_grid.items(m_culledArea);
+            std::sort(culled.begin(), culled.end());
+        }
+
+        QVariantList labels;
+        foreach (int index, culled) {
+            const EdgePtr &edge = m_edges.at(index);
+            const int type = m_typeIndex.value(edge->type().data(), -1);
+            if (type == -1 || (m_aggregated && isAggregated(edge.data()))) {
+                continue;
+            }
+            Batch &batch = m_batches[type];
+            m_slots.insert(edge.data(), qMakePair(type, batch.edges.count()));
+            batch.edges.append(edge);
+            if (m_labelsVisible && !m_aggregated && isVisible(edge) && !edge->dynamicProperties().isEmpty()) {
+                labels.append(QVariant::fromValue<QObject*>(edge.data()));
+            }
+        }
+        for (int b = 0; b < m_batches.count(); ++b) {
+            Batch &batch = m_batches[b];
+            batch.vertices.resize(batch.edges.count() * verticesPerEdge);
+            for (int slot = 0; slot < batch.edges.count(); ++slot) {
+                writeEdge(batch, slot);
+            }
+        }
+
+        if (labels != m_labels) {
+            m_labels = labels;
+            m_labelsChanged = true;
+        }
+    }
+
+    QPointer<EdgeModel> m_model;
+    QPointF m_origin;
+    QRectF m_visibleArea;
+    QRectF m_culledArea; //!< global coordinates, empty if all edges are culled
+    bool m_aggregated;
+    bool m_labelsVisible;
+    QVariantList m_labels;
+    bool m_labelsChanged;
+    QVector<EdgePtr> m_edges; //!< indexed by handle, null for handles of removed edges
+    QVector<int> m_freeHandles;
+    QHash<const Edge*, int> m_index; //!< handle of each edge in m_edges and m_grid
+    QHash<Node*, int> m_nodeEdges; //!< number of indexed edges at each end point
+    QHash<const EdgeType*, int> m_typeIndex; //!< batch of each edge type
+    SpatialGrid m_grid;
+    QVector<Batch> m_batches;
+    QHash<const Edge*, QPair<int, int> > m_slots; //!< batch and slot of each culled edge
+    QPointer<GraphDocument> m_document; //!< document of the last rebuild
+    NodeList m_movedNodes; //!< nodes moved since last polish
+    bool m_rebuild; //!< edge index must be rebuilt at next polish
+    bool m_cull; //!< vertex buffers must be rebuilt at next polish
+    bool m_nodesDirty; //!< scene graph nodes must be recreated at next sync
+};
+
+EdgeLayerItem::EdgeLayerItem(QQuickItem *parent)
+    : QQuickItem(parent)
+    , d(new EdgeLayerItemPrivate)
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+}
+
+EdgeLayerItem::~EdgeLayerItem()
+{
+
+}
+
+EdgeModel * EdgeLayerItem::model() const
+{
+    return d->m_model;
+}
+
+void EdgeLayerItem::setModel(EdgeModel *model)
+{
+    if (d->m_model == model) {
+        return;
+    }
+    if (d->m_model) {
+        d->m_model->disconnect(this);
+    }
+    d->m_model = model;
+    if (model) {
+        connect(model, &EdgeModel::modelReset, this, &EdgeLayerItem::scheduleRebuild);
+        // edges are addressed by handles and not by rows, hence moved rows need no update
+        connect(model, &EdgeModel::rowsInserted, this, &EdgeLayerItem::insertEdges);
+        connect(model, &EdgeModel::rowsAboutToBeRemoved, this, &EdgeLayerItem::removeEdges);
+        connect(model, &EdgeModel::dataChanged, this, &EdgeLayerItem::updateEdges);
+    }
+    scheduleRebuild();
+    emit modelChanged();
+}
+
+QPointF EdgeLayerItem::origin() const
+{
+    return d->m_origin;
+}
+
+void EdgeLayerItem::setOrigin(const QPointF &origin)
+{
+    if (d->m_origin == origin) {
+        return;
+    }
+    d->m_origin = origin;
+    scheduleCulling();
+    emit originChanged();
+}
+
+QRectF EdgeLayerItem::visibleArea() const
+{
+    return d->m_visibleArea;
+}
+
+void EdgeLayerItem::setVisibleArea(const QRectF &area)
+{
+    if (d->m_visibleArea == area) {
+        return;
+    }
+    d->m_visibleArea = area;
+    // re-cull only if the visible area leaves the culled area
+    if (area.isEmpty() || d->m_culledArea.isEmpty() || !d->m_culledArea.contains(area.translated(d->m_origin))) {
+        scheduleCulling();
+    }
+    emit visibleAreaChanged();
+}
+
+bool EdgeLayerItem::isAggregated() const
+{
+    return d->m_aggregated;
+}
+
+void EdgeLayerItem::setAggregated(bool aggregated)
+{
+    if (d->m_aggregated == aggregated) {
+        return;
+    }
+    d->m_aggregated = aggregated;
+    scheduleCulling();
+    emit aggregatedChanged();
+}
+
+bool EdgeLayerItem::labelsVisible() const
+{
+    return d->m_labelsVisible;
+}
+
+void EdgeLayerItem::setLabelsVisible(bool visible)
+{
+    if (d->m_labelsVisible == visible) {
+        return;
+    }
+    d->m_labelsVisible = visible;
+    scheduleCulling();
+    emit labelsVisibleChanged();
+}
+
+QVariantList EdgeLayerItem::labelEdges() const
+{
+    return d->m_labels;
+}
+
+Edge * EdgeLayerItem::edgeAt(const QPointF &point, qreal tolerance) const
+{
+    Edge *closest = 0;
+    qreal closestDistance = tolerance;
+    const QPointF global = point + d->m_origin;
+    const QRectF area(global.x() - tolerance, global.y() - tolerance, 2 * tolerance, 2 * tolerance);
+    foreach (int index, d->m_grid.items(area)) {
+        const EdgePtr &edge = d->m_edges.at(index);
+        if (!d->m_slots.contains(edge.data()) || !d->isVisible(edge)) {
+            continue;
+        }
+        const QPointF from(edge->from()->x(), edge->from()->y());
+        const QPointF to(edge->to()->x(), edge->to()->y());
+        const qreal distance = segmentDistance(global, from, to);
+        if (distance <= closestDistance) {
+            closest = edge.data();
+            closestDistance = distance;
+        }
+    }
+    return closest;
+}
+
+void EdgeLayerItem::scheduleRebuild()
+{
+    d->m_rebuild = true;
+    scheduleCulling();
+}
+
+void EdgeLayerItem::scheduleCulling()
+{
+    d->m_cull = true;
+    polish();
+    update();
+}
+
+void EdgeLayerItem::updateNodePositions(const NodeList &nodes)
+{
+    if (d->m_rebuild) {
+        return;
+    }
+    // edge geometry is updated at the next polish, such that edges between moved nodes
+    // and edges of nodes moving several times per frame are written once
+    d->m_movedNodes.append(nodes);
+    polish();
+}
+
+void EdgeLayerItem::insertEdges(const QModelIndex &parent, int first, int last)
+{
+    Q_UNUSED(parent);
+    if (d->m_rebuild || !d->m_document) {
+        return;
+    }
+    const EdgeList edges = d->m_document->edges();
+    bool cull = false;
+    for (int i = first; i <= last; ++i) {
+        const EdgePtr &edge = edges.at(i);
+        d->addEdge(edge);
+        watchEdge(edge);
+        cull = cull || d->isInCulledArea(edge.data());
+    }
+    if (cull) {
+        scheduleCulling();
+    }
+}
+
+void EdgeLayerItem::removeEdges(const QModelIndex &parent, int first, int last)
+{
+    Q_UNUSED(parent);
+    if (d->m_rebuild || !d->m_document) {
+        return;
+    }
+    // the edges are still contained in the document when their rows are about to be removed
+    const EdgeList edges = d->m_document->edges();
+    bool cull = false;
+    for (int i = first; i <= last; ++i) {
+        const EdgePtr &edge = edges.at(i);
+        if (!d->m_index.contains(edge.data())) {
+            continue;
+        }
+        unwatchEdge(edge);
+        cull = d->takeEdge(edge.data()) || cull;
+    }
+    if (cull) {
+        scheduleCulling();
+    }
+}
+
+void EdgeLayerItem::updateEdges(const QModelIndex &topLeft, const QModelIndex &bottomRight)
+{
+    if (d->m_rebuild || !d->m_document) {
+        return;
+    }
+    const EdgeList edges = d->m_document->edges();
+    bool cull = d->m_cull;
+    for (int i = topLeft.row(); i <= bottomRight.row(); ++i) {
+        cull = d->updateEdge(edges.at(i).data(), cull);
+    }
+    if (cull) {
+        scheduleCulling();
+    } else {
+        update();
+    }
+}
+
+void EdgeLayerItem::watchEdge(const EdgePtr &edge)
+{
+    connect(edge.data(), &Edge::typeChanged, this, &EdgeLayerItem::scheduleCulling);
+    const NodePtr ends[] = { edge->from(), edge->to() };
+    for (const NodePtr &node : ends) {
+        if (d->m_nodeEdges[node.data()]++ == 0) {
+            connect(node.data(), &Node::typeChanged, this, &EdgeLayerItem::scheduleCulling);
+        }
+    }
+}
+
+void EdgeLayerItem::unwatchEdge(const EdgePtr &edge)
+{
+    disconnect(edge.data(), &Edge::typeChanged, this, &EdgeLayerItem::scheduleCulling);
+    const NodePtr ends[] = { edge->from(), edge->to() };
+    for (const NodePtr &node : ends) {
+        if (--d->m_nodeEdges[node.data()] == 0) {
+            d->m_nodeEdges.remove(node.data());
+            disconnect(node.data(), &Node::typeChanged, this, &EdgeLayerItem::scheduleCulling);
+        }
+    }
+}
+
+void EdgeLayerItem::updatePolish()
+{
+    if (!d->m_movedNodes.isEmpty() && !d->m_rebuild) {
+        if (d->moveEdges()) {
+            d->m_cull = true;
+        }
+        update();
+    }
+    d->m_movedNodes.clear();
+
+    if (d->m_rebuild) {
+        d->m_rebuild = false;
+        foreach (const EdgePtr &edge, d->m_edges) {
+            if (edge) {
+                disconnect(edge.data(), &Edge::typeChanged, this, &EdgeLayerItem::scheduleCulling);
+            }
+        }
+        foreach (Node *node, d->m_nodeEdges.keys()) {
+            disconnect(node, &Node::typeChanged, this, &EdgeLayerItem::scheduleCulling);
+        }
+        d->m_batches.clear();
+        d->m_edges.clear();
+        d->m_freeHandles.clear();
+        d->m_index.clear();
+        d->m_nodeEdges.clear();
+        d->m_typeIndex.clear();
+        d->m_grid.clear();
+
+        const GraphDocumentPtr document = d->m_model ? d->m_model->document() : GraphDocumentPtr();
+        if (d->m_document != document.data()) {
+            if (d->m_document) {
+                d->m_document->disconnect(this);
+            }
+            d->m_document = document.data();
+            if (document) {
+                connect(document.data(), &GraphDocument::nodePositionsChanged, this, &EdgeLayerItem::updateNodePositions);
+                connect(document.data(), &GraphDocument::edgeTypeAdded, this, &EdgeLayerItem::scheduleRebuild);
+                connect(document.data(), &GraphDocument::edgeTypesRemoved, this, &EdgeLayerItem::scheduleRebuild);
+                connect(document.data(), &GraphDocument::nodeTypeAdded, this, &EdgeLayerItem::scheduleRebuild);
+            }
+        }
+        if (document) {
+            // style changes of types rarely happen, hence they trigger a complete rebuild
+            foreach (const EdgeTypePtr &type, document->edgeTypes()) {
+                d->m_typeIndex.insert(type.data(), d->m_batches.count());
+                EdgeLayerItemPrivate::Batch batch;
+                batch.type = type;
+                batch.color = type->style()->color();
+                batch.dirtyFirst = -1;
+                batch.dirtyLast = -1;
+                d->m_batches.append(batch);
+                connect(type.data(), &EdgeType::directionChanged, this, &EdgeLayerItem::scheduleRebuild, Qt::UniqueConnection);
+                connect(type->style(), &EdgeTypeStyle::changed, this, &EdgeLayerItem::scheduleRebuild, Qt::UniqueConnection);
+                connect(type.data(), &EdgeType::dynamicPropertyAdded, this, &EdgeLayerItem::scheduleCulling, Qt::UniqueConnection);
+                connect(type.data(), &EdgeType::dynamicPropertyRemoved, this, &EdgeLayerItem::scheduleCulling, Qt::UniqueConnection);
+            }
+            foreach (const NodeTypePtr &type, document->nodeTypes()) {
+                connect(type->style(), &NodeTypeStyle::changed, this, &EdgeLayerItem::scheduleCulling, Qt::UniqueConnection);
+            }
+
+            // the model announces edges of an open batch only when the batch is closed
+            const EdgeList edges = document->edges();
+            const int count = qMin(edges.count(), d->m_model->rowCount());
+            d->m_edges.reserve(count);
+            for (int i = 0; i < count; ++i) {
+                d->addEdge(edges.at(i));
+                watchEdge(edges.at(i));
+            }
+        }
+    }
+
+    if (d->m_cull) {
+        d->m_cull = false;
+        d->cull();
+        if (d->m_labelsChanged) {
+            d->m_labelsChanged = false;
+            emit labelEdgesChanged();
+        }
+    }
+}
+
+QSGNode * EdgeLayerItem::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *)
+{
+    QSGNode *root = node;
+    if (!root) {
+        root = new QSGNode;
+        d->m_nodesDirty = true;
+    }
+
+    if (d->m_nodesDirty) {
+        while (QSGNode *child = root->firstChild()) {
+            root->removeChildNode(child);
+            delete child;
+        }
+        foreach (const EdgeLayerItemPrivate::Batch &batch, d->m_batches) {
+            QSGGeometry *geometry = new QSGGeometry(QSGGeometry::defaultAttributes_Point2D(), batch.vertices.count());
+            geometry->setDrawingMode(GL_TRIANGLES);
+            QSGFlatColorMaterial *material = new QSGFlatColorMaterial;
+            material->setColor(batch.color);
+            QSGGeometryNode *batchNode = new QSGGeometryNode;
+            batchNode->setGeometry(geometry);
+            batchNode->setMaterial(material);
+            batchNode->setFlags(QSGNode::OwnsGeometry | QSGNode::OwnsMaterial);
+            root->appendChildNode(batchNode);
+        }
+        for (int b = 0; b < d->m_batches.count(); ++b) {
+            d->m_batches[b].dirtyFirst = 0;
+            d->m_batches[b].dirtyLast = d->m_batches[b].vertices.count() - 1;
+        }
+        d->m_nodesDirty = false;
+    }
+
+    // copy only the vertices changed since the last frame
+    QSGNode *child = root->firstChild();
+    for (int b = 0; b < d->m_batches.count() && child; ++b, child = child->nextSibling()) {
+        EdgeLayerItemPrivate::Batch &batch = d->m_batches[b];
+        if (batch.dirtyFirst == -1 || batch.dirtyLast < batch.dirtyFirst) {
+            batch.dirtyFirst = -1;
+            continue;
+        }
+        QSGGeometryNode *batchNode = static_cast<QSGGeometryNode*>(child);
+        std::memcpy(batchNode->geometry()->vertexDataAsPoint2D() + batch.dirtyFirst,
+                    batch.vertices.constData() + batch.dirtyFirst,
+                    (batch.dirtyLast - batch.dirtyFirst + 1) * sizeof(QSGGeometry::Point2D));
+        batchNode->markDirty(QSGNode::DirtyGeometry);
+        batch.dirtyFirst = -1;
+        batch.dirtyLast = -1;
+    }
+    return root;
+}
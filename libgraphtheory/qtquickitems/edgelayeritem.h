@@ -0,0 +1,121 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EDGELAYERITEM_H
+#define EDGELAYERITEM_H
+
+#include "graphtheory_export.h"
+#include "edge.h"
+#include <QModelIndex>
+#include <QQuickItem>
+#include <QVariantList>
+
+class QSGNode;
+
+namespace GraphTheory
+{
+class EdgeModel;
+class EdgeLayerItemPrivate;
+
+/**
+ * \class EdgeLayerItem
+ * Renders all edges of an EdgeModel with one scene graph node per edge type. Each edge is
+ * drawn as two triangles for the line plus one triangle for the arrow head, such that lines
+ * and arrow heads of one type end up in the same batch. Node movements are collected from
+ * GraphDocument::nodePositionsChanged() and only update the vertices of the incident edges,
+ * once per frame. Edges inserted into or removed from the model are added to or taken from
+ * the edge index in place; only model resets and changes of types rebuild the index.
+ *
+ * Edges are registered with their bounding rectangles at a SpatialGrid and only edges close
+ * to visibleArea get vertices. In aggregated mode, edges whose end points lie in the same
+ * grid cell are omitted, since the node layer draws such nodes as one point.
+ */
+class EdgeLayerItem : public QQuickItem
+{
+    Q_OBJECT
+    Q_PROPERTY(GraphTheory::EdgeModel * model READ model WRITE setModel NOTIFY modelChanged)
+    Q_PROPERTY(QPointF origin READ origin WRITE setOrigin NOTIFY originChanged)
+    Q_PROPERTY(QRectF visibleArea READ visibleArea WRITE setVisibleArea NOTIFY visibleAreaChanged)
+    Q_PROPERTY(bool aggregated READ isAggregated WRITE setAggregated NOTIFY aggregatedChanged)
+    Q_PROPERTY(bool labelsVisible READ labelsVisible WRITE setLabelsVisible NOTIFY labelsVisibleChanged)
+    Q_PROPERTY(QVariantList labelEdges READ labelEdges NOTIFY labelEdgesChanged)
+
+public:
+    explicit EdgeLayerItem(QQuickItem *parent = 0);
+    virtual ~EdgeLayerItem();
+    EdgeModel * model() const;
+    void setModel(EdgeModel *model);
+    /** translation of global origin (0,0) into scene coordinates **/
+    QPointF origin() const;
+    /** set translation of global origin (0,0) into scene coordinates **/
+    void setOrigin(const QPointF &origin);
+    /**
+     * @return area in item coordinates that is shown to the user, an empty area means that
+     *         all edges are shown
+     */
+    QRectF visibleArea() const;
+    void setVisibleArea(const QRectF &area);
+    /**
+     * @return @c true if edges within one grid cell are omitted
+     */
+    bool isAggregated() const;
+    void setAggregated(bool aggregated);
+    bool labelsVisible() const;
+    void setLabelsVisible(bool visible);
+    /**
+     * @return edges near the visible area that have dynamic properties, if labels are visible
+     *         and the layer is not aggregated; otherwise an empty list
+     */
+    QVariantList labelEdges() const;
+    /**
+     * @return the visible edge closest to @p point (in item coordinates) if its distance is at
+     *         most @p tolerance, otherwise 0
+     */
+    Q_INVOKABLE GraphTheory::Edge * edgeAt(const QPointF &point, qreal tolerance = 4) const;
+
+protected:
+    virtual void updatePolish() Q_DECL_OVERRIDE;
+    virtual QSGNode * updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) Q_DECL_OVERRIDE;
+
+Q_SIGNALS:
+    void modelChanged();
+    void originChanged();
+    void visibleAreaChanged();
+    void aggregatedChanged();
+    void labelsVisibleChanged();
+    void labelEdgesChanged();
+
+private Q_SLOTS:
+    void scheduleRebuild();
+    void scheduleCulling();
+    void updateNodePositions(const GraphTheory::NodeList &nodes);
+    void insertEdges(const QModelIndex &parent, int first, int last);
+    void removeEdges(const QModelIndex &parent, int first, int last);
+    void updateEdges(const QModelIndex &topLeft, const QModelIndex &bottomRight);
+
+private:
+    Q_DISABLE_COPY(EdgeLayerItem)
+    void watchEdge(const EdgePtr &edge);
+    void unwatchEdge(const EdgePtr &edge);
+    const QScopedPointer<EdgeLayerItemPrivate> d;
+};
+}
+
+#endif
@@ -161,8 +161,7 @@ void NodeItem::updatePositionfromScene()
         return;
     }
     d->m_updating = true;
-    d->m_node->setX(x() + d->m_origin.x() + width()/2);
-    d->m_node->setY(y() + d->m_origin.y() + height()/2);
+    d->m_node->setPosition(QPointF(x() + d->m_origin.x() + width()/2, y() + d->m_origin.y() + height()/2));
     d->m_updating = false;
 }
 
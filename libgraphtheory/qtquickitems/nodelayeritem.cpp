@@ -0,0 +1,737 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "nodelayeritem.h"
+#include "nodetype.h"
+#include "nodetypestyle.h"
+#include "graphdocument.h"
+#include "qsgcirclematerial.h"
+#include "models/nodemodel.h"
+#include "models/nodeselectionmodel.h"
+#include <QHash>
+#include <QPointer>
+#include <QSGGeometryNode>
+#include <QtMath>
+#include <cstring>
+
+using namespace GraphTheory;
+
+namespace
+{
+const int verticesPerNode = 6;
+// quads extend the circle by one pixel for antialiasing
+const qreal quadRadius = QSGCircleMaterial::radius + 1;
+// edge length of the square cells whose nodes are drawn as one point in aggregated mode
+const qreal aggregationCellSize = 128;
+}
+
+class GraphTheory::NodeLayerItemPrivate {
+public:
+    /** all culled nodes of one node type, drawn by one geometry node */
+    struct Batch {
+        QVector<NodePtr> nodes; //!< empty in aggregated mode
+        QVector<QSGCircleMaterial::Vertex> vertices;
+        int dirtyFirst; //!< first vertex changed since last sync, -1 if clean
+        int dirtyLast;
+    };
+
+    NodeLayerItemPrivate()
+        : m_selection(0)
+        , m_origin(0, 0)
+        , m_aggregated(false)
+        , m_labelsVisible(true)
+        , m_labelsChanged(false)
+        , m_rebuild(false)
+        , m_cull(false)
+        , m_nodesDirty(true)
+    {
+    }
+
+    ~NodeLayerItemPrivate()
+    {
+    }
+
+    bool isVisible(const NodePtr &node) const
+    {
+        return node->isValid() && node->type()->style()->isVisible();
+    }
+
+    static void writeCircle(QSGCircleMaterial::Vertex *vertex, const QPointF &center,
+                            const QColor &fill, const QColor &border, bool highlighted)
+    {
+        const qreal corners[verticesPerNode][2] = {
+            { -1, -1 }, { 1, -1 }, { -1, 1 },
+            { -1, 1 }, { 1, -1 }, { 1, 1 }
+        };
+        for (int i = 0; i < verticesPerNode; ++i) {
+            const qreal u = corners[i][0] * quadRadius;
+            const qreal v = corners[i][1] * quadRadius;
+            vertex[i].set(center.x() + u, center.y() + v, u, v, fill, border, highlighted);
+        }
+    }
+
+    static void markDirty(Batch &batch, int first, int last)
+    {
+        batch.dirtyFirst = batch.dirtyFirst == -1 ? first : qMin(batch.dirtyFirst, first);
+        batch.dirtyLast = qMax(batch.dirtyLast, last);
+    }
+
+    void writeNode(Batch &batch, int slot)
+    {
+        const NodePtr &node = batch.nodes.at(slot);
+        QSGCircleMaterial::Vertex *vertex = batch.vertices.data() + slot * verticesPerNode;
+        const QPointF center = QPointF(node->x(), node->y()) - m_origin;
+        if (!isVisible(node)) { // degenerated triangles are not rasterized
+            for (int i = 0; i < verticesPerNode; ++i) {
+                vertex[i].set(center.x(), center.y(), 0, 0, Qt::transparent, Qt::transparent, false);
+            }
+        } else {
+            writeCircle(vertex, center, node->color(), node->type()->style()->color(),
+                        m_selection->isSelected(node.data()));
+        }
+        markDirty(batch, slot * verticesPerNode, (slot + 1) * verticesPerNode - 1);
+    }
+
+    void writeNode(const Node *node)
+    {
+        const QPair<int, int> slot = m_slots.value(node, qMakePair(-1, -1));
+        if (slot.first != -1) {
+            writeNode(m_batches[slot.first], slot.second);
+        }
+    }
+
+    /** @return area of node circle of @p node in global coordinates */
+    QRectF nodeRect(const Node *node) const
+    {
+        const qreal r = QSGCircleMaterial::radius;
+        return QRectF(node->x() - r, node->y() - r, 2 * r, 2 * r);
+    }
+
+    /** @return @c true if @p node is contained in m_nodes */
+    bool isIndexed(const Node *node) const
+    {
+        const int index = node->documentIndex();
+        return index >= 0 && index < m_nodes.count() && m_nodes.at(index).data() == node;
+    }
+
+    /** @return indices in m_nodes of all nodes whose circle intersects @p area (global coordinates), sorted */
+    QVector<int> nodesIn(const QRectF &area) const
+    {
+        QVector<int> result;
+        const GraphDocumentPtr document = m_model ? m_model->document() : GraphDocumentPtr();
+        if (!document) {
+            return result;
+        }
+        const qreal r = QSGCircleMaterial::radius;
+        const NodeList nodes = document->nodesAt(area.adjusted(-r, -r, r, r));
+        result.reserve(nodes.count());
+        foreach (const NodePtr &node, nodes) {
+            if (isIndexed(node.data())) {
+                result.append(node->documentIndex());
+            }
+        }
+        return result;
+    }
+
+    /** create vertices for all nodes close to the visible area */
+    void cull()
+    {
+        m_nodesDirty = true;
+        m_slots.clear();
+        m_batches.fill(Batch(), m_types.count());
+
+        QVector<int> culled;
+        if (m_visibleArea.isEmpty()) {
+            m_culledArea = QRectF();
+            culled.reserve(m_nodes.count());
+            for (int i = 0; i < m_nodes.count(); ++i) {
+                culled.append(i);
+            }
+        } else {
+            // include half a visible area in each direction to avoid culling during scrolling
+            const QRectF visible = m_visibleArea.translated(m_origin);
+            m_culledArea = visible.adjusted(-visible.width() / 2, -visible.height() / 2,
+                                            visible.width() / 2, visible.height() / 2);
+            culled = nodesIn(m_culledArea);
+        }
+
+        QVariantList labels;
+        if (!m_aggregated) {
+            foreach (int index, culled) {
+                const NodePtr &node = m_nodes.at(index);
+                const int type = m_types.indexOf(node->type());
+                if (type == -1) {
+                    continue;
+                }
+                Batch &batch = m_batches[type];
+                m_slots.insert(node.data(), qMakePair(type, batch.nodes.count()));
+                batch.nodes.append(node);
+                if (m_labelsVisible && isVisible(node) && !node->dynamicProperties().isEmpty()) {
+                    labels.append(QVariant::fromValue<QObject*>(node.data()));
+                }
+            }
+            for (int type = 0; type < m_batches.count(); ++type) {
+                Batch &batch = m_batches[type];
+                batch.dirtyFirst = -1;
+                batch.dirtyLast = -1;
+                batch.vertices.resize(batch.nodes.count() * verticesPerNode);
+                for (int slot = 0; slot < batch.nodes.count(); ++slot) {
+                    writeNode(batch, slot);
+                }
+            }
+        } else {
+            aggregate(culled);
+        }
+
+        if (labels != m_labels) {
+            m_labels = labels;
+            m_labelsChanged = true;
+        }
+    }
+
+    /** one point per node type and grid cell at the centroid of the culled nodes */
+    void aggregate(const QVector<int> &culled)
+    {
+        struct Cluster {
+            QPointF sum;
+            int count;
+            QColor fill;
+            bool highlighted;
+        };
+        QVector<QHash<quint64, Cluster> > clusters(m_types.count());
+        foreach (int index, culled) {
+            const NodePtr &node = m_nodes.at(index);
+            const int type = m_types.indexOf(node->type());
+            if (type == -1 || !isVisible(node)) {
+                continue;
+            }
+            const QPoint cell(qFloor(node->x() / aggregationCellSize), qFloor(node->y() / aggregationCellSize));
+            const quint64 key = (quint64(quint32(cell.x())) << 32) | quint64(quint32(cell.y()));
+            Cluster &cluster = clusters[type][key];
+            if (cluster.count == 0) {
+                cluster.fill = node->color();
+                cluster.highlighted = false;
+            }
+            cluster.sum += QPointF(node->x(), node->y());
+            ++cluster.count;
+            cluster.highlighted = cluster.highlighted || m_selection->isSelected(node.data());
+        }
+        for (int type = 0; type < m_types.count(); ++type) {
+            Batch &batch = m_batches[type];
+            batch.vertices.resize(clusters.at(type).count() * verticesPerNode);
+            const QColor border = m_types.at(type)->style()->color();
+            int slot = 0;
+            foreach (const Cluster &cluster, clusters.at(type)) {
+                writeCircle(batch.vertices.data() + slot * verticesPerNode,
+                            cluster.sum / cluster.count - m_origin, cluster.fill, border,
+                            cluster.highlighted);
+                ++slot;
+            }
+            batch.dirtyFirst = batch.vertices.isEmpty() ? -1 : 0;
+            batch.dirtyLast = batch.vertices.count() - 1;
+        }
+    }
+
+    NodeSelectionModel *m_selection;
+    QPointer<NodeModel> m_model;
+    QPointer<GraphDocument> m_document; //!< document of the last rebuild
+    QPointF m_origin;
+    QRectF m_nodesRect;
+    QRectF m_visibleArea;
+    QRectF m_culledArea; //!< global coordinates, empty if all nodes are culled
+    bool m_aggregated;
+    bool m_labelsVisible;
+    QVariantList m_labels;
+    bool m_labelsChanged;
+    QVector<NodePtr> m_nodes;
+    QVector<NodeTypePtr> m_types;
+    QVector<Batch> m_batches;
+    QHash<const Node*, QPair<int, int> > m_slots; //!< batch and slot of each culled node
+    QHash<const Node*, QPointF> m_moveStart;
+    bool m_rebuild; //!< node index must be rebuilt at next polish
+    bool m_cull; //!< vertex buffers must be rebuilt at next polish
+    bool m_nodesDirty; //!< scene graph nodes must be recreated at next sync
+};
+
+NodeLayerItem::NodeLayerItem(QQuickItem *parent)
+    : QQuickItem(parent)
+    , d(new NodeLayerItemPrivate)
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+    d->m_selection = new NodeSelectionModel(this);
+    connect(d->m_selection, &NodeSelectionModel::selectionChanged, this, &NodeLayerItem::updateHighlight);
+}
+
+NodeLayerItem::~NodeLayerItem()
+{
+
+}
+
+NodeModel * NodeLayerItem::model() const
+{
+    return d->m_model;
+}
+
+void NodeLayerItem::setModel(NodeModel *model)
+{
+    if (d->m_model == model) {
+        return;
+    }
+    if (d->m_model) {
+        d->m_model->disconnect(this);
+    }
+    d->m_model = model;
+    d->m_selection->setDocument(model ? model->document() : GraphDocumentPtr());
+    d->m_moveStart.clear();
+    if (model) {
+        connect(model, &NodeModel::modelReset, this, &NodeLayerItem::scheduleRebuild);
+        connect(model, &NodeModel::rowsInserted, this, &NodeLayerItem::insertNodes);
+        connect(model, &NodeModel::rowsAboutToBeRemoved, this, &NodeLayerItem::removeNodes);
+        // the row move that follows a removal is already covered by fillRemovedRows()
+        connect(model, &NodeModel::rowsRemoved, this, &NodeLayerItem::fillRemovedRows);
+    }
+    scheduleRebuild();
+    emit modelChanged();
+}
+
+QPointF NodeLayerItem::origin() const
+{
+    return d->m_origin;
+}
+
+void NodeLayerItem::setOrigin(const QPointF &origin)
+{
+    if (d->m_origin == origin) {
+        return;
+    }
+    d->m_origin = origin;
+    scheduleCulling();
+    emit originChanged();
+}
+
+QRectF NodeLayerItem::nodesRect() const
+{
+    return d->m_nodesRect;
+}
+
+QRectF NodeLayerItem::visibleArea() const
+{
+    return d->m_visibleArea;
+}
+
+void NodeLayerItem::setVisibleArea(const QRectF &area)
+{
+    if (d->m_visibleArea == area) {
+        return;
+    }
+    d->m_visibleArea = area;
+    // re-cull only if the visible area leaves the culled area
+    if (area.isEmpty() || d->m_culledArea.isEmpty() || !d->m_culledArea.contains(area.translated(d->m_origin))) {
+        scheduleCulling();
+    }
+    emit visibleAreaChanged();
+}
+
+bool NodeLayerItem::isAggregated() const
+{
+    return d->m_aggregated;
+}
+
+void NodeLayerItem::setAggregated(bool aggregated)
+{
+    if (d->m_aggregated == aggregated) {
+        return;
+    }
+    d->m_aggregated = aggregated;
+    scheduleCulling();
+    emit aggregatedChanged();
+}
+
+bool NodeLayerItem::labelsVisible() const
+{
+    return d->m_labelsVisible;
+}
+
+void NodeLayerItem::setLabelsVisible(bool visible)
+{
+    if (d->m_labelsVisible == visible) {
+        return;
+    }
+    d->m_labelsVisible = visible;
+    scheduleCulling();
+    emit labelsVisibleChanged();
+}
+
+QVariantList NodeLayerItem::labelNodes() const
+{
+    return d->m_labels;
+}
+
+NodeSelectionModel * NodeLayerItem::selectionModel() const
+{
+    return d->m_selection;
+}
+
+Node * NodeLayerItem::nodeAt(const QPointF &point) const
+{
+    const GraphDocumentPtr document = d->m_model ? d->m_model->document() : GraphDocumentPtr();
+    if (!document) {
+        return 0;
+    }
+    const QPointF global = point + d->m_origin;
+    const qreal r = QSGCircleMaterial::radius;
+    const NodeList candidates = document->nodesAt(QRectF(global.x() - r, global.y() - r, 2 * r, 2 * r));
+    for (int i = candidates.count() - 1; i >= 0; --i) {
+        const NodePtr &node = candidates.at(i);
+        const qreal dx = global.x() - node->x();
+        const qreal dy = global.y() - node->y();
+        if (dx * dx + dy * dy < r * r && d->isVisible(node)) {
+            return node.data();
+        }
+    }
+    return 0;
+}
+
+bool NodeLayerItem::isHighlighted(Node *node) const
+{
+    return d->m_selection->isSelected(node);
+}
+
+void NodeLayerItem::setHighlighted(Node *node, bool highlighted)
+{
+    if (!node) {
+        return;
+    }
+    d->m_selection->setSelected(node->self(), highlighted);
+}
+
+void NodeLayerItem::clearHighlight()
+{
+    d->m_selection->clear();
+}
+
+void NodeLayerItem::highlightRect(const QRectF &rect)
+{
+    const GraphDocumentPtr document = d->m_model ? d->m_model->document() : GraphDocumentPtr();
+    if (!document) {
+        return;
+    }
+    // test top left corner of bounding square: the circle center must lie in the shifted area
+    const qreal r = QSGCircleMaterial::radius;
+    const QRectF area = rect.normalized().translated(d->m_origin + QPointF(r, r));
+    NodeList nodes;
+    foreach (const NodePtr &node, document->nodesAt(area)) {
+        if (d->isVisible(node)) {
+            nodes.append(node);
+        }
+    }
+    d->m_selection->setSelection(nodes);
+}
+
+QVariantList NodeLayerItem::highlightedNodes() const
+{
+    QVariantList nodes;
+    foreach (const NodePtr &node, d->m_selection->selectedNodes()) {
+        if (node->isValid()) {
+            nodes.append(QVariant::fromValue<QObject*>(node.data()));
+        }
+    }
+    return nodes;
+}
+
+void NodeLayerItem::startMoveHighlighted()
+{
+    d->m_moveStart.clear();
+    foreach (const NodePtr &node, d->m_selection->selectedNodes()) {
+        d->m_moveStart.insert(node.data(), QPointF(node->x(), node->y()));
+    }
+}
+
+void NodeLayerItem::moveHighlighted(const QPointF &delta)
+{
+    const GraphDocumentPtr document = d->m_selection->document();
+    if (!document) {
+        return;
+    }
+    // announce all movements at once
+    BatchGuard batch(document);
+    foreach (const NodePtr &node, d->m_selection->selectedNodes()) {
+        if (!d->m_moveStart.contains(node.data()) || !node->isValid()) {
+            continue;
+        }
+        node->setPosition(d->m_moveStart.value(node.data()) + delta);
+    }
+}
+
+void NodeLayerItem::scheduleRebuild()
+{
+    d->m_rebuild = true;
+    scheduleCulling();
+}
+
+void NodeLayerItem::scheduleCulling()
+{
+    d->m_cull = true;
+    polish();
+    update();
+}
+
+void NodeLayerItem::updateNode()
+{
+    const Node *node = qobject_cast<Node*>(sender());
+    if (node) {
+        updateNodes(NodeList() << node->self());
+    }
+}
+
+void NodeLayerItem::updateNodes(const NodeList &nodes)
+{
+    if (d->m_rebuild) {
+        return;
+    }
+    const QRectF previousRect = d->m_nodesRect;
+    bool changed = false;
+    bool cull = false;
+    foreach (const NodePtr &node, nodes) {
+        if (!d->isIndexed(node.data())) {
+            continue;
+        }
+        const QRectF area = d->nodeRect(node.data());
+        if (!d->m_nodesRect.contains(area)) {
+            d->m_nodesRect |= area;
+        }
+        if (d->m_cull || cull) {
+            continue;
+        }
+        if (d->m_slots.contains(node.data())) {
+            d->writeNode(node.data());
+            changed = true;
+        } else if (d->m_aggregated || d->m_culledArea.isEmpty() || d->m_culledArea.intersects(area)) {
+            // node entered the culled area or changed an aggregated point
+            cull = true;
+        }
+    }
+    if (d->m_nodesRect != previousRect) {
+        emit nodesRectChanged();
+    }
+    if (cull) {
+        scheduleCulling();
+    } else if (changed) {
+        update();
+    }
+}
+
+void NodeLayerItem::updateHighlight(const NodeList &selected, const NodeList &deselected)
+{
+    if (d->m_aggregated) {
+        scheduleCulling();
+    } else {
+        foreach (const NodePtr &node, selected) {
+            d->writeNode(node.data());
+        }
+        foreach (const NodePtr &node, deselected) {
+            d->writeNode(node.data());
+        }
+        update();
+    }
+    emit highlightChanged();
+}
+
+void NodeLayerItem::updateTypes()
+{
+    d->m_types.clear();
+    if (d->m_document) {
+        foreach (const NodeTypePtr &type, d->m_document->nodeTypes()) {
+            d->m_types.append(type);
+            connect(type->style(), &NodeTypeStyle::changed, this, &NodeLayerItem::scheduleCulling, Qt::UniqueConnection);
+            connect(type.data(), &NodeType::dynamicPropertyAdded, this, &NodeLayerItem::scheduleCulling, Qt::UniqueConnection);
+            connect(type.data(), &NodeType::dynamicPropertyRemoved, this, &NodeLayerItem::scheduleCulling, Qt::UniqueConnection);
+        }
+    }
+    if (!d->m_cull) {
+        scheduleCulling();
+    }
+}
+
+void NodeLayerItem::insertNodes(const QModelIndex &parent, int first, int last)
+{
+    Q_UNUSED(parent);
+    if (d->m_rebuild || !d->m_document) {
+        return;
+    }
+    // nodes are always appended to the document
+    Q_ASSERT(first == d->m_nodes.count());
+    const QRectF previousRect = d->m_nodesRect;
+    const NodeList nodes = d->m_document->nodes();
+    bool cull = false;
+    for (int i = first; i <= last; ++i) {
+        const NodePtr &node = nodes.at(i);
+        const QRectF area = d->nodeRect(node.data());
+        d->m_nodes.append(node);
+        d->m_nodesRect |= area;
+        connect(node.data(), &Node::colorChanged, this, &NodeLayerItem::updateNode);
+        connect(node.data(), &Node::typeChanged, this, &NodeLayerItem::scheduleCulling);
+        cull = cull || d->m_culledArea.isEmpty() || d->m_culledArea.intersects(area);
+    }
+    if (d->m_nodesRect != previousRect) {
+        emit nodesRectChanged();
+    }
+    if (cull) {
+        scheduleCulling();
+    }
+}
+
+void NodeLayerItem::removeNodes(const QModelIndex &parent, int first, int last)
+{
+    Q_UNUSED(parent);
+    if (d->m_rebuild || !d->m_document) {
+        return;
+    }
+    bool cull = false;
+    for (int i = first; i <= last; ++i) {
+        const NodePtr &node = d->m_nodes.at(i);
+        disconnect(node.data(), &Node::colorChanged, this, &NodeLayerItem::updateNode);
+        disconnect(node.data(), &Node::typeChanged, this, &NodeLayerItem::scheduleCulling);
+        d->m_moveStart.remove(node.data());
+        cull = d->m_slots.remove(node.data()) > 0 || cull;
+    }
+    if (cull) {
+        scheduleCulling();
+    }
+}
+
+void NodeLayerItem::fillRemovedRows(const QModelIndex &parent, int first, int last)
+{
+    Q_UNUSED(parent);
+    if (d->m_rebuild || !d->m_document) {
+        return;
+    }
+    // the document fills the gap with its last nodes instead of shifting all following nodes
+    const NodeList nodes = d->m_document->nodes();
+    const int count = d->m_nodes.count() - (last - first + 1);
+    for (int i = first; i <= last && i < count; ++i) {
+        d->m_nodes[i] = nodes.at(i);
+    }
+    d->m_nodes.resize(count);
+}
+
+void NodeLayerItem::updatePolish()
+{
+    if (d->m_rebuild) {
+        d->m_rebuild = false;
+        foreach (const NodePtr &node, d->m_nodes) {
+            disconnect(node.data(), &Node::colorChanged, this, &NodeLayerItem::updateNode);
+            disconnect(node.data(), &Node::typeChanged, this, &NodeLayerItem::scheduleCulling);
+        }
+        d->m_nodes.clear();
+
+        const QRectF previousRect = d->m_nodesRect;
+        d->m_nodesRect = QRectF();
+        const GraphDocumentPtr document = d->m_model ? d->m_model->document() : GraphDocumentPtr();
+        d->m_selection->setDocument(document);
+        if (d->m_document != document.data()) {
+            if (d->m_document) {
+                d->m_document->disconnect(this);
+            }
+            d->m_document = document.data();
+            if (document) {
+                connect(document.data(), &GraphDocument::nodePositionsChanged, this, &NodeLayerItem::updateNodes);
+                connect(document.data(), &GraphDocument::nodeTypeAdded, this, &NodeLayerItem::updateTypes);
+                connect(document.data(), &GraphDocument::nodeTypesRemoved, this, &NodeLayerItem::updateTypes);
+            }
+        }
+        updateTypes();
+        if (document) {
+            // the model announces nodes of an open batch only when the batch is closed
+            const NodeList nodes = document->nodes();
+            const int count = qMin(nodes.count(), d->m_model->rowCount());
+            d->m_nodes.reserve(count);
+            for (int i = 0; i < count; ++i) {
+                const NodePtr &node = nodes.at(i);
+                const QRectF area = d->nodeRect(node.data());
+                d->m_nodes.append(node);
+                d->m_nodesRect |= area;
+                connect(node.data(), &Node::colorChanged, this, &NodeLayerItem::updateNode);
+                connect(node.data(), &Node::typeChanged, this, &NodeLayerItem::scheduleCulling);
+            }
+        }
+
+        if (d->m_nodesRect != previousRect) {
+            emit nodesRectChanged();
+        }
+    }
+
+    if (d->m_cull) {
+        d->m_cull = false;
+        d->cull();
+        if (d->m_labelsChanged) {
+            d->m_labelsChanged = false;
+            emit labelNodesChanged();
+        }
+    }
+}
+
+QSGNode * NodeLayerItem::updatePaintNode(QSGNode *node, QQuickItem::UpdatePaintNodeData *)
+{
+    QSGNode *root = node;
+    if (!root) {
+        root = new QSGNode;
+        d->m_nodesDirty = true;
+    }
+
+    if (d->m_nodesDirty) {
+        while (QSGNode *child = root->firstChild()) {
+            root->removeChildNode(child);
+            delete child;
+        }
+        for (int b = 0; b < d->m_batches.count(); ++b) {
+            NodeLayerItemPrivate::Batch &batch = d->m_batches[b];
+            QSGGeometry *geometry = new QSGGeometry(QSGCircleMaterial::attributes(), batch.vertices.count());
+            geometry->setDrawingMode(GL_TRIANGLES);
+            QSGGeometryNode *batchNode = new QSGGeometryNode;
+            batchNode->setGeometry(geometry);
+            batchNode->setMaterial(new QSGCircleMaterial);
+            batchNode->setFlags(QSGNode::OwnsGeometry | QSGNode::OwnsMaterial);
+            root->appendChildNode(batchNode);
+            batch.dirtyFirst = 0;
+            batch.dirtyLast = batch.vertices.count() - 1;
+        }
+        d->m_nodesDirty = false;
+    }
+
+    // copy only the vertices changed since the last frame
+    QSGNode *child = root->firstChild();
+    for (int b = 0; b < d->m_batches.count() && child; ++b, child = child->nextSibling()) {
+        NodeLayerItemPrivate::Batch &batch = d->m_batches[b];
+        if (batch.dirtyFirst == -1 || batch.dirtyLast < batch.dirtyFirst) {
+            batch.dirtyFirst = -1;
+            continue;
+        }
+        QSGGeometryNode *batchNode = static_cast<QSGGeometryNode*>(child);
+        QSGCircleMaterial::Vertex *vertices = static_cast<QSGCircleMaterial::Vertex*>(batchNode->geometry()->vertexData());
+        std::memcpy(vertices + batch.dirtyFirst,
+                    batch.vertices.constData() + batch.dirtyFirst,
+                    (batch.dirtyLast - batch.dirtyFirst + 1) * sizeof(QSGCircleMaterial::Vertex));
+        batchNode->markDirty(QSGNode::DirtyGeometry);
+        batch.dirtyFirst = -1;
+        batch.dirtyLast = -1;
+    }
+    return root;
+}
@@ -0,0 +1,160 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NODELAYERITEM_H
+#define NODELAYERITEM_H
+
+#include "graphtheory_export.h"
+#include "node.h"
+#include <QModelIndex>
+#include <QQuickItem>
+#include <QVariantList>
+
+class QSGNode;
+
+namespace GraphTheory
+{
+class NodeModel;
+class NodeSelectionModel;
+class NodeLayerItemPrivate;
+
+/**
+ * \class NodeLayerItem
+ * Renders all nodes of a NodeModel with one scene graph node per node type. All nodes share
+ * QSGCircleMaterial and position, color and highlight state are vertex attributes, such that
+ * changes never re-rasterize textures. The item also keeps the highlight (i.e., selection)
+ * state of the nodes in a NodeSelectionModel and provides hit-testing and moving of
+ * highlighted nodes for the scene. Selection changes only update the vertices of the nodes
+ * that entered or left the selection.
+ *
+ * Hit-testing and culling use the spatial node index of the GraphDocument. Only nodes close
+ * to visibleArea get vertices, hence render and update cost depend on the visible part of
+ * the document. Nodes inserted into or removed from the model are added to or taken from the
+ * node index in place and only re-cull the vertex buffers if they lie in the culled area.
+ * In aggregated mode, all nodes of one type in a grid cell are drawn as a single point at
+ * their centroid.
+ */
+class NodeLayerItem : public QQuickItem
+{
+    Q_OBJECT
+    Q_PROPERTY(GraphTheory::NodeModel * model READ model WRITE setModel NOTIFY modelChanged)
+    Q_PROPERTY(QPointF origin READ origin WRITE setOrigin NOTIFY originChanged)
+    Q_PROPERTY(QRectF nodesRect READ nodesRect NOTIFY nodesRectChanged)
+    Q_PROPERTY(QRectF visibleArea READ visibleArea WRITE setVisibleArea NOTIFY visibleAreaChanged)
+    Q_PROPERTY(bool aggregated READ isAggregated WRITE setAggregated NOTIFY aggregatedChanged)
+    Q_PROPERTY(bool labelsVisible READ labelsVisible WRITE setLabelsVisible NOTIFY labelsVisibleChanged)
+    Q_PROPERTY(QVariantList labelNodes READ labelNodes NOTIFY labelNodesChanged)
+    Q_PROPERTY(GraphTheory::NodeSelectionModel * selectionModel READ selectionModel CONSTANT)
+
+public:
+    explicit NodeLayerItem(QQuickItem *parent = 0);
+    virtual ~NodeLayerItem();
+    NodeModel * model() const;
+    void setModel(NodeModel *model);
+    /** translation of global origin (0,0) into scene coordinates **/
+    QPointF origin() const;
+    /** set translation of global origin (0,0) into scene coordinates **/
+    void setOrigin(const QPointF &origin);
+    /**
+     * @return area covered by all nodes in global coordinates; the area grows with node
+     *         movements and insertions and is recomputed when the model is reset
+     */
+    QRectF nodesRect() const;
+    /**
+     * @return area in item coordinates that is shown to the user, an empty area means that
+     *         all nodes are shown
+     */
+    QRectF visibleArea() const;
+    void setVisibleArea(const QRectF &area);
+    /**
+     * @return @c true if nodes are drawn as aggregated points per grid cell
+     */
+    bool isAggregated() const;
+    void setAggregated(bool aggregated);
+    bool labelsVisible() const;
+    void setLabelsVisible(bool visible);
+    /**
+     * @return nodes near the visible area that have dynamic properties, if labels are visible
+     *         and the layer is not aggregated; otherwise an empty list
+     */
+    QVariantList labelNodes() const;
+    /**
+     * @return the selection model that stores the highlighted nodes
+     */
+    NodeSelectionModel * selectionModel() const;
+
+    /**
+     * @return the topmost visible node whose circle contains @p point (in item coordinates),
+     *         otherwise 0
+     */
+    Q_INVOKABLE GraphTheory::Node * nodeAt(const QPointF &point) const;
+    Q_INVOKABLE bool isHighlighted(GraphTheory::Node *node) const;
+    Q_INVOKABLE void setHighlighted(GraphTheory::Node *node, bool highlighted);
+    Q_INVOKABLE void clearHighlight();
+    /**
+     * Highlight exactly those visible nodes whose bounding square has its top left corner
+     * inside @p rect (in item coordinates).
+     */
+    Q_INVOKABLE void highlightRect(const QRectF &rect);
+    /**
+     * @return list of highlighted nodes
+     */
+    Q_INVOKABLE QVariantList highlightedNodes() const;
+    /**
+     * Remember the current positions of all highlighted nodes as start of a move operation.
+     */
+    Q_INVOKABLE void startMoveHighlighted();
+    /**
+     * Move all highlighted nodes to their start positions translated by @p delta.
+     */
+    Q_INVOKABLE void moveHighlighted(const QPointF &delta);
+
+protected:
+    virtual void updatePolish() Q_DECL_OVERRIDE;
+    virtual QSGNode * updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) Q_DECL_OVERRIDE;
+
+Q_SIGNALS:
+    void modelChanged();
+    void originChanged();
+    void nodesRectChanged();
+    void visibleAreaChanged();
+    void aggregatedChanged();
+    void labelsVisibleChanged();
+    void labelNodesChanged();
+    void highlightChanged();
+
+private Q_SLOTS:
+    void scheduleRebuild();
+    void scheduleCulling();
+    void updateNode();
+    void updateNodes(const GraphTheory::NodeList &nodes);
+    void updateHighlight(const GraphTheory::NodeList &selected, const GraphTheory::NodeList &deselected);
+    void updateTypes();
+    void insertNodes(const QModelIndex &parent, int first, int last);
+    void removeNodes(const QModelIndex &parent, int first, int last);
+    void fillRemovedRows(const QModelIndex &parent, int first, int last);
+
+private:
+    Q_DISABLE_COPY(NodeLayerItem)
+    const QScopedPointer<NodeLayerItemPrivate> d;
+};
+}
+
+#endif
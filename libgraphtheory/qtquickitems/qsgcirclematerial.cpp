@@ -0,0 +1,170 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "qsgcirclematerial.h"
+#include <QColor>
+#include <QOpenGLShaderProgram>
+
+using namespace GraphTheory;
+
+namespace
+{
+class QSGCircleMaterialShader : public QSGMaterialShader
+{
+public:
+    QSGCircleMaterialShader()
+        : m_matrix(-1)
+        , m_opacity(-1)
+    {
+    }
+
+    const char * vertexShader() const Q_DECL_OVERRIDE
+    {
+        return
+            "uniform highp mat4 qt_Matrix;\n"
+            "attribute highp vec4 vertexCoord;\n"
+            "attribute highp vec2 circleCoord;\n"
+            "attribute lowp vec4 fillColor;\n"
+            "attribute lowp vec4 borderColor;\n"
+            "attribute lowp float highlight;\n"
+            "varying highp vec2 coord;\n"
+            "varying lowp vec4 fill;\n"
+            "varying lowp vec4 border;\n"
+            "varying lowp float highlighted;\n"
+            "void main() {\n"
+            "    coord = circleCoord;\n"
+            "    fill = fillColor;\n"
+            "    border = borderColor;\n"
+            "    highlighted = highlight;\n"
+            "    gl_Position = qt_Matrix * vertexCoord;\n"
+            "}\n";
+    }
+
+    // same shapes as NodeItem painted: half transparent orange highlight disk of radius 16,
+    // border of width 2 at radius 12 and filled disk inside
+    const char * fragmentShader() const Q_DECL_OVERRIDE
+    {
+        return
+            "uniform lowp float qt_Opacity;\n"
+            "varying highp vec2 coord;\n"
+            "varying lowp vec4 fill;\n"
+            "varying lowp vec4 border;\n"
+            "varying lowp float highlighted;\n"
+            "void main() {\n"
+            "    highp float r = length(coord);\n"
+            "    lowp float highlightCoverage = highlighted * (1.0 - smoothstep(15.5, 16.5, r));\n"
+            "    lowp vec4 color = vec4(0.965, 0.455, 0.0, 1.0) * 0.49 * highlightCoverage;\n"
+            "    lowp vec4 body = mix(border, fill, 1.0 - smoothstep(10.5, 11.5, r));\n"
+            "    body = vec4(body.rgb * body.a, body.a) * (1.0 - smoothstep(12.5, 13.5, r));\n"
+            "    gl_FragColor = (body + color * (1.0 - body.a)) * qt_Opacity;\n"
+            "}\n";
+    }
+
+    char const * const * attributeNames() const Q_DECL_OVERRIDE
+    {
+        static const char * const names[] = {
+            "vertexCoord", "circleCoord", "fillColor", "borderColor", "highlight", 0
+        };
+        return names;
+    }
+
+    void updateState(const RenderState &state, QSGMaterial *newMaterial, QSGMaterial *oldMaterial) Q_DECL_OVERRIDE
+    {
+        Q_UNUSED(newMaterial);
+        Q_UNUSED(oldMaterial);
+        if (state.isMatrixDirty()) {
+            program()->setUniformValue(m_matrix, state.combinedMatrix());
+        }
+        if (state.isOpacityDirty()) {
+            program()->setUniformValue(m_opacity, state.opacity());
+        }
+    }
+
+protected:
+    void initialize() Q_DECL_OVERRIDE
+    {
+        m_matrix = program()->uniformLocation("qt_Matrix");
+        m_opacity = program()->uniformLocation("qt_Opacity");
+    }
+
+private:
+    int m_matrix;
+    int m_opacity;
+};
+}
+
+void QSGCircleMaterial::Vertex::set(float x, float y, float u, float v,
+                                    const QColor &fill, const QColor &border, bool highlight)
+{
+    this->x = x;
+    this->y = y;
+    this->u = u;
+    this->v = v;
+    this->fill[0] = fill.red();
+    this->fill[1] = fill.green();
+    this->fill[2] = fill.blue();
+    this->fill[3] = fill.alpha();
+    this->border[0] = border.red();
+    this->border[1] = border.green();
+    this->border[2] = border.blue();
+    this->border[3] = border.alpha();
+    this->highlight = highlight ? 1 : 0;
+}
+
+QSGCircleMaterial::QSGCircleMaterial()
+{
+    setFlag(QSGMaterial::Blending, true);
+}
+
+QSGCircleMaterial::~QSGCircleMaterial()
+{
+
+}
+
+const QSGGeometry::AttributeSet & QSGCircleMaterial::attributes()
+{
+    static QSGGeometry::Attribute data[] = {
+        QSGGeometry::Attribute::create(0, 2, GL_FLOAT, true),
+        QSGGeometry::Attribute::create(1, 2, GL_FLOAT),
+        QSGGeometry::Attribute::create(2, 4, GL_UNSIGNED_BYTE),
+        QSGGeometry::Attribute::create(3, 4, GL_UNSIGNED_BYTE),
+        QSGGeometry::Attribute::create(4, 1, GL_FLOAT)
+    };
+    static QSGGeometry::AttributeSet attributes = { 5, sizeof(Vertex), data };
+    return attributes;
+}
+
+QSGMaterialType * QSGCircleMaterial::type() const
+{
+    static QSGMaterialType type;
+    return &type;
+}
+
+QSGMaterialShader * QSGCircleMaterial::createShader() const
+{
+    return new QSGCircleMaterialShader;
+}
+
+int QSGCircleMaterial::compare(const QSGMaterial *other) const
+{
+    // all state is contained in vertex attributes, hence all circle materials are equal
+    Q_UNUSED(other);
+    return 0;
+}
@@ -0,0 +1,64 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef QSGCIRCLEMATERIAL_H
+#define QSGCIRCLEMATERIAL_H
+
+#include "graphtheory_export.h"
+#include <QSGGeometry>
+#include <QSGMaterial>
+
+namespace GraphTheory
+{
+
+/**
+ * \class QSGCircleMaterial
+ * Shared material for node circles. Each node is a quad whose fragments compute the distance
+ * to the node center, hence fill color, border color and highlight state are plain vertex
+ * attributes and all nodes can be drawn in one batch.
+ */
+class QSGCircleMaterial : public QSGMaterial
+{
+
+public:
+    /** vertex layout matching attributes() **/
+    struct Vertex {
+        float x, y;         //!< position in item coordinates
+        float u, v;         //!< offset to node center in pixels
+        uchar fill[4];      //!< RGBA fill color
+        uchar border[4];    //!< RGBA border color
+        float highlight;    //!< 1 if node is highlighted, otherwise 0
+
+        void set(float x, float y, float u, float v, const QColor &fill, const QColor &border, bool highlight);
+    };
+
+    /** radius of the node including highlight ring **/
+    static const int radius = 16;
+
+    QSGCircleMaterial();
+    virtual ~QSGCircleMaterial();
+    static const QSGGeometry::AttributeSet & attributes();
+    virtual QSGMaterialType * type() const Q_DECL_OVERRIDE;
+    virtual QSGMaterialShader * createShader() const Q_DECL_OVERRIDE;
+    virtual int compare(const QSGMaterial *other) const Q_DECL_OVERRIDE;
+};
+}
+
+#endif
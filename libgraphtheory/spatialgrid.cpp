@@ -0,0 +1,231 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "spatialgrid.h"
+#include <QtMath>
+
+using namespace GraphTheory;
+
+SpatialGrid::SpatialGrid(qreal cellSize)
+    : m_cellSize(cellSize)
+    , m_count(0)
+    , m_mark(0)
+{
+    Q_ASSERT(cellSize > 0);
+}
+
+qreal SpatialGrid::cellSize() const
+{
+    return m_cellSize;
+}
+
+int SpatialGrid::maximumCells()
+{
+    return 64;
+}
+
+void SpatialGrid::clear()
+{
+    m_count = 0;
+    m_cells.clear();
+    m_bounds.clear();
+    m_ranges.clear();
+    m_registered.clear();
+    m_oversized.clear();
+    m_marks.clear();
+    m_mark = 0;
+}
+
+int SpatialGrid::count() const
+{
+    return m_count;
+}
+
+bool SpatialGrid::contains(int item) const
+{
+    return item >= 0 && item < m_registered.size() && m_registered.at(item);
+}
+
+quint64 SpatialGrid::key(int x, int y)
+{
+    return (quint64(quint32(x)) << 32) | quint64(quint32(y));
+}
+
+QPoint SpatialGrid::cell(const QPointF &point) const
+{
+    return QPoint(qFloor(point.x() / m_cellSize), qFloor(point.y() / m_cellSize));
+}
+
+QRect SpatialGrid::cellRange(const QRectF &bounds) const
+{
+    const QRectF area = bounds.normalized();
+    return QRect(cell(area.topLeft()), cell(area.bottomRight()));
+}
+
+void SpatialGrid::insert(int item, const QRectF &bounds)
+{
+    Q_ASSERT(item >= 0);
+    if (item >= m_registered.size()) {
+        m_bounds.resize(item + 1);
+        m_ranges.resize(item + 1);
+        m_registered.resize(item + 1);
+        m_marks.resize(item + 1);
+    }
+    const QRect range = cellRange(bounds);
+    if (m_registered.at(item)) {
+        if (m_ranges.at(item) == range && !range.isNull()) { // cheap path for small movements
+            m_bounds[item] = bounds.normalized();
+            return;
+        }
+        unregister(item);
+    }
+    m_registered[item] = true;
+    m_bounds[item] = bounds.normalized();
+    ++m_count;
+
+    if (qint64(range.width()) * range.height() > maximumCells()) {
+        m_ranges[item] = QRect();
+        m_oversized.append(item);
+        return;
+    }
+    m_ranges[item] = range;
+    for (int x = range.left(); x <= range.right(); ++x) {
+        for (int y = range.top(); y <= range.bottom(); ++y) {
+            m_cells[key(x, y)].append(item);
+        }
+    }
+}
+
+void SpatialGrid::remove(int item)
+{
+    if (!contains(item)) {
+        return;
+    }
+    unregister(item);
+}
+
+void SpatialGrid::unregister(int item)
+{
+    const QRect range = m_ranges.at(item);
+    if (range.isNull()) {
+        m_oversized.removeOne(item);
+    } else {
+        for (int x = range.left(); x <= range.right(); ++x) {
+            for (int y = range.top(); y <= range.bottom(); ++y) {
+                QHash<quint64, QVector<int> >::iterator iter = m_cells.find(key(x, y));
+                if (iter == m_cells.end()) {
+                    continue;
+                }
+                iter->removeOne(item);
+                if (iter->isEmpty()) {
+                    m_cells.erase(iter);
+                }
+            }
+        }
+    }
+    m_registered[item] = false;
+    m_ranges[item] = QRect();
+    --m_count;
+}
+
+QRectF SpatialGrid::bounds(int item) const
+{
+    return contains(item) ? m_bounds.at(item) : QRectF();
+}
+
+QVector<int> SpatialGrid::items(const QRectF &area) const
+{
+    QVector<int> result;
+    const QRectF query = area.normalized();
+    if (++m_mark == 0) { // wrap around of stamps
+        m_marks.fill(0);
+        m_mark = 1;
+    }
+    const auto test = [&](int item) {
+        if (m_marks.at(item) == m_mark) {
+            return;
+        }
+        m_marks[item] = m_mark;
+        const QRectF &bounds = m_bounds.at(item);
+        // QRectF::intersects() is false for points, which are valid bounds
+        if (bounds.left() <= query.right() && bounds.right() >= query.left()
+            && bounds.top() <= query.bottom() && bounds.bottom() >= query.top()
+        ) {
+            result.append(item);
+        }
+    };
+
+    const QRect range = cellRange(query);
+    if (qint64(range.width()) * range.height() > m_cells.size()) {
+        // visit non-empty cells instead of all cells of a large area
+        for (auto iter = m_cells.constBegin(); iter != m_cells.constEnd(); ++iter) {
+            const QPoint position(int(quint32(iter.key() >> 32)), int(quint32(iter.key())));
+            if (range.contains(position)) {
+                foreach (int item, iter.value()) {
+                    test(item);
+                }
+            }
+        }
+    } else {
+        for (int x = range.left(); x <= range.right(); ++x) {
+            for (int y = range.top(); y <= range.bottom(); ++y) {
+                const QHash<quint64, QVector<int> >::const_iterator iter = m_cells.constFind(key(x, y));
+                if (iter == m_cells.constEnd()) {
+                    continue;
+                }
+                foreach (int item, iter.value()) {
+                    test(item);
+                }
+            }
+        }
+    }
+    foreach (int item, m_oversized) {
+        test(item);
+    }
+    return result;
+}
+
+QVector<int> SpatialGrid::cellItems(const QPoint &cell) const
+{
+    return m_cells.value(key(cell.x(), cell.y()));
+}
+
+QVector<QPoint> SpatialGrid::cells(const QRectF &area) const
+{
+    QVector<QPoint> result;
+    const QRect range = cellRange(area);
+    if (qint64(range.width()) * range.height() > m_cells.size()) {
+        for (auto iter = m_cells.constBegin(); iter != m_cells.constEnd(); ++iter) {
+            const QPoint position(int(quint32(iter.key() >> 32)), int(quint32(iter.key())));
+            if (range.contains(position)) {
+                result.append(position);
+            }
+        }
+        return result;
+    }
+    for (int x = range.left(); x <= range.right(); ++x) {
+        for (int y = range.top(); y <= range.bottom(); ++y) {
+            if (m_cells.contains(key(x, y))) {
+                result.append(QPoint(x, y));
+            }
+        }
+    }
+    return result;
+}
@@ -0,0 +1,128 @@
+/*
+ *  Copyright 2026  Rocs Developers
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) version 3, or any
+ *  later version accepted by the membership of KDE e.V. (or its
+ *  successor approved by the membership of KDE e.V.), which shall
+ *  act as a proxy defined in Section 6 of version 3 of the license.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+
+#include "graphtheory_export.h"
+
+#include <QHash>
+#include <QRectF>
+#include <QVector>
+
+namespace GraphTheory
+{
+
+/**
+ * \class SpatialGrid
+ * Uniform grid over axis aligned bounding rectangles of items, which are addressed by
+ * non-negative integer handles. Each item is registered at all cells that its bounds
+ * intersect; items covering more than maximumCells() cells are kept in a separate list
+ * that is tested on every query. Only non-empty cells are stored, hence the grid needs
+ * no fixed extent.
+ *
+ * Insertion, update and removal cost is proportional to the number of covered cells,
+ * queries are proportional to the number of items in the cells intersecting the area.
+ */
+class GRAPHTHEORY_EXPORT SpatialGrid
+{
+public:
+    /**
+     * Creates an empty grid with square cells of edge length @p cellSize.
+     */
+    explicit SpatialGrid(qreal cellSize = 128);
+
+    qreal cellSize() const;
+
+    /**
+     * @return maximal number of cells an item is registered at
+     */
+    static int maximumCells();
+
+    /**
+     * Removes all items.
+     */
+    void clear();
+
+    /**
+     * @return number of registered items
+     */
+    int count() const;
+
+    /**
+     * @return @c true if @p item is registered
+     */
+    bool contains(int item) const;
+
+    /**
+     * Register @p item with bounding rectangle @p bounds. If @p item is already registered,
+     * its bounds are updated.
+     */
+    void insert(int item, const QRectF &bounds);
+
+    /**
+     * Remove @p item from the grid.
+     */
+    void remove(int item);
+
+    /**
+     * @return bounds of @p item as given at insert()
+     */
+    QRectF bounds(int item) const;
+
+    /**
+     * @return all items whose bounds intersect @p area, each item is contained once
+     */
+    QVector<int> items(const QRectF &area) const;
+
+    /**
+     * @return cell coordinates of the cell containing @p point
+     */
+    QPoint cell(const QPointF &point) const;
+
+    /**
+     * @return all items registered at cell @p cell, including items whose bounds only
+     *         partially cover the cell
+     */
+    QVector<int> cellItems(const QPoint &cell) const;
+
+    /**
+     * @return coordinates of all non-empty cells intersecting @p area
+     */
+    QVector<QPoint> cells(const QRectF &area) const;
+
+private:
+    static quint64 key(int x, int y);
+    QRect cellRange(const QRectF &bounds) const;
+    void unregister(int item);
+
+    qreal m_cellSize;
+    int m_count;
+    QHash<quint64, QVector<int> > m_cells;
+    QVector<QRectF> m_bounds;        //!< bounds of each item, indexed by handle
+    QVector<QRect> m_ranges;         //!< registered cell range, null if item is oversized
+    QVector<bool> m_registered;
+    QVector<int> m_oversized;
+    mutable QVector<quint32> m_marks; //!< query stamps to report every item once
+    mutable quint32 m_mark;
+};
+}
+
+#endif
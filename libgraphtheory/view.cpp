@@ -24,12 +24,15 @@
 #include "edge.h"
 #include "models/nodemodel.h"
 #include "models/edgemodel.h"
+#include "models/nodeselectionmodel.h"
 #include "models/nodepropertymodel.h"
 #include "models/edgepropertymodel.h"
 #include "models/nodetypemodel.h"
 #include "models/edgetypemodel.h"
 #include "qtquickitems/nodeitem.h"
+#include "qtquickitems/nodelayeritem.h"
 #include "qtquickitems/edgeitem.h"
+#include "qtquickitems/edgelayeritem.h"
 #include "dialogs/nodeproperties.h"
 #include "dialogs/edgeproperties.h"
 #include "logging_p.h"
@@ -92,9 +95,12 @@ View::View(QWidget *parent)
     qmlRegisterType<GraphTheory::NodeType>("org.kde.rocs.graphtheory", 1, 0, "NodeType");
     qmlRegisterType<GraphTheory::EdgeType>("org.kde.rocs.graphtheory", 1, 0, "EdgeType");
     qmlRegisterType<GraphTheory::NodeItem>("org.kde.rocs.graphtheory", 1, 0, "NodeItem");
+    qmlRegisterType<GraphTheory::NodeLayerItem>("org.kde.rocs.graphtheory", 1, 0, "NodeLayerItem");
     qmlRegisterType<GraphTheory::EdgeItem>("org.kde.rocs.graphtheory", 1, 0, "EdgeItem");
+    qmlRegisterType<GraphTheory::EdgeLayerItem>("org.kde.rocs.graphtheory", 1, 0, "EdgeLayerItem");
     qmlRegisterType<GraphTheory::NodeModel>("org.kde.rocs.graphtheory", 1, 0, "NodeModel");
     qmlRegisterType<GraphTheory::EdgeModel>("org.kde.rocs.graphtheory", 1, 0, "EdgeModel");
+    qmlRegisterType<GraphTheory::NodeSelectionModel>("org.kde.rocs.graphtheory", 1, 0, "NodeSelectionModel");
     qmlRegisterType<GraphTheory::NodePropertyModel>("org.kde.rocs.graphtheory", 1, 0, "NodePropertyModel");
     qmlRegisterType<GraphTheory::EdgePropertyModel>("org.kde.rocs.graphtheory", 1, 0, "EdgePropertyModel");
     qmlRegisterType<GraphTheory::NodeTypeModel>("org.kde.rocs.graphtheory", 1, 0, "NodeTypeModel");
@@ -160,8 +166,7 @@ void View::createNode(qreal x, qreal y, int typeIndex)
     Q_ASSERT(typeIndex < d->m_nodeTypeModel->rowCount());
     NodePtr node = Node::create(d->m_document);
     node->setType(d->m_nodeTypeModel->type(typeIndex));
-    node->setX(x);
-    node->setY(y);
+    node->setPosition(QPointF(x, y));
 }
 
 void View::createEdge(Node *from, Node *to, int typeIndex)
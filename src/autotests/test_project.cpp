@@ -27,6 +27,7 @@
 #include "libgraphtheory/node.h"
 #include "libgraphtheory/edge.h"
 #include "project/project.h"
+#include <QSignalSpy>
 #include <QTemporaryFile>
 #include <QUrl>
 #include <QTest>
@@ -62,8 +63,14 @@ void TestProject::projectOperations()
     QTemporaryFile graphFile;
     graphFile.setFileTemplate("XXXXXXX.graph2");
     graphFile.open();
-    GraphTheory::GraphDocumentPtr graphDoc = project.importGraphDocument(QUrl::fromLocalFile(graphFile.fileName()));
+    QSignalSpy loadedSpy(&project, SIGNAL(graphDocumentsLoaded()));
+    project.importGraphDocument(QUrl::fromLocalFile(graphFile.fileName()));
+    QVERIFY(project.isLoadingGraphDocuments());
+    QCOMPARE(project.graphDocuments().length(), 0);
+    QVERIFY(loadedSpy.wait());
+    QVERIFY(!project.isLoadingGraphDocuments());
     QCOMPARE(project.graphDocuments().length(), 1);
+    GraphTheory::GraphDocumentPtr graphDoc = project.graphDocuments().first();
     QVERIFY(project.graphDocuments().first()->documentUrl().toLocalFile().startsWith(project.workingDir()));
     project.removeGraphDocument(graphDoc);
     QCOMPARE(project.graphDocuments().length(), 0);
@@ -90,6 +97,7 @@ void TestProject::loadSave()
     QVERIFY(project.projectSave());
 
     Project loadedProject(QUrl::fromLocalFile(projectFile.fileName()), graphEditor);
+    QTRY_VERIFY(!loadedProject.isLoadingGraphDocuments());
     QCOMPARE(loadedProject.codeDocuments().count(), project.codeDocuments().count());
     QCOMPARE(loadedProject.graphDocuments().count(), project.graphDocuments().count());
 
@@ -120,6 +128,7 @@ void TestProject::loadSaveMultipleGraphDocuments()
     QVERIFY(project.projectSave());
 
     Project loadedProject(QUrl::fromLocalFile(projectFile.fileName()), graphEditor);
+    QTRY_VERIFY(!loadedProject.isLoadingGraphDocuments());
     QCOMPARE(loadedProject.graphDocuments().count(), 2);
     QCOMPARE(loadedProject.graphDocuments().at(0)->nodes().count(), 1);
     QCOMPARE(loadedProject.graphDocuments().at(0)->documentName(), QString("docA"));
@@ -52,10 +52,17 @@ public:
         , m_modified(false)
         , m_activeGraphDocumentIndex(-1)
         , m_activeCodeDocumentIndex(-1)
+        , m_openingGraphDocument(false)
     {
 
     }
 
+    struct PendingGraphDocument {
+        QUrl url;
+        QString name; //!< document name stored in the project file
+        bool imported; //!< true if the document is copied into the working directory
+    };
+
     QUrl m_projectUrl; //!< the project's archive file
     QTemporaryDir m_workingDirectory; //!< temporary directory where all project files are organized
     QList<KTextEditor::Document*> m_codeDocuments;
@@ -68,6 +75,9 @@ public:
     int m_activeGraphDocumentIndex;
     int m_activeCodeDocumentIndex;
 
+    QList<PendingGraphDocument> m_pendingGraphDocuments; //!< loaded one after the other in order
+    bool m_openingGraphDocument; //!< true while the first pending document is loaded
+
     /**
      * Set project from project archive file.
      */
@@ -114,12 +124,12 @@ bool ProjectPrivate::loadProject(const QUrl &url)
         QJsonObject docInfo = graphDocs.at(index).toObject();
         QString fileName = docInfo["file"].toString();
         QUrl fileUrl = QUrl::fromLocalFile(m_workingDirectory.path() + QChar('/') + fileName);
-        GraphDocumentPtr document = m_graphEditor->openDocument(fileUrl);
-        // add only to project, if document was loaded correctly
-        if (document) {
-            document->setDocumentName(docInfo["name"].toString());
-            m_graphDocuments.append(document);
-        }
+        // documents are loaded in the background and added in this order, see Project::onGraphDocumentOpened()
+        PendingGraphDocument pending;
+        pending.url = fileUrl;
+        pending.name = docInfo["name"].toString();
+        pending.imported = false;
+        m_pendingGraphDocuments.append(pending);
     }
     m_journal = KTextEditor::Editor::instance()->createDocument(nullptr);
     m_journal->openUrl(QUrl::fromLocalFile(m_workingDirectory.path() + QChar('/') + metaInfo["journal.txt"].toString()));
@@ -169,6 +179,8 @@ Project::Project(GraphTheory::Editor *graphEditor)
     : d(new ProjectPrivate)
 {
     d->m_graphEditor = graphEditor;
+    connect(graphEditor, &GraphTheory::Editor::documentOpened,
+        this, &Project::onGraphDocumentOpened);
     d->m_journal = KTextEditor::Editor::instance()->createDocument(nullptr);
     d->m_journal->saveAs(QUrl::fromLocalFile(workingDir() + QChar('/') + QString("journal.txt")));
 }
@@ -179,16 +191,15 @@ Project::Project(const QUrl &projectFile, GraphTheory::Editor *graphEditor)
 {
     d->m_graphEditor = graphEditor;
     d->m_projectUrl = projectFile;
+    connect(graphEditor, &GraphTheory::Editor::documentOpened,
+        this, &Project::onGraphDocumentOpened);
     d->loadProject(projectFile);
 
     for (const auto &document : d->m_codeDocuments) {
         connect(document, &KTextEditor::Document::modifiedChanged,
             this, &Project::modifiedChanged);
     }
-    for (const auto &document : d->m_graphDocuments) {
-        connect(document.data(), &GraphDocument::modifiedChanged,
-            this, &Project::modifiedChanged);
-    }
+    openNextGraphDocument();
 }
 
 Project::~Project()
@@ -341,13 +352,60 @@ bool Project::addGraphDocument(GraphDocumentPtr document)
     return true;
 }
 
-GraphTheory::GraphDocumentPtr Project::importGraphDocument(const QUrl &documentUrl)
+void Project::importGraphDocument(const QUrl &documentUrl)
 {
     Q_ASSERT(d->m_graphEditor);
-    GraphTheory::GraphDocumentPtr document = d->m_graphEditor->openDocument(documentUrl);
-    Q_ASSERT(document);
-    addGraphDocument(document);
-    return document;
+    ProjectPrivate::PendingGraphDocument pending;
+    pending.url = documentUrl;
+    pending.imported = true;
+    d->m_pendingGraphDocuments.append(pending);
+    openNextGraphDocument();
+}
+
+bool Project::isLoadingGraphDocuments() const
+{
+    return !d->m_pendingGraphDocuments.isEmpty();
+}
+
+void Project::openNextGraphDocument()
+{
+    while (!d->m_openingGraphDocument && !d->m_pendingGraphDocuments.isEmpty()) {
+        if (d->m_graphEditor->openDocument(d->m_pendingGraphDocuments.first().url)) {
+            d->m_openingGraphDocument = true;
+            return;
+        }
+        qCritical() << "Could not load graph document" << d->m_pendingGraphDocuments.first().url;
+        d->m_pendingGraphDocuments.removeFirst();
+    }
+    if (!d->m_openingGraphDocument) {
+        emit graphDocumentsLoaded();
+    }
+}
+
+void Project::onGraphDocumentOpened(const QUrl &documentUrl, GraphDocumentPtr document)
+{
+    // the editor reports the documents of all requesters
+    if (!d->m_openingGraphDocument || d->m_pendingGraphDocuments.first().url != documentUrl) {
+        return;
+    }
+    const ProjectPrivate::PendingGraphDocument pending = d->m_pendingGraphDocuments.takeFirst();
+    d->m_openingGraphDocument = false;
+
+    // add only to project, if document was loaded correctly
+    if (!document) {
+        qCritical() << "Could not load graph document" << documentUrl;
+    } else if (pending.imported) {
+        addGraphDocument(document);
+    } else {
+        document->setDocumentName(pending.name);
+        const int index = d->m_graphDocuments.length();
+        emit graphDocumentAboutToBeAdded(document, index);
+        connect(document.data(), &GraphDocument::modifiedChanged,
+            this, &Project::modifiedChanged);
+        d->m_graphDocuments.append(document);
+        emit graphDocumentAdded();
+    }
+    openNextGraphDocument();
 }
 
 void Project::removeGraphDocument(GraphDocumentPtr document)
@@ -400,6 +458,10 @@ bool Project::projectSave()
         qCritical() << "No project file specified, abort saving.";
         return false;
     }
+    if (isLoadingGraphDocuments()) {
+        qCritical() << "Graph documents are still being loaded, abort saving.";
+        return false;
+    }
     KTar tar = KTar(d->m_projectUrl.toLocalFile(), QString("application/x-gzip"));
     tar.open(QIODevice::WriteOnly);
 
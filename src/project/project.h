@@ -148,9 +148,16 @@ public:
 
     /**
      * Import the graph document given in file @p documentUrl to the project. This creates a copy
-     * of the original graph document.
+     * of the original graph document. The file is loaded in the background, the document is
+     * added to the project like by addGraphDocument() as soon as it is loaded.
      */
-    GraphTheory::GraphDocumentPtr importGraphDocument(const QUrl &documentUrl);
+    void importGraphDocument(const QUrl &documentUrl);
+
+    /**
+     * @return @e true while graph documents of the project file or of imports are loaded,
+     *         otherwise @e false
+     */
+    bool isLoadingGraphDocuments() const;
 
     /**
      * Remove the graph file @p document from the project
@@ -171,6 +178,13 @@ Q_SIGNALS:
     void graphDocumentRemoved();
     void activeGraphDocumentChanged(int index);
     void activeGraphDocumentChanged(GraphTheory::GraphDocumentPtr document);
+    /**
+     * All graph documents that were requested to be loaded are loaded or failed to load.
+     */
+    void graphDocumentsLoaded();
+
+private Q_SLOTS:
+    void onGraphDocumentOpened(const QUrl &documentUrl, GraphTheory::GraphDocumentPtr document);
 
   /*
    * General file related actions.
@@ -221,6 +235,11 @@ public:
     bool isModified() const;
 
 private:
+    /**
+     * Start loading the first pending graph document, unless one is being loaded.
+     */
+    void openNextGraphDocument();
+
     const QScopedPointer<ProjectPrivate> d;
 };
 
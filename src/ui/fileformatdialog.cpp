@@ -20,12 +20,14 @@
 
 #include "fileformatdialog.h"
 #include "libgraphtheory/fileformats/fileformatmanager.h"
+#include "libgraphtheory/fileformats/documentimporter.h"
 #include "fileformats/fileformatinterface.h"
 #include "graphdocument.h"
 #include <settings.h>
 #include <KLocalizedString>
 #include <QFileDialog>
 #include <QDebug>
+#include <QProgressDialog>
 #include <QPushButton>
 #include <KMessageBox>
 #include <QUrl>
@@ -108,7 +110,7 @@ bool FileFormatDialog::exportFile(GraphDocumentPtr document) const
     return true;
 }
 
-GraphDocumentPtr FileFormatDialog::importFile()
+bool FileFormatDialog::importFile()
 {
     FileFormatManager manager;
 
@@ -122,37 +124,43 @@ GraphDocumentPtr FileFormatDialog::importFile()
     QPointer<QFileDialog> dialog = new QFileDialog(qobject_cast< QWidget* >(parent()),
                                                 i18nc("@title:window", "Import Graph File into Project"));
     if (!dialog->exec()) {
-        return GraphDocumentPtr();
+        return false;
     }
 
     qDebug() << "Extensions:" << ext;
     QString fileName = dialog->selectedFiles().first();
     if (fileName.isEmpty()) {
-        return GraphDocumentPtr();
-    }
-
-    int index = fileName.lastIndexOf('.');
-    FileFormatInterface * filePlugin = 0;
-    if (index == -1) {
-        qDebug() << "Cannot open file without extension.";
-        return GraphDocumentPtr();
-    }
-
-    qDebug() << fileName.right(fileName.count() - index);
-    filePlugin =manager.backendByExtension(fileName.right(fileName.count() - index));
-
-    if (!filePlugin) {
-        qDebug() <<  "Cannot handle extension " <<  fileName.right(3);
-        return GraphDocumentPtr();
+        return false;
     }
 
-    filePlugin->setFile(QUrl::fromLocalFile(fileName));
-    filePlugin->readFile();
-    if (filePlugin->hasError()) {
-        qDebug() << "Error loading file" << fileName << filePlugin->errorString();
-        return GraphDocumentPtr();
-    }
-    else {
-        return filePlugin->graphDocument();
+    // read file in background, the progress dialog keeps the UI responsive and allows canceling
+    DocumentImporter *importer = new DocumentImporter(this);
+    QProgressDialog *progress = new QProgressDialog(i18nc("@info:progress", "Importing graph file..."),
+                             i18nc("@action:button", "Cancel"), 0, 100,
+                             qobject_cast< QWidget* >(parent()));
+    progress->setWindowModality(Qt::WindowModal);
+    progress->setMinimumDuration(500);
+    connect(importer, &DocumentImporter::progressChanged, progress, [progress](qint64 value, qint64 maximum) {
+        progress->setValue(maximum > 0 ? static_cast<int>(100 * value / maximum) : 0);
+    });
+    connect(progress, &QProgressDialog::canceled, importer, &DocumentImporter::cancel);
+    if (!importer->start(QUrl::fromLocalFile(fileName))) {
+        qDebug() << "Cannot import file" << fileName << importer->errorString();
+        delete progress;
+        delete importer;
+        return false;
     }
+    connect(importer, &DocumentImporter::finished, this, [this, importer, progress, fileName]() {
+        progress->deleteLater();
+        importer->deleteLater();
+        if (!importer->document()) {
+            if (!importer->isCanceled()) {
+                KMessageBox::error(qobject_cast< QWidget* >(parent()), i18n(
+                    "<p>Error occurred when reading file: <strong>'%1'</strong></p>", importer->errorString()));
+            }
+            qDebug() << "Error loading file" << fileName << importer->errorString();
+        }
+        emit importFinished(importer->document());
+    });
+    return true;
 }
@@ -32,9 +32,22 @@ class FileFormatDialog : public QObject
 
 public:
     explicit FileFormatDialog(QObject *parent = 0);
-    GraphTheory::GraphDocumentPtr importFile();
+
+    /**
+     * Ask for a graph file and start importing it in the background. The method returns
+     * immediately, importFinished() is emitted when the import is done.
+     * @return @e true if an import was started, otherwise @e false
+     */
+    bool importFile();
     bool exportFile(GraphTheory::GraphDocumentPtr document) const;
     void dialogExec();
+
+Q_SIGNALS:
+    /**
+     * The import started by importFile() finished. On failure or cancellation @p document is
+     * null, errors were already reported to the user.
+     */
+    void importFinished(GraphTheory::GraphDocumentPtr document);
 };
 
 #endif
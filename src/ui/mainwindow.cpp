@@ -530,13 +530,26 @@ void MainWindow::quit()
 
 void MainWindow::importGraphDocument()
 {
-    FileFormatDialog importer(this);
-    GraphDocumentPtr document = importer.importFile();
-    if (!document) {
+    // the dialog object lives until its background import is done, the document is added to
+    // the project that was current when the import was started
+    FileFormatDialog *importer = new FileFormatDialog(this);
+    QPointer<Project> project = m_currentProject;
+    connect(importer, &FileFormatDialog::importFinished, this, [importer, project](GraphDocumentPtr document) {
+        importer->deleteLater();
+        if (!document) {
+            qWarning() << "No graph document was imported.";
+            return;
+        }
+        if (!project) {
+            document->destroy();
+            return;
+        }
+        project->addGraphDocument(document);
+    });
+    if (!importer->importFile()) {
         qWarning() << "No graph document was imported.";
-        return;
+        importer->deleteLater();
     }
-    m_currentProject->addGraphDocument(document);
 }
 
 void MainWindow::exportGraphDocument()